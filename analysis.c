@@ -178,13 +178,19 @@ LuckFirst(const TanBoard anBoard, const int n0, const int n1, cubeinfo * pci, co
 
 }
 
-static float
-LuckNormal(const TanBoard anBoard, const int n0, const int n1, const cubeinfo * pci, const evalcontext * pec)
+/*
+ * Find the best move for each of the 21 rolls of anBoard, with the
+ * player pci->fMove on roll, and the evaluation after it. Shared by
+ * the luck analysis and the temperature map.
+ */
+
+extern int
+EvaluateRolls(rollexpansion * pre, const TanBoard anBoard, const cubeinfo * pci, const evalcontext * pec)
 {
 
     TanBoard anBoardTemp;
-    int i, j;
-    float aar[6][6], ar[NUM_ROLLOUT_OUTPUTS], rMean = 0.0f;
+    int i, j, k;
+    float ar[NUM_ROLLOUT_OUTPUTS];
     cubeinfo ciOpp;
     movelist ml;
 
@@ -199,7 +205,7 @@ LuckNormal(const TanBoard anBoard, const int n0, const int n1, const cubeinfo *
             if (FindnSaveBestMoves(&ml, i + 1, j + 1, (ConstTanBoard) anBoardTemp, NULL, 0.0f,
                                    pci, pec, defaultFilters) < 0) {
                 g_free(ml.amMoves);
-                return ERR_VAL;
+                return -1;
             }
 
             if (!ml.cMoves) {
@@ -207,26 +213,60 @@ LuckNormal(const TanBoard anBoard, const int n0, const int n1, const cubeinfo *
                 SwapSides(anBoardTemp);
 
                 if (GeneralEvaluationE(ar, (ConstTanBoard) anBoardTemp, &ciOpp, pec) < 0)
-                    return ERR_VAL;
+                    return -1;
 
                 if (pec->fCubeful) {
                     if (pci->nMatchTo)
-                        aar[i][j] = -mwc2eq(ar[OUTPUT_CUBEFUL_EQUITY], &ciOpp);
+                        pre->aarScore[i][j] = -mwc2eq(ar[OUTPUT_CUBEFUL_EQUITY], &ciOpp);
                     else
-                        aar[i][j] = -ar[OUTPUT_CUBEFUL_EQUITY];
+                        pre->aarScore[i][j] = -ar[OUTPUT_CUBEFUL_EQUITY];
                 } else
-                    aar[i][j] = -ar[OUTPUT_EQUITY];
+                    pre->aarScore[i][j] = -ar[OUTPUT_EQUITY];
+
+                /* as ScoreMove */
+                InvertEvaluationR(ar, &ciOpp);
+                if (pci->nMatchTo)
+                    ar[OUTPUT_CUBEFUL_EQUITY] = mwc2eq(ar[OUTPUT_CUBEFUL_EQUITY], pci);
+
+                memcpy(pre->aaarOutput[i][j], ar, sizeof(ar));
+                for (k = 0; k < 8; k++)
+                    pre->aaanMove[i][j][k] = -1;
 
             } else {
-                aar[i][j] = ml.amMoves[0].rScore;
+                pre->aarScore[i][j] = ml.amMoves[0].rScore;
+                memcpy(pre->aaarOutput[i][j], ml.amMoves[0].arEvalMove, sizeof(ar));
+                memcpy(pre->aaanMove[i][j], ml.amMoves[0].anMove, sizeof(pre->aaanMove[i][j]));
                 g_free(ml.amMoves);
             }
 
-            rMean += (i == j) ? aar[i][j] : aar[i][j] * 2.0f;
+            if (i != j) {
+                pre->aarScore[j][i] = pre->aarScore[i][j];
+                memcpy(pre->aaarOutput[j][i], pre->aaarOutput[i][j], sizeof(ar));
+                memcpy(pre->aaanMove[j][i], pre->aaanMove[i][j], sizeof(pre->aaanMove[i][j]));
+            }
 
         }
 
-    return aar[n0][n1] - rMean / 36.0f;
+    return 0;
+
+}
+
+static float
+LuckNormal(const TanBoard anBoard, const int n0, const int n1, const cubeinfo * pci, const evalcontext * pec)
+{
+
+    rollexpansion re;
+    int i, j;
+    float rMean = 0.0f;
+
+    if (EvaluateRolls(&re, anBoard, pci, pec) < 0)
+        return ERR_VAL;
+
+    for (i = 0; i < 6; i++)
+        for (j = 0; j < 6; j++)
+            rMean += re.aarScore[i][j];
+
+    return re.aarScore[n0][n1] - rMean / 36.0f;
 
 }
 
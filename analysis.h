@@ -23,6 +23,7 @@
 
 #include "list.h"
 #include "gnubg-types.h"
+#include "eval.h"
 
 typedef enum {
     LUCK_VERYBAD, LUCK_BAD, LUCK_NONE, LUCK_GOOD, LUCK_VERYGOOD
@@ -141,6 +142,17 @@ extern void getMWCFromError(const statcontext * psc, float aaaar[3][2][2][2]);
 
 extern skilltype Skill(float r);
 
+/* Best move and evaluation after each of the 21 rolls of a position */
+typedef struct {
+    int aaanMove[6][6][8];      /* all -1 if the roll has no legal move */
+    /* evaluation after the move, for the player on roll, as move.arEvalMove */
+    float aaarOutput[6][6][NUM_ROLLOUT_OUTPUTS];
+    /* equity after the move, as move.rScore */
+    float aarScore[6][6];
+} rollexpansion;
+
+extern int EvaluateRolls(rollexpansion * pre, const TanBoard anBoard, const cubeinfo * pci, const evalcontext * pec);
+
 extern int MatchAnalysed(void);
 extern float LuckAnalysis(const TanBoard anBoard, int n0, int n1, matchstate * pms);
 extern lucktype Luck(float r);
@@ -0,0 +1,384 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* Move rankings that deepen until a deadline, see anytime.h */
+
+#include "config.h"
+
+#include <glib.h>
+#include <string.h>
+
+#include "backgammon.h"
+#include "anytime.h"
+#include "multithread.h"
+
+extern int
+FindBestMovesAnytime(movelist * pml, int nDice0, int nDice1, const TanBoard anBoard,
+                     const cubeinfo * pci, const evalcontext * pec,
+                     movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES], double rDeadline, anytimefunc pf, void *p)
+{
+    evalcontext ec;
+    movelist ml;
+    unsigned int n;
+    int nPlies = -1;
+
+    pml->cMoves = 0;
+    pml->amMoves = NULL;
+
+    memcpy(&ec, pec, sizeof(ec));
+
+    for (n = 0; n <= pec->nPlies; n++) {
+        ec.nPlies = n;
+
+        /* 0-ply always completes, so that there is a result */
+        EvalSetDeadline(n ? rDeadline : 0.0);
+
+        if (FindnSaveBestMoves(&ml, nDice0, nDice1, anBoard, NULL, 0.0f, pci, &ec, aamf) < 0)
+            break;
+
+        g_free(pml->amMoves);
+        *pml = ml;
+        nPlies = (int) n;
+
+        if (pf)
+            pf(n, pml, p);
+
+        /* no choice to refine */
+        if (ml.cMoves <= 1)
+            break;
+
+        if (rDeadline > 0.0 && get_time() >= rDeadline)
+            break;
+    }
+
+    EvalSetDeadline(0.0);
+
+    if (fInterrupt) {
+        g_free(pml->amMoves);
+        pml->cMoves = 0;
+        pml->amMoves = NULL;
+        return -1;
+    }
+
+    return nPlies;
+}
+
+typedef struct {
+    unsigned int nPlies;
+    movelist ml;
+} anytimelevel;
+
+typedef struct {
+    movelist ml;
+    int anDice[2];
+    TanBoard anBoard;
+    cubeinfo ci;
+    evalcontext ec;
+    movefilter(*aamf)[MAX_FILTER_PLIES];
+    double rDeadline;
+    int nPlies;
+    anytimefunc pf;
+    void *p;
+    GPtrArray *paLevels;        /* levels not yet passed to pf, guarded by MT_Exclusive */
+} anytimedata;
+
+/* Passes the queued levels to pf, on the main thread */
+
+static void
+PassLevels(anytimedata * pad)
+{
+    for (;;) {
+        anytimelevel *pal = NULL;
+
+        MT_Exclusive();
+        if (pad->paLevels->len)
+            pal = g_ptr_array_remove_index(pad->paLevels, 0);
+        MT_Release();
+
+        if (!pal)
+            break;
+
+        pad->pf(pal->nPlies, &pal->ml, pad->p);
+
+        g_free(pal->ml.amMoves);
+        g_free(pal);
+    }
+}
+
+static void
+QueueLevel(unsigned int nPlies, const movelist * pml, void *p)
+{
+    anytimedata *pad = p;
+    anytimelevel *pal = g_new(anytimelevel, 1);
+
+    pal->nPlies = nPlies;
+    pal->ml = *pml;
+    if (pml->cMoves) {
+        pal->ml.amMoves = g_malloc(pml->cMoves * sizeof(move));
+        memcpy(pal->ml.amMoves, pml->amMoves, pml->cMoves * sizeof(move));
+    }
+
+    MT_Exclusive();
+    g_ptr_array_add(pad->paLevels, pal);
+    MT_Release();
+
+#if !defined(USE_MULTITHREAD)
+    /* the search runs on the main thread */
+    PassLevels(pad);
+#endif
+}
+
+static void
+AnytimeTask(void *p)
+{
+    anytimedata *pad = p;
+
+    pad->nPlies = FindBestMovesAnytime(&pad->ml, pad->anDice[0], pad->anDice[1], (ConstTanBoard) pad->anBoard,
+                                       &pad->ci, &pad->ec, pad->aamf, pad->rDeadline,
+                                       pad->pf ? QueueLevel : NULL, pad);
+}
+
+static anytimedata *padProgress;
+
+static gboolean
+AnytimeProgress(gpointer UNUSED(unused))
+{
+    if (padProgress && padProgress->pf)
+        PassLevels(padProgress);
+
+    return TRUE;
+}
+
+extern int
+RunAnytime(movelist * pml, int nDice0, int nDice1, const TanBoard anBoard,
+           const cubeinfo * pci, const evalcontext * pec,
+           movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES], double rSeconds, anytimefunc pf, void *p)
+{
+    anytimedata ad;
+
+    ad.anDice[0] = nDice0;
+    ad.anDice[1] = nDice1;
+    memcpy(ad.anBoard, anBoard, sizeof(TanBoard));
+    ad.ci = *pci;
+    ad.ec = *pec;
+    ad.aamf = aamf;
+    ad.rDeadline = rSeconds > 0.0 ? get_time() + rSeconds * 1000.0 : 0.0;
+    ad.nPlies = -1;
+    ad.pf = pf;
+    ad.p = p;
+    ad.paLevels = g_ptr_array_new();
+
+    padProgress = &ad;
+    mt_add_tasks(1, AnytimeTask, &ad, NULL);
+    (void) MT_WaitForTasks(AnytimeProgress, 100, FALSE);
+    padProgress = NULL;
+
+    if (pf)
+        PassLevels(&ad);
+    g_ptr_array_free(ad.paLevels, TRUE);
+
+    *pml = ad.ml;
+
+    return ad.nPlies;
+}
+
+/* Seconds per bot decision, 0 to use the configured settings */
+float rTimeBudget = 0.0f;
+
+/* Assumed until "calibrate" has measured the speed of this machine */
+#define DEFAULT_EVALS_PER_SEC 100000.0
+
+/* Cost of picking the move for a roll inside an n-ply evaluation, in
+ * static evaluations: the pruning net for all candidates and the full
+ * net for the few it keeps, or the full net for every candidate */
+#define SELECT_COST_PRUNE 8.0
+#define SELECT_COST_FULL 20.0
+
+/* Observed time over predicted time, corrected after every budgeted move
+ * so that the model follows the cache hit rate and the kind of positions
+ * played. Updated under MT_Exclusive. */
+static double rCostScale = 1.0;
+
+static double
+EvalCost(unsigned int nPlies, int fUsePrune)
+{
+    double rSelect = fUsePrune ? SELECT_COST_PRUNE : SELECT_COST_FULL;
+    double r = 1.0;
+    unsigned int i;
+
+    for (i = 0; i < nPlies; i++)
+        r = 21.0 * (rSelect + r);
+
+    return r;
+}
+
+/* Static evaluations per second for a single search */
+static double
+EvalRate(void)
+{
+    double r = rEvalsPerSec > 0 ? rEvalsPerSec / MT_GetNumThreads() : DEFAULT_EVALS_PER_SEC;
+
+    return r / rCostScale;
+}
+
+/* Predicted cost of FindnSaveBestMoves at nPlies, as it narrows cMoves
+ * down through the filters amf */
+static double
+MoveSearchCost(unsigned int cMoves, unsigned int nPlies, const movefilter amf[MAX_FILTER_PLIES], int fUsePrune)
+{
+    double r = 0.0;
+    unsigned int iPly;
+
+    for (iPly = 0; iPly < nPlies && iPly < MAX_FILTER_PLIES; iPly++) {
+        if (amf[iPly].Accept < 0)
+            continue;
+
+        r += cMoves * EvalCost(iPly, fUsePrune);
+        cMoves = MIN(cMoves, (unsigned int) (amf[iPly].Accept + amf[iPly].Extra));
+    }
+
+    return r + cMoves * EvalCost(nPlies, fUsePrune);
+}
+
+/* The anytime search also completes every shallower level */
+static double
+AnytimeCost(unsigned int cMoves, unsigned int nPlies, movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES],
+            int fUsePrune)
+{
+    double r = cMoves * EvalCost(0, fUsePrune);
+    unsigned int n;
+
+    for (n = 1; n <= nPlies; n++)
+        r += MoveSearchCost(cMoves, n, aamf[MIN(n, MAX_FILTER_PLIES) - 1], fUsePrune);
+
+    return r;
+}
+
+/* Narrows the filters of an n-ply search by one step, starting with the
+ * stage that feeds the deepest (and most expensive) ply. Returns FALSE
+ * if they are as narrow as they get. */
+static int
+NarrowFilters(movefilter amf[MAX_FILTER_PLIES], unsigned int nPlies)
+{
+    int i;
+
+    for (i = (int) MIN(nPlies, MAX_FILTER_PLIES) - 1; i >= 0; i--) {
+        if (amf[i].Accept < 0)
+            continue;
+
+        if (amf[i].Extra > 0) {
+            amf[i].Extra = 0;
+            return TRUE;
+        }
+
+        if (amf[i].Accept > 1) {
+            amf[i].Accept--;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+extern unsigned int
+PlanMoveSearch(unsigned int cMoves, const evalcontext * pec, movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES],
+               double rSeconds, movefilter aamfPlan[MAX_FILTER_PLIES][MAX_FILTER_PLIES])
+{
+    double rEvals = rSeconds * EvalRate();
+    unsigned int n;
+
+    memcpy(aamfPlan, aamf, sizeof(movefilter) * MAX_FILTER_PLIES * MAX_FILTER_PLIES);
+
+    for (n = pec->nPlies; n > 0; n--) {
+        movefilter *amf = aamfPlan[MIN(n, MAX_FILTER_PLIES) - 1];
+
+        do {
+            if (AnytimeCost(cMoves, n, aamfPlan, pec->fUsePrune) <= rEvals)
+                return n;
+        } while (NarrowFilters(amf, n));
+    }
+
+    return 0;
+}
+
+extern unsigned int
+PlanCubePlies(const evalcontext * pec, double rSeconds)
+{
+    double rEvals = rSeconds * EvalRate();
+    unsigned int n;
+
+    for (n = pec->nPlies; n > 0; n--)
+        if (EvalCost(n, pec->fUsePrune) <= rEvals)
+            break;
+
+    return n;
+}
+
+extern int
+FindBestMovesBudget(movelist * pml, int nDice0, int nDice1, const TanBoard anBoard,
+                    const cubeinfo * pci, const evalcontext * pec,
+                    movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES], double rSeconds)
+{
+    movefilter aamfPlan[MAX_FILTER_PLIES][MAX_FILTER_PLIES];
+    evalcontext ec;
+    movelist ml;
+    double rStart = get_time(), rPredicted;
+    int nPlies;
+
+    memcpy(&ec, pec, sizeof(ec));
+    ec.nPlies = PlanMoveSearch(GenerateMoves(&ml, anBoard, nDice0, nDice1, FALSE), pec, aamf, rSeconds, aamfPlan);
+    rPredicted = AnytimeCost(ml.cMoves, ec.nPlies, aamfPlan, ec.fUsePrune) / EvalRate();
+
+    /* the plan is a prediction, the deadline is the limit */
+    nPlies = FindBestMovesAnytime(pml, nDice0, nDice1, anBoard, pci, &ec, aamfPlan,
+                                  rStart + rSeconds * 1000.0, NULL, NULL);
+
+    /* learn from searches that ran as planned and long enough to time */
+    if (nPlies > 0 && (unsigned int) nPlies == ec.nPlies && rPredicted > 0.05) {
+        double rRatio = (get_time() - rStart) / 1000.0 / rPredicted;
+
+        MT_Exclusive();
+        rCostScale = CLAMP(rCostScale * (0.8 + 0.2 * rRatio), 0.05, 20.0);
+        MT_Release();
+    }
+
+    return nPlies;
+}
+
+extern int
+CubeDecisionBudget(float aarOutput[2][NUM_ROLLOUT_OUTPUTS], const TanBoard anBoard,
+                   cubeinfo * pci, evalcontext * pec, double rSeconds)
+{
+    double rDeadline = get_time() + rSeconds * 1000.0;
+    int n;
+
+    pec->nPlies = PlanCubePlies(pec, rSeconds);
+
+    EvalSetDeadline(pec->nPlies ? rDeadline : 0.0);
+    n = GeneralCubeDecisionE(aarOutput, anBoard, pci, pec, NULL);
+    EvalSetDeadline(0.0);
+
+    if (n < 0 && pec->nPlies && !fInterrupt) {
+        /* out of time; a static look is better than none */
+        pec->nPlies = 0;
+        n = GeneralCubeDecisionE(aarOutput, anBoard, pci, pec, NULL);
+    }
+
+    return n;
+}
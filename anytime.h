@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+#ifndef ANYTIME_H
+#define ANYTIME_H
+
+#include "eval.h"
+
+/* Move rankings that deepen until a deadline.
+ *
+ * The moves are ranked at 0-ply first, then at 1-ply, 2-ply and so on up
+ * to the plies of the evaluation context, each level with the move
+ * filters for its depth. Every completed level replaces the previous one
+ * and is published. Levels after 0-ply are abandoned when the deadline
+ * passes, so there always is a result and it is the deepest level that
+ * was completed in time. */
+
+/* Called with every completed level; pml belongs to the caller */
+typedef void (*anytimefunc) (unsigned int nPlies, const movelist * pml, void *p);
+
+/* Ranks the moves into pml on the calling thread, calling pf (if not
+ * NULL) on the same thread. rDeadline is a get_time() value, 0 for none.
+ * Returns the plies of the deepest completed level, -1 on errors or if
+ * interrupted. */
+extern int FindBestMovesAnytime(movelist * pml, int nDice0, int nDice1, const TanBoard anBoard,
+                                const cubeinfo * pci, const evalcontext * pec,
+                                movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES], double rDeadline,
+                                anytimefunc pf, void *p);
+
+/* As FindBestMovesAnytime, but ranks the moves on the thread pool with
+ * a time limit of rSeconds and calls pf on the main thread while the
+ * deeper levels are being worked on */
+extern int RunAnytime(movelist * pml, int nDice0, int nDice1, const TanBoard anBoard,
+                      const cubeinfo * pci, const evalcontext * pec,
+                      movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES], double rSeconds,
+                      anytimefunc pf, void *p);
+
+/* Decisions within a time budget.
+ *
+ * The cost of a search is predicted in static evaluations (an n-ply
+ * evaluation rolls the 21 dice and looks (n-1)-ply deeper for each) and
+ * converted to time with the speed measured by "calibrate". The deepest
+ * plies, up to those of the evaluation context, whose prediction fits the
+ * budget are chosen, narrowing the move filters where that helps; the
+ * prediction is corrected from the time the searches actually take. The
+ * budget is also enforced as a deadline, so a bad prediction costs depth
+ * rather than time. */
+
+/* Seconds per bot decision ("set timebudget"), 0 for fixed settings */
+extern float rTimeBudget;
+
+/* The plies for cMoves candidate moves within rSeconds, no deeper than
+ * pec; aamfPlan gets the filters to use with them */
+extern unsigned int PlanMoveSearch(unsigned int cMoves, const evalcontext * pec,
+                                   movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES], double rSeconds,
+                                   movefilter aamfPlan[MAX_FILTER_PLIES][MAX_FILTER_PLIES]);
+
+/* The plies for a cube decision within rSeconds, no deeper than pec */
+extern unsigned int PlanCubePlies(const evalcontext * pec, double rSeconds);
+
+/* As FindBestMovesAnytime, with the plies and filters planned for
+ * rSeconds and the deadline at rSeconds */
+extern int FindBestMovesBudget(movelist * pml, int nDice0, int nDice1, const TanBoard anBoard,
+                               const cubeinfo * pci, const evalcontext * pec,
+                               movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES], double rSeconds);
+
+/* As GeneralCubeDecisionE within rSeconds, falling back to 0-ply when the
+ * planned plies do not finish in time. pec->nPlies is set to the plies
+ * used. */
+extern int CubeDecisionBudget(float aarOutput[2][NUM_ROLLOUT_OUTPUTS], const TanBoard anBoard,
+                              cubeinfo * pci, evalcontext * pec, double rSeconds);
+
+#endif
@@ -258,6 +258,7 @@ typedef void (*AsyncFun) (void *);
 void asyncDumpDecision(decisionData * pdd);
 void asyncFindBestMoves(findData * pfd);
 void asyncFindMove(findData * pfd);
+void asyncFindMoveBudget(findData * pfd);
 void asyncScoreMove(scoreData * psd);
 void asyncEvalRoll(decisionData * pdd);
 void asyncAnalyzeMove(moveData * pmd);
@@ -265,6 +266,7 @@ void asyncGammonRates(decisionData * pdd);
 void asyncMoveDecisionE(decisionData * pdd);
 void asyncCubeDecisionE(decisionData * pdd);
 void asyncCubeDecision(decisionData * pdd);
+void asyncCubeDecisionBudget(decisionData * pdd);
 int RunAsyncProcess(AsyncFun fun, void *data, const char *msg);
 
 /* There is a global storedmoves struct to maintain the list of moves
@@ -538,8 +540,10 @@ extern void CommandAnnotateUnlucky(char *);
 extern void CommandAnnotateVeryBad(char *);
 extern void CommandAnnotateVeryLucky(char *);
 extern void CommandAnnotateVeryUnlucky(char *);
+extern void CommandBenchmark(char *);
 extern void CommandCalibrate(char *);
 extern void CommandClearCache(char *);
+extern void CommandClearEngine(char *);
 extern void CommandClearHint(char *);
 extern void CommandClearTurn(char *);
 extern void CommandCMarkCubeSetNone(char *);
@@ -561,6 +565,7 @@ extern void CommandDrop(char *);
 extern void CommandEndGame(char *);
 extern void CommandEq2MWC(char *);
 extern void CommandEval(char *);
+extern void CommandExportDataset(char *);
 extern void CommandExportGameGam(char *);
 extern void CommandExportGameSnowieTxt(char *);
 extern void CommandExportGameHtml(char *);
@@ -604,6 +609,7 @@ extern void CommandImportSnowieTxt(char *);
 extern void CommandImportTMG(char *);
 extern void CommandListGame(char *);
 extern void CommandListMatch(char *);
+extern void CommandLoadBinary(char *);
 extern void CommandLoadCommands(char *);
 extern void CommandLoadGame(char *);
 extern void CommandLoadMatch(char *);
@@ -632,10 +638,14 @@ extern void CommandRelationalTest(char *);
 extern void CommandResign(char *);
 extern void CommandRoll(char *);
 extern void CommandRollout(char *);
+extern void CommandRolloutWorker(char *);
+extern void CommandSaveBinary(char *);
 extern void CommandSaveGame(char *);
 extern void CommandSaveMatch(char *);
 extern void CommandSavePosition(char *);
 extern void CommandSaveSettings(char *);
+extern void CommandSaveSnapshot(char *);
+extern void CommandSelfPlay(char *);
 extern void CommandSetAnalysisChequerplay(char *);
 extern void CommandSetAnalysisCube(char *);
 extern void CommandSetAnalysisCubedecision(char *);
@@ -872,6 +882,7 @@ extern void CommandSetRolloutTruncationEnable(char *);
 extern void CommandSetRolloutTruncationEqualPlayer0(char *);
 extern void CommandSetRolloutTruncationPlies(char *);
 extern void CommandSetRolloutVarRedn(char *);
+extern void CommandSetRolloutWorkers(char *);
 extern void CommandSetScore(char *);
 extern void CommandSetSeed(char *);
 extern void CommandSetSGFFolder(char *);
@@ -898,6 +909,7 @@ extern void CommandSetSoundSystemCommand(char *);
 extern void CommandSetStyledGameList(char *);
 extern void CommandSetTheoryWindow(char *);
 extern void CommandSetThreads(char *);
+extern void CommandSetTimeBudget(char *);
 extern void CommandSetToolbar(char *);
 extern void CommandSetTurn(char *);
 extern void CommandSetTutorChequer(char *);
@@ -970,6 +982,7 @@ extern void CommandShowScore(char *);
 extern void CommandShowScoreSheet(char *);
 extern void CommandShowSeed(char *);
 extern void CommandShowSound(char *);
+extern void CommandShowStatisticsEngine(char *);
 extern void CommandShowStatisticsGame(char *);
 extern void CommandShowStatisticsMatch(char *);
 extern void CommandShowStatisticsSession(char *);
@@ -977,6 +990,7 @@ extern void CommandShowTemperatureMap(char *);
 extern void CommandShowScoreMap(char *);
 extern void CommandShowThorp(char *);
 extern void CommandShowThreads(char *);
+extern void CommandShowTimeBudget(char *);
 extern void CommandShowTurn(char *);
 extern void CommandShowTutor(char *);
 extern void CommandShowVariation(char *);
@@ -985,6 +999,7 @@ extern void CommandShowWarning(char *);
 extern void CommandShowWarranty(char *);
 extern void CommandSwapPlayers(char *);
 extern void CommandTake(char *);
+extern void CommandTuneFilters(char *);
 extern void CommandSetDefaultNames(char *sz);
 extern void CommandSetAliases(char *sz);
 extern void hint_move(char *sz, gboolean show, procrecorddata * procdatarec);
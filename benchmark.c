@@ -0,0 +1,494 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* The "benchmark" suite.
+ *
+ * Every item of the suite runs a fixed number of operations on a fixed
+ * set of positions, first on one thread and then, for the items that can,
+ * on all threads of the pool. For each item the results are
+ *
+ *   name ops ops/s p50 p90 p99 ops/s(threads) speedup
+ *
+ * with the latencies of one operation in microseconds (timed in batches
+ * for the fast items). Lines starting with '#' are comments.
+ *
+ * The positions are taken from games played with random moves and a
+ * fixed seed, so that they do not depend on the neural nets. The items
+ * that evaluate run without the evaluation cache, as calibrate does, as
+ * they would otherwise mostly time cache lookups of the same positions;
+ * the bearoff item reads a different position for every operation. Whenever
+ * the positions, items or numbers of operations change, BENCHMARK_VERSION
+ * must be increased, as the results are only comparable within a
+ * version. */
+
+#include "config.h"
+
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "backgammon.h"
+#include "bearoff.h"
+#include "multithread.h"
+#include "positionid.h"
+#include "sgf.h"
+#include "lib/simd.h"
+
+#define BENCHMARK_VERSION 2
+
+/* positions per class */
+#define BENCH_POSITIONS 64
+
+enum { BENCH_CONTACT, BENCH_RACE, BENCH_BEAROFF, BENCH_CLASSES };
+
+static TanBoard aaanBench[BENCH_CLASSES][BENCH_POSITIONS];
+static int acBench[BENCH_CLASSES];
+
+static rolloutcontext rcBench;
+static char *szBenchSGF;
+
+typedef struct benchitem {
+    const char *szName;
+    int (*pfOp) (const struct benchitem *, int i);
+    int iClass;
+    int nPlies;
+    int nOps;
+    int nBatch;                 /* operations timed together */
+    int fParallel;              /* may run on several threads */
+} benchitem;
+
+static guint32 nBenchRandom;
+
+static unsigned int
+BenchRandom(void)
+{
+    nBenchRandom = nBenchRandom * 1103515245u + 12345u;
+    return (nBenchRandom >> 16) & 0x7fff;
+}
+
+static void
+BenchPositions(void)
+{
+    int iGame;
+
+    nBenchRandom = 20260101;
+    memset(acBench, 0, sizeof(acBench));
+
+    for (iGame = 0; iGame < 1000 &&
+         (acBench[BENCH_CONTACT] < BENCH_POSITIONS || acBench[BENCH_RACE] < BENCH_POSITIONS ||
+          acBench[BENCH_BEAROFF] < BENCH_POSITIONS); iGame++) {
+        TanBoard anBoard;
+        positionclass pc;
+
+        InitBoard(anBoard, VARIATION_STANDARD);
+
+        while ((pc = ClassifyPosition((ConstTanBoard) anBoard, VARIATION_STANDARD)) != CLASS_OVER) {
+            movelist ml;
+            int i;
+
+            if (pc >= CLASS_CRASHED)
+                i = BENCH_CONTACT;
+            else if (pc == CLASS_RACE)
+                i = BENCH_RACE;
+            else if (pc == CLASS_BEAROFF1 || pc == CLASS_BEAROFF2)
+                i = BENCH_BEAROFF;
+            else
+                i = -1;
+
+            /* take every fourth position or so, to spread them over the games */
+            if (i >= 0 && acBench[i] < BENCH_POSITIONS && !(BenchRandom() & 3))
+                memcpy(aaanBench[i][acBench[i]++], anBoard, sizeof(TanBoard));
+
+            if (GenerateMoves(&ml, (ConstTanBoard) anBoard, (int) (BenchRandom() % 6) + 1,
+                              (int) (BenchRandom() % 6) + 1, FALSE))
+                PositionFromKey(anBoard, &ml.amMoves[BenchRandom() % ml.cMoves].key);
+
+            SwapSides(anBoard);
+        }
+    }
+}
+
+static ConstTanBoard
+BenchBoard(int iClass, int i)
+{
+    return (ConstTanBoard) aaanBench[iClass][i % acBench[iClass]];
+}
+
+static int
+BenchEval(const benchitem * pbi, int i)
+{
+    evalcontext ec = { FALSE, 0, TRUE, TRUE, 0.0f };
+    SSE_ALIGN(float ar[NUM_OUTPUTS]);
+
+    ec.nPlies = pbi->nPlies;
+
+    return EvaluatePosition(NULL, BenchBoard(pbi->iClass, i), ar, &ciCubeless, &ec);
+}
+
+static int
+BenchMoves(const benchitem * pbi, int i)
+{
+    movelist ml;
+    int n0, n1, iRoll = i % 21;
+
+    /* the 21 different rolls in turn */
+    for (n0 = 1; iRoll >= 7 - n0; n0++)
+        iRoll -= 7 - n0;
+    n1 = n0 + iRoll;
+
+    (void) GenerateMoves(&ml, BenchBoard(pbi->iClass, i / 21), n0, n1, FALSE);
+
+    return 0;
+}
+
+static int
+BenchCube(const benchitem * pbi, int i)
+{
+    evalcontext ec = { TRUE, 0, TRUE, TRUE, 0.0f };
+    float aarOutput[2][NUM_ROLLOUT_OUTPUTS];
+    int anScore[2] = { 0, 0 };
+    cubeinfo ci;
+
+    ec.nPlies = pbi->nPlies;
+    SetCubeInfo(&ci, 1, -1, 0, 0, anScore, FALSE, FALSE, 0, VARIATION_STANDARD);
+
+    return GeneralCubeDecisionE(aarOutput, BenchBoard(pbi->iClass, i), &ci, &ec, NULL) < 0 ? -1 : 0;
+}
+
+static int
+BenchRollout(const benchitem * pbi, int i)
+{
+    TanBoard anBoard;
+    float aar[1][NUM_ROLLOUT_OUTPUTS];
+    int anScore[2] = { 0, 0 }, fCubeDecTop = TRUE, n;
+    cubeinfo ci;
+    perArray dicePerms;
+    rngcontext *rngctx = CopyRNGContext(rngctxRollout);
+
+    /* all trials roll out the same position */
+    memcpy(anBoard, BenchBoard(pbi->iClass, 0), sizeof(TanBoard));
+    SetCubeInfo(&ci, 1, -1, 0, 0, anScore, FALSE, FALSE, 0, VARIATION_STANDARD);
+    dicePerms.nPermutationSeed = -1;
+    InitRNGSeed((unsigned int) (rcBench.nSeed + ((unsigned int) i << 8)), rcBench.rngRollout, rngctx);
+
+    n = BasicCubefulRollout(&anBoard, aar, 0, i, &ci, &fCubeDecTop, 1, &rcBench, NULL, 1, &dicePerms, rngctx, NULL);
+
+    g_free(rngctx);
+
+    return n;
+}
+
+static int
+BenchBearoff(const benchitem * UNUSED(pbi), int i)
+{
+    /* the one and two sided databases in turn, with positions spread
+     * over all of the database (index 0 has no chequers left) */
+    const bearoffcontext *pbc = i & 1 ? pbc2 : pbc1;
+    unsigned int n = Combination(pbc->nPoints + pbc->nChequers, pbc->nPoints) - 1;
+    TanBoard anBoard;
+    float ar[NUM_ROLLOUT_OUTPUTS];
+
+    memset(anBoard, 0, sizeof(anBoard));
+    PositionFromBearoff(anBoard[0], 1 + (unsigned int) i % n, pbc->nPoints, pbc->nChequers);
+    PositionFromBearoff(anBoard[1], 1 + (unsigned int) i * 7919u % n, pbc->nPoints, pbc->nChequers);
+
+    return BearoffEval(pbc, (ConstTanBoard) anBoard, ar);
+}
+
+static int
+BenchSaveSGF(const benchitem * UNUSED(pbi), int UNUSED(i))
+{
+    FILE *pf;
+    listOLD *pl;
+
+    if (!(pf = g_fopen(szBenchSGF, "w")))
+        return -1;
+
+    for (pl = lMatch.plNext; pl != &lMatch; pl = pl->plNext)
+        SaveGame(pf, pl->p);
+
+    return fclose(pf) ? -1 : 0;
+}
+
+static int
+BenchLoadSGF(const benchitem * UNUSED(pbi), int UNUSED(i))
+{
+    FILE *pf;
+    listOLD *pl;
+
+    if (!(pf = g_fopen(szBenchSGF, "r")))
+        return -1;
+
+    pl = SGFParse(pf);
+    fclose(pf);
+
+    if (!pl)
+        return -1;
+
+    SGFFree(pl);
+
+    return 0;
+}
+
+static const benchitem abi[] = {
+    {"eval0-contact", BenchEval, BENCH_CONTACT, 0, 20000, 100, TRUE},
+    {"eval0-race", BenchEval, BENCH_RACE, 0, 20000, 100, TRUE},
+    {"eval0-bearoff", BenchEval, BENCH_BEAROFF, 0, 20000, 100, TRUE},
+    {"eval1-contact", BenchEval, BENCH_CONTACT, 1, 1000, 10, TRUE},
+    {"eval1-race", BenchEval, BENCH_RACE, 1, 1000, 10, TRUE},
+    {"eval2-contact", BenchEval, BENCH_CONTACT, 2, 64, 1, TRUE},
+    {"eval2-race", BenchEval, BENCH_RACE, 2, 64, 1, TRUE},
+    {"eval3-contact", BenchEval, BENCH_CONTACT, 3, 8, 1, TRUE},
+    {"movegen", BenchMoves, BENCH_CONTACT, 0, 21 * BENCH_POSITIONS, 21, TRUE},
+    {"cube2-contact", BenchCube, BENCH_CONTACT, 2, 64, 1, TRUE},
+    {"rollout", BenchRollout, BENCH_CONTACT, 0, 648, 1, TRUE},
+    {"bearoff", BenchBearoff, BENCH_BEAROFF, 0, 100000, 1000, TRUE},
+    {"sgf-save", BenchSaveSGF, 0, 0, 10, 1, FALSE},
+    {"sgf-load", BenchLoadSGF, 0, 0, 10, 1, FALSE}
+};
+
+#define BENCH_ITEMS (sizeof(abi) / sizeof(abi[0]))
+
+static int
+BenchNoCache(const benchitem * pbi)
+{
+    return pbi->pfOp == BenchEval || pbi->pfOp == BenchCube;
+}
+
+typedef struct {
+    int fSkipped;
+    int nOps;
+    double rOpsPerSec;
+    double arLatency[3];        /* p50, p90 and p99 */
+    double rOpsPerSecThreads;
+} benchresult;
+
+static int
+CompareDouble(gconstpointer p0, gconstpointer p1)
+{
+    double r0 = *(const double *) p0, r1 = *(const double *) p1;
+
+    return r0 < r1 ? -1 : r0 > r1;
+}
+
+static int
+BenchSingle(const benchitem * pbi, benchresult * pbr)
+{
+    GArray *pa = g_array_new(FALSE, FALSE, sizeof(double));
+    double t0 = get_time(), t;
+    int i, j, fError = FALSE;
+
+    for (i = 0; i < pbi->nOps && !fInterrupt && !fError; i += pbi->nBatch) {
+        int n = MIN(pbi->nBatch, pbi->nOps - i);
+        double r;
+
+        t = get_time();
+        for (j = 0; j < n; j++)
+            if (pbi->pfOp(pbi, i + j) < 0)
+                fError = TRUE;
+
+        r = (get_time() - t) * 1000.0 / n;
+        g_array_append_val(pa, r);
+    }
+
+    t = get_time() - t0;
+    pbr->nOps = MIN(i, pbi->nOps);
+    pbr->rOpsPerSec = t > 0.0 ? pbr->nOps * 1000.0 / t : 0.0;
+
+    if (pa->len) {
+        static const double arPercentile[3] = { 0.5, 0.9, 0.99 };
+
+        g_array_sort(pa, CompareDouble);
+        for (j = 0; j < 3; j++)
+            pbr->arLatency[j] = g_array_index(pa, double, (guint) (arPercentile[j] * (pa->len - 1) + 0.5));
+    }
+
+    g_array_free(pa, TRUE);
+
+    return fError ? -1 : 0;
+}
+
+#if defined(USE_MULTITHREAD)
+
+static const benchitem *pbiParallel;
+static int nParallelOps, iParallelOp, fParallelError;
+
+static void
+BenchTask(void *UNUSED(unused))
+{
+    int i;
+
+    while ((i = MT_SafeIncValue(&iParallelOp) - 1) < nParallelOps && !fInterrupt)
+        if (pbiParallel->pfOp(pbiParallel, i) < 0)
+            fParallelError = TRUE;
+}
+
+/* Runs the operations of an item for each thread, all threads at once */
+
+static int
+BenchParallel(const benchitem * pbi, benchresult * pbr)
+{
+    unsigned int nThreads = MT_GetNumThreads();
+    double t;
+
+    pbiParallel = pbi;
+    nParallelOps = pbi->nOps * (int) nThreads;
+    iParallelOp = 0;
+    fParallelError = FALSE;
+
+    t = get_time();
+    mt_add_tasks(nThreads, BenchTask, NULL, NULL);
+    (void) MT_WaitForTasks(NULL, 0, FALSE);
+    t = get_time() - t;
+
+    pbr->rOpsPerSecThreads = t > 0.0 ? MIN(iParallelOp, nParallelOps) * 1000.0 / t : 0.0;
+
+    return fParallelError ? -1 : 0;
+}
+
+#endif
+
+extern void
+CommandBenchmark(char *sz)
+{
+    benchresult abr[BENCH_ITEMS];
+    unsigned int i, nThreads = MT_GetNumThreads(), cCacheSize = GetEvalCacheEntries();
+    GString *gs;
+
+    sz = NextToken(&sz);
+
+    BenchPositions();
+
+    memcpy(&rcBench, &rcRollout, sizeof(rcBench));
+    rcBench.fCubeful = rcBench.fVarRedn = TRUE;
+    rcBench.fInitial = rcBench.fRotate = rcBench.fLateEvals = FALSE;
+    rcBench.fTruncBearoff2 = rcBench.fTruncBearoffOS = FALSE;
+    rcBench.fDoTruncate = TRUE;
+    rcBench.nTruncate = 7;
+    rcBench.aecChequer[0].nPlies = rcBench.aecChequer[1].nPlies = 0;
+    rcBench.aecCube[0].nPlies = rcBench.aecCube[1].nPlies = 0;
+    rcBench.aecChequer[0].fCubeful = rcBench.aecChequer[1].fCubeful = TRUE;
+    rcBench.aecCube[0].fCubeful = rcBench.aecCube[1].fCubeful = TRUE;
+    rcBench.rngRollout = RNG_MERSENNE;
+    rcBench.nSeed = 1;
+
+    szBenchSGF = g_build_filename(g_get_tmp_dir(), "gnubg-benchmark.sgf", NULL);
+
+    memset(abr, 0, sizeof(abr));
+
+#if defined(USE_MULTITHREAD)
+    MT_SetNumThreads(1);
+#endif
+
+    for (i = 0; i < BENCH_ITEMS && !fInterrupt; i++) {
+        const benchitem *pbi = abi + i;
+
+        if (pbi->pfOp == BenchBearoff && (!pbc1 || !pbc2))
+            abr[i].fSkipped = TRUE;
+        else if ((pbi->pfOp == BenchSaveSGF || pbi->pfOp == BenchLoadSGF) &&
+                 lMatch.plNext == &lMatch)
+            /* there is no match to save */
+            abr[i].fSkipped = TRUE;
+        else if (!acBench[pbi->iClass])
+            abr[i].fSkipped = TRUE;
+
+        if (abr[i].fSkipped)
+            continue;
+
+        if (fShowProgress) {
+            outputf("\r%-40s", pbi->szName);
+            fflush(stdout);
+        }
+
+        EvalCacheResize(BenchNoCache(pbi) ? 0 : cCacheSize);
+        EvalCacheFlush();
+        if (BenchSingle(pbi, abr + i) < 0) {
+            outputf(_("\nThe benchmark failed at %s.\n"), pbi->szName);
+            break;
+        }
+    }
+
+#if defined(USE_MULTITHREAD)
+    MT_SetNumThreads(nThreads);
+
+    if (nThreads > 1)
+        for (i = 0; i < BENCH_ITEMS && !fInterrupt; i++)
+            if (!abr[i].fSkipped && abr[i].nOps && abi[i].fParallel) {
+                if (fShowProgress) {
+                    outputf("\r%-40s", abi[i].szName);
+                    fflush(stdout);
+                }
+
+                EvalCacheResize(BenchNoCache(abi + i) ? 0 : cCacheSize);
+                EvalCacheFlush();
+                if (BenchParallel(abi + i, abr + i) < 0) {
+                    outputf(_("\nThe benchmark failed at %s.\n"), abi[i].szName);
+                    break;
+                }
+            }
+#endif
+
+    EvalCacheResize(cCacheSize);
+
+    if (fShowProgress)
+        outputf("\r%-40s\r", "");
+
+    g_unlink(szBenchSGF);
+    g_free(szBenchSGF);
+    szBenchSGF = NULL;
+
+    if (fInterrupt)
+        return;
+
+    gs = g_string_new(NULL);
+    g_string_append_printf(gs, "# gnubg benchmark %d, GNU Backgammon %s, %s, %u thread(s)\n",
+                           BENCHMARK_VERSION, VERSION, WEIGHTS_VERSION, nThreads);
+    g_string_append(gs, "# item            ops        ops/s   p50(us)   p90(us)   p99(us) ops/s(threads) speedup\n");
+
+    for (i = 0; i < BENCH_ITEMS; i++) {
+        const benchresult *pbr = abr + i;
+
+        if (pbr->fSkipped || !pbr->nOps) {
+            g_string_append_printf(gs, "%-16s skipped\n", abi[i].szName);
+            continue;
+        }
+
+        g_string_append_printf(gs, "%-16s %6d %12.1f %9.2f %9.2f %9.2f", abi[i].szName, pbr->nOps,
+                               pbr->rOpsPerSec, pbr->arLatency[0], pbr->arLatency[1], pbr->arLatency[2]);
+
+        if (pbr->rOpsPerSecThreads > 0.0 && pbr->rOpsPerSec > 0.0)
+            g_string_append_printf(gs, " %14.1f %7.2f\n", pbr->rOpsPerSecThreads,
+                                   pbr->rOpsPerSecThreads / pbr->rOpsPerSec);
+        else
+            g_string_append(gs, "              -       -\n");
+    }
+
+    output(gs->str);
+
+    if (sz && *sz) {
+        if (!g_file_set_contents(sz, gs->str, (gssize) gs->len, NULL))
+            outputerr(sz);
+        else
+            outputf(_("Results written to %s.\n"), sz);
+    }
+
+    g_string_free(gs, TRUE);
+}
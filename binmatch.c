@@ -0,0 +1,1145 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* Binary match files, see binmatch.h for the layout */
+
+#include "config.h"
+
+#include <glib.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "backgammon.h"
+#include "analysis.h"
+#include "binmatch.h"
+#include "positionid.h"
+#if USE_GTK
+#include "gtkgame.h"
+#endif
+
+#define BINMATCH_NULL_STRING G_MAXUINT32
+
+/*
+ * Writing
+ */
+
+static void
+PutU32(GByteArray * pba, guint32 n)
+{
+    guint32 nLE = GUINT32_TO_LE(n);
+
+    g_byte_array_append(pba, (const guint8 *) &nLE, sizeof(nLE));
+}
+
+static void
+PutInt(GByteArray * pba, int n)
+{
+    PutU32(pba, (guint32) n);
+}
+
+static void
+PutInts(GByteArray * pba, const int *an, unsigned int n)
+{
+    while (n--)
+        PutInt(pba, *an++);
+}
+
+static void
+PutFloat(GByteArray * pba, float r)
+{
+    guint32 n;
+
+    memcpy(&n, &r, sizeof(n));
+    PutU32(pba, n);
+}
+
+static void
+PutFloats(GByteArray * pba, const float *ar, unsigned int n)
+{
+    while (n--)
+        PutFloat(pba, *ar++);
+}
+
+static void
+PutString(GByteArray * pba, const char *sz)
+{
+    if (!sz)
+        PutU32(pba, BINMATCH_NULL_STRING);
+    else {
+        guint32 cch = (guint32) strlen(sz);
+
+        PutU32(pba, cch);
+        g_byte_array_append(pba, (const guint8 *) sz, cch);
+    }
+}
+
+/* Returns the offset of the payload, for EndRecord */
+
+static guint
+BeginRecord(GByteArray * pba, binmatchtag bmt)
+{
+    PutU32(pba, bmt);
+    PutU32(pba, 0);
+
+    return pba->len;
+}
+
+static void
+EndRecord(GByteArray * pba, guint iPayload)
+{
+    guint32 nLE = GUINT32_TO_LE(pba->len - iPayload);
+
+    memcpy(pba->data + iPayload - sizeof(nLE), &nLE, sizeof(nLE));
+}
+
+static void
+PutEvalContext(GByteArray * pba, const evalcontext * pec)
+{
+    PutU32(pba, pec->fCubeful);
+    PutU32(pba, pec->nPlies);
+    PutU32(pba, pec->fUsePrune);
+    PutU32(pba, pec->fDeterministic);
+    PutFloat(pba, pec->rNoise);
+}
+
+static void
+PutMoveFilters(GByteArray * pba, const movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES])
+{
+    int i, j;
+
+    for (i = 0; i < MAX_FILTER_PLIES; i++)
+        for (j = 0; j < MAX_FILTER_PLIES; j++) {
+            PutInt(pba, aamf[i][j].Accept);
+            PutInt(pba, aamf[i][j].Extra);
+            PutFloat(pba, aamf[i][j].Threshold);
+        }
+}
+
+static void
+PutRolloutContext(GByteArray * pba, const rolloutcontext * prc)
+{
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        PutEvalContext(pba, &prc->aecCube[i]);
+        PutEvalContext(pba, &prc->aecChequer[i]);
+        PutEvalContext(pba, &prc->aecCubeLate[i]);
+        PutEvalContext(pba, &prc->aecChequerLate[i]);
+        PutMoveFilters(pba, prc->aaamfChequer[i]);
+        PutMoveFilters(pba, prc->aaamfLate[i]);
+    }
+    PutEvalContext(pba, &prc->aecCubeTrunc);
+    PutEvalContext(pba, &prc->aecChequerTrunc);
+
+    PutU32(pba, prc->fCubeful | prc->fVarRedn << 1 | prc->fInitial << 2
+           | prc->fRotate << 3 | prc->fTruncBearoff2 << 4 | prc->fTruncBearoffOS << 5
+           | prc->fLateEvals << 6 | prc->fDoTruncate << 7 | prc->fStopOnSTD << 8
+           | prc->fStopOnJsd << 9 | prc->fStopMoveOnJsd << 10);
+
+    PutU32(pba, prc->nTruncate);
+    PutU32(pba, prc->nTrials);
+    PutU32(pba, prc->nLate);
+    PutU32(pba, prc->rngRollout);
+    /* 64 bits */
+    PutU32(pba, (guint32) prc->nSeed);
+    PutU32(pba, (guint32) ((guint64) prc->nSeed >> 32));
+    PutU32(pba, prc->nMinimumGames);
+    PutFloat(pba, prc->rStdLimit);
+    PutU32(pba, prc->nMinimumJsdGames);
+    PutFloat(pba, prc->rJsdLimit);
+    PutU32(pba, prc->nGamesDone);
+    PutFloat(pba, prc->rStoppedOnJSD);
+    PutInt(pba, prc->nSkip);
+}
+
+/* Only what the evaluation type uses is saved */
+
+static void
+PutEvalSetup(GByteArray * pba, const evalsetup * pes)
+{
+    PutU32(pba, pes->et);
+
+    if (pes->et != EVAL_NONE)
+        PutEvalContext(pba, &pes->ec);
+
+    if (pes->et == EVAL_ROLLOUT)
+        PutRolloutContext(pba, &pes->rc);
+}
+
+static void
+PutStatContext(GByteArray * pba, const statcontext * psc)
+{
+    int i;
+
+    PutInt(pba, psc->fMoves);
+    PutInt(pba, psc->fCube);
+    PutInt(pba, psc->fDice);
+
+    PutInts(pba, psc->anUnforcedMoves, 2);
+    PutInts(pba, psc->anTotalMoves, 2);
+    PutInts(pba, psc->anTotalCube, 2);
+    PutInts(pba, psc->anCloseCube, 2);
+    PutInts(pba, psc->anDouble, 2);
+    PutInts(pba, psc->anTake, 2);
+    PutInts(pba, psc->anPass, 2);
+
+    for (i = 0; i < 2; i++) {
+        PutInts(pba, psc->anMoves[i], N_SKILLS);
+        PutInts(pba, psc->anLuck[i], N_LUCKS);
+    }
+
+    PutInts(pba, psc->anCubeMissedDoubleDP, 2);
+    PutInts(pba, psc->anCubeMissedDoubleTG, 2);
+    PutInts(pba, psc->anCubeWrongDoubleDP, 2);
+    PutInts(pba, psc->anCubeWrongDoubleTG, 2);
+    PutInts(pba, psc->anCubeWrongTake, 2);
+    PutInts(pba, psc->anCubeWrongPass, 2);
+
+    PutFloats(pba, &psc->arErrorCheckerplay[0][0], 4);
+    PutFloats(pba, &psc->arErrorMissedDoubleDP[0][0], 4);
+    PutFloats(pba, &psc->arErrorMissedDoubleTG[0][0], 4);
+    PutFloats(pba, &psc->arErrorWrongDoubleDP[0][0], 4);
+    PutFloats(pba, &psc->arErrorWrongDoubleTG[0][0], 4);
+    PutFloats(pba, &psc->arErrorWrongTake[0][0], 4);
+    PutFloats(pba, &psc->arErrorWrongPass[0][0], 4);
+    PutFloats(pba, &psc->arLuck[0][0], 4);
+
+    PutFloats(pba, psc->arActualResult, 2);
+    PutFloats(pba, psc->arLuckAdj, 2);
+    PutFloats(pba, psc->arVarianceActual, 2);
+    PutFloats(pba, psc->arVarianceLuckAdj, 2);
+    PutInt(pba, psc->nGames);
+}
+
+static void
+PutCubeDecision(GByteArray * pba, const cubedecisiondata * pcdd)
+{
+    PutFloats(pba, &pcdd->aarOutput[0][0], 2 * NUM_ROLLOUT_OUTPUTS);
+    PutFloats(pba, &pcdd->aarStdDev[0][0], 2 * NUM_ROLLOUT_OUTPUTS);
+    PutEvalSetup(pba, &pcdd->esDouble);
+    PutU32(pba, pcdd->cmark);
+}
+
+static void
+PutMoveList(GByteArray * pba, const movelist * pml)
+{
+    unsigned int i;
+
+    PutU32(pba, pml->cMoves);
+    PutU32(pba, pml->cMaxMoves);
+    PutU32(pba, pml->cMaxPips);
+    PutInt(pba, pml->iMoveBest);
+    PutFloat(pba, pml->rBestScore);
+
+    for (i = 0; i < pml->cMoves; i++) {
+        const move *pm = &pml->amMoves[i];
+        int j;
+
+        PutInts(pba, pm->anMove, 8);
+        for (j = 0; j < 7; j++)
+            PutU32(pba, pm->key.data[j]);
+        PutU32(pba, pm->cMoves);
+        PutU32(pba, pm->cPips);
+        PutFloat(pba, pm->rScore);
+        PutFloat(pba, pm->rScore2);
+        PutFloats(pba, pm->arEvalMove, NUM_ROLLOUT_OUTPUTS);
+        PutFloats(pba, pm->arEvalStdDev, NUM_ROLLOUT_OUTPUTS);
+        PutEvalSetup(pba, &pm->esMove);
+        PutU32(pba, pm->cmark);
+    }
+}
+
+static void
+PutGameInfo(GByteArray * pba, const moverecord * pmr)
+{
+    const xmovegameinfo *pmgi = &pmr->g;
+
+    PutString(pba, pmr->sz);
+    PutInt(pba, pmgi->i);
+    PutInt(pba, pmgi->nMatch);
+    PutInts(pba, pmgi->anScore, 2);
+    PutInt(pba, pmgi->fCrawford);
+    PutInt(pba, pmgi->fCrawfordGame);
+    PutInt(pba, pmgi->fJacoby);
+    PutInt(pba, pmgi->fWinner);
+    PutInt(pba, pmgi->nPoints);
+    PutInt(pba, pmgi->fResigned);
+    PutInt(pba, pmgi->nAutoDoubles);
+    PutU32(pba, pmgi->bgv);
+    PutInt(pba, pmgi->fCubeUse);
+    PutStatContext(pba, &pmgi->sc);
+}
+
+static void
+PutMoveRecord(GByteArray * pba, const moverecord * pmr)
+{
+    /* take and drop records share the analysis of their double */
+    int fOwnCube = pmr->CubeDecPtr == &pmr->CubeDec;
+
+    PutU32(pba, pmr->mt);
+    PutString(pba, pmr->sz);
+    PutInt(pba, pmr->fPlayer);
+    PutU32(pba, pmr->anDice[0]);
+    PutU32(pba, pmr->anDice[1]);
+    PutU32(pba, pmr->lt);
+    PutFloat(pba, pmr->rLuck);
+    PutEvalSetup(pba, &pmr->esChequer);
+    PutMoveList(pba, &pmr->ml);
+    PutInt(pba, pmr->nAnimals);
+    PutInt(pba, fOwnCube);
+    if (fOwnCube)
+        PutCubeDecision(pba, &pmr->CubeDec);
+    PutU32(pba, pmr->stCube);
+
+    switch (pmr->mt) {
+    case MOVE_NORMAL:
+        PutInts(pba, pmr->n.anMove, 8);
+        PutU32(pba, pmr->n.iMove);
+        PutU32(pba, pmr->n.stMove);
+        break;
+
+    case MOVE_RESIGN:
+        PutInt(pba, pmr->r.nResigned);
+        PutEvalSetup(pba, &pmr->r.esResign);
+        PutFloats(pba, pmr->r.arResign, NUM_ROLLOUT_OUTPUTS);
+        PutU32(pba, pmr->r.stResign);
+        PutU32(pba, pmr->r.stAccept);
+        break;
+
+    case MOVE_SETBOARD:
+        {
+            int j;
+
+            for (j = 0; j < 7; j++)
+                PutU32(pba, pmr->sb.key.data[j]);
+        }
+        break;
+
+    case MOVE_SETCUBEVAL:
+        PutInt(pba, pmr->scv.nCube);
+        break;
+
+    case MOVE_SETCUBEPOS:
+        PutInt(pba, pmr->scp.fCubeOwner);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void
+PutMatchInfo(GByteArray * pba)
+{
+    PutString(pba, ap[0].szName);
+    PutString(pba, ap[1].szName);
+    PutString(pba, mi.pchRating[0]);
+    PutString(pba, mi.pchRating[1]);
+    PutString(pba, mi.pchEvent);
+    PutString(pba, mi.pchRound);
+    PutString(pba, mi.pchPlace);
+    PutString(pba, mi.pchAnnotator);
+    PutString(pba, mi.pchComment);
+    PutU32(pba, mi.nYear);
+    PutU32(pba, mi.nMonth);
+    PutU32(pba, mi.nDay);
+}
+
+/* The records of a game, skipping and completing the same records as
+ * SaveGame() in sgf.c so that both formats hold the same match. */
+
+static void
+PutGame(GByteArray * pba, listOLD * plGame)
+{
+    listOLD *pl, *pl_hint = NULL;
+    moverecord *pmr;
+    guint iRecord;
+    int fMoveNormalSeen = FALSE;
+
+    updateStatisticsGame(plGame);
+
+    pl = plGame->plNext;
+    pmr = pl->p;
+    g_assert(pmr->mt == MOVE_GAMEINFO);
+
+    iRecord = BeginRecord(pba, BINMATCH_GAME);
+    PutGameInfo(pba, pmr);
+    EndRecord(pba, iRecord);
+
+    if (game_is_last(plGame))
+        pl_hint = game_add_pmr_hint(plGame);
+
+    for (pl = pl->plNext; pl != plGame; pl = pl->plNext) {
+        pmr = pl->p;
+
+        if (pmr->mt == MOVE_NORMAL) {
+            fMoveNormalSeen = TRUE;
+            /* sanitise the move if from a hint record */
+            if (pmr->ml.cMoves && pmr->n.iMove >= pmr->ml.cMoves) {
+                memcpy(pmr->n.anMove, pmr->ml.amMoves[0].anMove, sizeof(pmr->n.anMove));
+                pmr->n.iMove = 0;
+            }
+        } else if (pmr->mt == MOVE_DOUBLE && pl->plNext == plGame
+                   && !(fMoveNormalSeen == FALSE && pmr->CubeDecPtr->esDouble.et != EVAL_NONE))
+            /* placeholder for hint data, see SaveGame() */
+            continue;
+
+        iRecord = BeginRecord(pba, BINMATCH_MOVE);
+        PutMoveRecord(pba, pmr);
+        EndRecord(pba, iRecord);
+    }
+
+    if (pl_hint)
+        game_remove_pmr_hint(pl_hint);
+}
+
+/*
+ * Reading
+ */
+
+typedef struct {
+    const guint8 *p;
+    const guint8 *pEnd;
+    int fError;                 /* read past the end of the record */
+} binreader;
+
+static guint32
+GetU32(binreader * pbr)
+{
+    guint32 nLE;
+
+    if (pbr->pEnd - pbr->p < (ptrdiff_t) sizeof(nLE)) {
+        pbr->fError = TRUE;
+        pbr->p = pbr->pEnd;
+        return 0;
+    }
+
+    memcpy(&nLE, pbr->p, sizeof(nLE));
+    pbr->p += sizeof(nLE);
+
+    return GUINT32_FROM_LE(nLE);
+}
+
+static int
+GetInt(binreader * pbr)
+{
+    return (int) GetU32(pbr);
+}
+
+/* Read an enumerated value; values from 0 to n-1 are valid, anything
+ * else marks the record as damaged and gives nDefault */
+
+static guint32
+GetEnum(binreader * pbr, guint32 n, guint32 nDefault)
+{
+    guint32 i = GetU32(pbr);
+
+    if (i >= n) {
+        pbr->fError = TRUE;
+        return nDefault;
+    }
+
+    return i;
+}
+
+static void
+GetInts(binreader * pbr, int *an, unsigned int n)
+{
+    while (n--)
+        *an++ = GetInt(pbr);
+}
+
+static float
+GetFloat(binreader * pbr)
+{
+    guint32 n = GetU32(pbr);
+    float r;
+
+    memcpy(&r, &n, sizeof(r));
+
+    return r;
+}
+
+static void
+GetFloats(binreader * pbr, float *ar, unsigned int n)
+{
+    while (n--)
+        *ar++ = GetFloat(pbr);
+}
+
+static char *
+GetString(binreader * pbr)
+{
+    guint32 cch = GetU32(pbr);
+    char *sz;
+
+    if (cch == BINMATCH_NULL_STRING || pbr->fError)
+        return NULL;
+
+    if ((guint32) (pbr->pEnd - pbr->p) < cch) {
+        pbr->fError = TRUE;
+        pbr->p = pbr->pEnd;
+        return NULL;
+    }
+
+    sz = g_strndup((const char *) pbr->p, cch);
+    pbr->p += cch;
+
+    return sz;
+}
+
+static void
+GetEvalContext(binreader * pbr, evalcontext * pec)
+{
+    guint32 nPlies;
+
+    pec->fCubeful = GetU32(pbr) & 1;
+    if ((nPlies = GetU32(pbr)) > MAX_PLIES) {
+        pbr->fError = TRUE;
+        nPlies = 0;
+    }
+    pec->nPlies = nPlies;
+    pec->fUsePrune = GetU32(pbr) & 1;
+    pec->fDeterministic = GetU32(pbr) & 1;
+    pec->rNoise = GetFloat(pbr);
+}
+
+static void
+GetMoveFilters(binreader * pbr, movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES])
+{
+    int i, j;
+
+    for (i = 0; i < MAX_FILTER_PLIES; i++)
+        for (j = 0; j < MAX_FILTER_PLIES; j++) {
+            aamf[i][j].Accept = GetInt(pbr);
+            aamf[i][j].Extra = GetInt(pbr);
+            aamf[i][j].Threshold = GetFloat(pbr);
+        }
+}
+
+static void
+GetRolloutContext(binreader * pbr, rolloutcontext * prc)
+{
+    guint32 nFlags;
+    guint64 nSeed;
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        GetEvalContext(pbr, &prc->aecCube[i]);
+        GetEvalContext(pbr, &prc->aecChequer[i]);
+        GetEvalContext(pbr, &prc->aecCubeLate[i]);
+        GetEvalContext(pbr, &prc->aecChequerLate[i]);
+        GetMoveFilters(pbr, prc->aaamfChequer[i]);
+        GetMoveFilters(pbr, prc->aaamfLate[i]);
+    }
+    GetEvalContext(pbr, &prc->aecCubeTrunc);
+    GetEvalContext(pbr, &prc->aecChequerTrunc);
+
+    nFlags = GetU32(pbr);
+    prc->fCubeful = nFlags & 1;
+    prc->fVarRedn = (nFlags >> 1) & 1;
+    prc->fInitial = (nFlags >> 2) & 1;
+    prc->fRotate = (nFlags >> 3) & 1;
+    prc->fTruncBearoff2 = (nFlags >> 4) & 1;
+    prc->fTruncBearoffOS = (nFlags >> 5) & 1;
+    prc->fLateEvals = (nFlags >> 6) & 1;
+    prc->fDoTruncate = (nFlags >> 7) & 1;
+    prc->fStopOnSTD = (nFlags >> 8) & 1;
+    prc->fStopOnJsd = (nFlags >> 9) & 1;
+    prc->fStopMoveOnJsd = (nFlags >> 10) & 1;
+
+    prc->nTruncate = (unsigned short) GetU32(pbr);
+    prc->nTrials = GetU32(pbr);
+    prc->nLate = (unsigned short) GetU32(pbr);
+    prc->rngRollout = (rng) GetEnum(pbr, NUM_RNGS, RNG_MERSENNE);
+    nSeed = GetU32(pbr);
+    nSeed |= (guint64) GetU32(pbr) << 32;
+    prc->nSeed = (unsigned long) nSeed;
+    prc->nMinimumGames = GetU32(pbr);
+    prc->rStdLimit = GetFloat(pbr);
+    prc->nMinimumJsdGames = GetU32(pbr);
+    prc->rJsdLimit = GetFloat(pbr);
+    prc->nGamesDone = GetU32(pbr);
+    prc->rStoppedOnJSD = GetFloat(pbr);
+    prc->nSkip = GetInt(pbr);
+}
+
+static void
+GetEvalSetup(binreader * pbr, evalsetup * pes)
+{
+    pes->et = (evaltype) GetU32(pbr);
+
+    if (pes->et > EVAL_ROLLOUT) {
+        pbr->fError = TRUE;
+        pes->et = EVAL_NONE;
+        return;
+    }
+
+    if (pes->et != EVAL_NONE)
+        GetEvalContext(pbr, &pes->ec);
+
+    if (pes->et == EVAL_ROLLOUT)
+        GetRolloutContext(pbr, &pes->rc);
+}
+
+static void
+GetStatContext(binreader * pbr, statcontext * psc)
+{
+    int i;
+
+    psc->fMoves = GetInt(pbr);
+    psc->fCube = GetInt(pbr);
+    psc->fDice = GetInt(pbr);
+
+    GetInts(pbr, psc->anUnforcedMoves, 2);
+    GetInts(pbr, psc->anTotalMoves, 2);
+    GetInts(pbr, psc->anTotalCube, 2);
+    GetInts(pbr, psc->anCloseCube, 2);
+    GetInts(pbr, psc->anDouble, 2);
+    GetInts(pbr, psc->anTake, 2);
+    GetInts(pbr, psc->anPass, 2);
+
+    for (i = 0; i < 2; i++) {
+        GetInts(pbr, psc->anMoves[i], N_SKILLS);
+        GetInts(pbr, psc->anLuck[i], N_LUCKS);
+    }
+
+    GetInts(pbr, psc->anCubeMissedDoubleDP, 2);
+    GetInts(pbr, psc->anCubeMissedDoubleTG, 2);
+    GetInts(pbr, psc->anCubeWrongDoubleDP, 2);
+    GetInts(pbr, psc->anCubeWrongDoubleTG, 2);
+    GetInts(pbr, psc->anCubeWrongTake, 2);
+    GetInts(pbr, psc->anCubeWrongPass, 2);
+
+    GetFloats(pbr, &psc->arErrorCheckerplay[0][0], 4);
+    GetFloats(pbr, &psc->arErrorMissedDoubleDP[0][0], 4);
+    GetFloats(pbr, &psc->arErrorMissedDoubleTG[0][0], 4);
+    GetFloats(pbr, &psc->arErrorWrongDoubleDP[0][0], 4);
+    GetFloats(pbr, &psc->arErrorWrongDoubleTG[0][0], 4);
+    GetFloats(pbr, &psc->arErrorWrongTake[0][0], 4);
+    GetFloats(pbr, &psc->arErrorWrongPass[0][0], 4);
+    GetFloats(pbr, &psc->arLuck[0][0], 4);
+
+    GetFloats(pbr, psc->arActualResult, 2);
+    GetFloats(pbr, psc->arLuckAdj, 2);
+    GetFloats(pbr, psc->arVarianceActual, 2);
+    GetFloats(pbr, psc->arVarianceLuckAdj, 2);
+    psc->nGames = GetInt(pbr);
+}
+
+static void
+GetCubeDecision(binreader * pbr, cubedecisiondata * pcdd)
+{
+    GetFloats(pbr, &pcdd->aarOutput[0][0], 2 * NUM_ROLLOUT_OUTPUTS);
+    GetFloats(pbr, &pcdd->aarStdDev[0][0], 2 * NUM_ROLLOUT_OUTPUTS);
+    GetEvalSetup(pbr, &pcdd->esDouble);
+    pcdd->cmark = (CMark) GetEnum(pbr, CMARK_ROLLOUT + 1, CMARK_NONE);
+}
+
+static void
+GetMoveList(binreader * pbr, movelist * pml)
+{
+    unsigned int i, cMoves;
+
+    cMoves = GetU32(pbr);
+    pml->cMaxMoves = GetU32(pbr);
+    pml->cMaxPips = GetU32(pbr);
+    pml->iMoveBest = GetInt(pbr);
+    pml->rBestScore = GetFloat(pbr);
+
+    /* each move takes more than 64 bytes: don't trust a count the
+     * record is too short for */
+    if (pbr->fError || cMoves > (size_t) (pbr->pEnd - pbr->p) / 64) {
+        pbr->fError = TRUE;
+        cMoves = 0;
+    }
+
+    pml->cMoves = cMoves;
+    pml->amMoves = cMoves ? g_new0(move, cMoves) : NULL;
+
+    for (i = 0; i < cMoves; i++) {
+        move *pm = &pml->amMoves[i];
+        int j;
+
+        GetInts(pbr, pm->anMove, 8);
+        for (j = 0; j < 7; j++)
+            pm->key.data[j] = GetU32(pbr);
+        pm->cMoves = GetU32(pbr);
+        pm->cPips = GetU32(pbr);
+        pm->rScore = GetFloat(pbr);
+        pm->rScore2 = GetFloat(pbr);
+        GetFloats(pbr, pm->arEvalMove, NUM_ROLLOUT_OUTPUTS);
+        GetFloats(pbr, pm->arEvalStdDev, NUM_ROLLOUT_OUTPUTS);
+        GetEvalSetup(pbr, &pm->esMove);
+        pm->cmark = (CMark) GetEnum(pbr, CMARK_ROLLOUT + 1, CMARK_NONE);
+    }
+}
+
+static void
+GetGameInfo(binreader * pbr, moverecord * pmr)
+{
+    xmovegameinfo *pmgi = &pmr->g;
+
+    pmr->mt = MOVE_GAMEINFO;
+    pmr->sz = GetString(pbr);
+    pmgi->i = GetInt(pbr);
+    pmgi->nMatch = GetInt(pbr);
+    GetInts(pbr, pmgi->anScore, 2);
+    pmgi->fCrawford = GetInt(pbr);
+    pmgi->fCrawfordGame = GetInt(pbr);
+    pmgi->fJacoby = GetInt(pbr);
+    pmgi->fWinner = GetInt(pbr);
+    pmgi->nPoints = GetInt(pbr);
+    pmgi->fResigned = GetInt(pbr);
+    pmgi->nAutoDoubles = GetInt(pbr);
+    pmgi->bgv = (bgvariation) GetU32(pbr);
+    pmgi->fCubeUse = GetInt(pbr);
+    GetStatContext(pbr, &pmgi->sc);
+
+    if (pmgi->bgv >= NUM_VARIATIONS) {
+        pbr->fError = TRUE;
+        pmgi->bgv = VARIATION_STANDARD;
+    }
+}
+
+/* Returns whether the record has its own cube analysis */
+
+static int
+GetMoveRecord(binreader * pbr, moverecord * pmr)
+{
+    int fOwnCube;
+    int i;
+
+    pmr->mt = (movetype) GetU32(pbr);
+    pmr->sz = GetString(pbr);
+    pmr->fPlayer = GetInt(pbr);
+    pmr->anDice[0] = GetU32(pbr);
+    pmr->anDice[1] = GetU32(pbr);
+    pmr->lt = (lucktype) GetEnum(pbr, N_LUCKS, LUCK_NONE);
+    pmr->rLuck = GetFloat(pbr);
+    GetEvalSetup(pbr, &pmr->esChequer);
+    GetMoveList(pbr, &pmr->ml);
+    pmr->nAnimals = GetInt(pbr);
+    fOwnCube = GetInt(pbr);
+    if (fOwnCube)
+        GetCubeDecision(pbr, &pmr->CubeDec);
+    pmr->stCube = (skilltype) GetEnum(pbr, N_SKILLS, SKILL_NONE);
+
+    if (pmr->fPlayer < 0 || pmr->fPlayer > 1)
+        pbr->fError = TRUE;
+
+    /* only rolls carry dice; the other records have none */
+    for (i = 0; i < 2; i++)
+        if (pmr->anDice[i] > 6
+            || (pmr->anDice[i] < 1 && (pmr->mt == MOVE_NORMAL || pmr->mt == MOVE_SETDICE)))
+            pbr->fError = TRUE;
+
+    switch (pmr->mt) {
+    case MOVE_NORMAL:
+        GetInts(pbr, pmr->n.anMove, 8);
+        pmr->n.iMove = GetU32(pbr);
+        pmr->n.stMove = (skilltype) GetEnum(pbr, N_SKILLS, SKILL_NONE);
+
+        for (i = 0; i < 8; i++)
+            if (pmr->n.anMove[i] < -1 || pmr->n.anMove[i] > 24)
+                pbr->fError = TRUE;
+
+        /* a move without a move list has no index into it */
+        if (!pmr->ml.cMoves)
+            pmr->n.iMove = UINT_MAX;
+        else if (pmr->n.iMove >= pmr->ml.cMoves)
+            pbr->fError = TRUE;
+        break;
+
+    case MOVE_RESIGN:
+        pmr->r.nResigned = GetInt(pbr);
+        GetEvalSetup(pbr, &pmr->r.esResign);
+        GetFloats(pbr, pmr->r.arResign, NUM_ROLLOUT_OUTPUTS);
+        pmr->r.stResign = (skilltype) GetEnum(pbr, N_SKILLS, SKILL_NONE);
+        pmr->r.stAccept = (skilltype) GetEnum(pbr, N_SKILLS, SKILL_NONE);
+
+        if (pmr->r.nResigned < 1 || pmr->r.nResigned > 3)
+            pbr->fError = TRUE;
+        break;
+
+    case MOVE_SETBOARD:
+        {
+            TanBoard anBoard;
+            int j;
+
+            for (j = 0; j < 7; j++)
+                pmr->sb.key.data[j] = GetU32(pbr);
+
+            PositionFromKey(anBoard, &pmr->sb.key);
+            if (!CheckPosition((ConstTanBoard) anBoard))
+                pbr->fError = TRUE;
+        }
+        break;
+
+    case MOVE_SETCUBEVAL:
+        pmr->scv.nCube = GetInt(pbr);
+        break;
+
+    case MOVE_SETCUBEPOS:
+        pmr->scp.fCubeOwner = GetInt(pbr);
+        break;
+
+    case MOVE_DOUBLE:
+    case MOVE_TAKE:
+    case MOVE_DROP:
+    case MOVE_SETDICE:
+        break;
+
+    default:
+        /* including MOVE_GAMEINFO, which has a record of its own */
+        pbr->fError = TRUE;
+        break;
+    }
+
+    return fOwnCube;
+}
+
+static void
+GetMatchInfo(binreader * pbr, char *aszName[2], matchinfo * pmi)
+{
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        g_free(aszName[i]);
+        aszName[i] = GetString(pbr);
+    }
+
+    for (i = 0; i < 2; i++) {
+        g_free(pmi->pchRating[i]);
+        pmi->pchRating[i] = GetString(pbr);
+    }
+    g_free(pmi->pchEvent);
+    pmi->pchEvent = GetString(pbr);
+    g_free(pmi->pchRound);
+    pmi->pchRound = GetString(pbr);
+    g_free(pmi->pchPlace);
+    pmi->pchPlace = GetString(pbr);
+    g_free(pmi->pchAnnotator);
+    pmi->pchAnnotator = GetString(pbr);
+    g_free(pmi->pchComment);
+    pmi->pchComment = GetString(pbr);
+    pmi->nYear = GetU32(pbr);
+    pmi->nMonth = GetU32(pbr);
+    pmi->nDay = GetU32(pbr);
+}
+
+/* As RestoreGame() in sgf.c */
+
+static void
+StartGame(moverecord * pmr)
+{
+    InitBoard(ms.anBoard, ms.bgv);
+
+    ClearMoveRecord();
+
+    ListInsert(&lMatch, plGame);
+
+    ms.anDice[0] = ms.anDice[1] = 0;
+    ms.fResigned = ms.fDoubled = FALSE;
+    ms.nCube = 1;
+    ms.fTurn = ms.fMove = ms.fCubeOwner = -1;
+    ms.gs = GAME_NONE;
+
+    AddMoveRecord(pmr);
+}
+
+/* A decoded record; fOwnCube as returned by GetMoveRecord() */
+
+typedef struct {
+    moverecord *pmr;
+    int fOwnCube;
+} binrecord;
+
+/* The contents of a file, decoded without touching the current match */
+
+typedef struct {
+    GArray *pa;                 /* of binrecord */
+    char *aszName[2];
+    matchinfo mi;
+} binmatch;
+
+static void
+FreeRecord(moverecord * pmr)
+{
+    g_free(pmr->ml.amMoves);
+    g_free(pmr->sz);
+    g_free(pmr);
+}
+
+static void
+FreeBinMatch(binmatch * pbm)
+{
+    guint i;
+
+    for (i = 0; i < pbm->pa->len; i++)
+        FreeRecord(g_array_index(pbm->pa, binrecord, i).pmr);
+    g_array_free(pbm->pa, TRUE);
+
+    for (i = 0; i < 2; i++) {
+        g_free(pbm->aszName[i]);
+        g_free(pbm->mi.pchRating[i]);
+    }
+    g_free(pbm->mi.pchEvent);
+    g_free(pbm->mi.pchRound);
+    g_free(pbm->mi.pchPlace);
+    g_free(pbm->mi.pchAnnotator);
+    g_free(pbm->mi.pchComment);
+}
+
+/* Decode all records of pch into pbm. Returns the number of games, or -1
+ * if the file is damaged. */
+
+static int
+DecodeRecords(const gchar * pch, gsize cb, binmatch * pbm)
+{
+    binreader br = { (const guint8 *) pch, (const guint8 *) pch + cb, FALSE };
+    int nGames = 0;
+
+    while (br.p < br.pEnd) {
+        binmatchtag bmt = (binmatchtag) GetU32(&br);
+        guint32 cbRecord = GetU32(&br);
+        binreader brRecord;
+        binrecord rec;
+
+        if (br.fError || (guint32) (br.pEnd - br.p) < cbRecord)
+            return -1;
+
+        brRecord.p = br.p;
+        brRecord.pEnd = br.p + cbRecord;
+        brRecord.fError = FALSE;
+        br.p += cbRecord;
+
+        switch (bmt) {
+        case BINMATCH_MATCHINFO:
+            GetMatchInfo(&brRecord, pbm->aszName, &pbm->mi);
+            break;
+
+        case BINMATCH_GAME:
+            rec.pmr = NewMoveRecord();
+            rec.fOwnCube = FALSE;
+            GetGameInfo(&brRecord, rec.pmr);
+            g_array_append_val(pbm->pa, rec);
+            nGames++;
+            break;
+
+        case BINMATCH_MOVE:
+            if (!nGames)
+                return -1;
+
+            rec.pmr = NewMoveRecord();
+            rec.fOwnCube = GetMoveRecord(&brRecord, rec.pmr);
+            g_array_append_val(pbm->pa, rec);
+            break;
+
+        default:
+            /* from a later version */
+            break;
+        }
+
+        if (brRecord.fError)
+            return -1;
+    }
+
+    return nGames;
+}
+
+/* Replay the decoded records into the (cleared) match; they now belong
+ * to it */
+
+static void
+RestoreRecords(binmatch * pbm)
+{
+    moverecord *pmrGame = NULL;
+    guint i;
+
+    for (i = 0; i < pbm->pa->len; i++) {
+        binrecord *prec = &g_array_index(pbm->pa, binrecord, i);
+        moverecord *pmr = prec->pmr;
+
+        if (pmr->mt == MOVE_GAMEINFO) {
+            if (pmrGame)
+                AddGame(pmrGame);
+
+            StartGame(pmr);
+            pmrGame = pmr;
+            continue;
+        }
+
+        if (!prec->fOwnCube && (pmr->mt == MOVE_DOUBLE || pmr->mt == MOVE_TAKE || pmr->mt == MOVE_DROP))
+            LinkToDouble(pmr);
+
+        AddMoveRecord(pmr);
+    }
+
+    if (pmrGame)
+        AddGame(pmrGame);
+
+    g_array_set_size(pbm->pa, 0);
+}
+
+extern void
+CommandLoadBinary(char *sz)
+{
+    gchar *pch;
+    gsize cb;
+    GError *error = NULL;
+    guint32 nVersion;
+    binmatch bm;
+    int i, nGames;
+
+    sz = NextToken(&sz);
+
+    if (!sz || !*sz) {
+        outputl(_("You must specify a file to load from (see `help load " "binary')."));
+        return;
+    }
+
+    if (!g_file_get_contents(sz, &pch, &cb, &error)) {
+        outputerrf("%s: %s", sz, error->message);
+        g_error_free(error);
+        return;
+    }
+
+    if (cb < sizeof(BINMATCH_MAGIC) + 4 || memcmp(pch, BINMATCH_MAGIC, sizeof(BINMATCH_MAGIC))) {
+        outputerrf(_("%s: not a binary match file"), sz);
+        g_free(pch);
+        return;
+    }
+
+    /* only the layout of BINMATCH_VERSION can be read */
+    memcpy(&nVersion, pch + sizeof(BINMATCH_MAGIC), sizeof(nVersion));
+    nVersion = GUINT32_FROM_LE(nVersion);
+    if (nVersion != BINMATCH_VERSION) {
+        if (nVersion > BINMATCH_VERSION)
+            outputerrf(_("%s: made by a later version of GNU Backgammon"), sz);
+        else
+            outputerrf(_("%s: unknown binary match file version %u"), sz, nVersion);
+        g_free(pch);
+        return;
+    }
+
+    /* the current match is only replaced once the whole file is read */
+    memset(&bm, 0, sizeof(bm));
+    bm.pa = g_array_new(FALSE, FALSE, sizeof(binrecord));
+
+    nGames = DecodeRecords(pch + sizeof(BINMATCH_MAGIC) + 4, cb - sizeof(BINMATCH_MAGIC) - 4, &bm);
+
+    g_free(pch);
+
+    if (nGames <= 0) {
+        if (nGames < 0)
+            outputerrf(_("%s: damaged binary match file"), sz);
+        else
+            outputerrf(_("%s: no games in binary match file"), sz);
+        FreeBinMatch(&bm);
+        return;
+    }
+
+    if (!get_input_discard()) {
+        FreeBinMatch(&bm);
+        return;
+    }
+#if USE_GTK
+    if (fX) {                   /* Clear record to avoid ugly updates */
+        GTKClearMoveRecord();
+        GTKFreeze();
+    }
+#endif
+
+    FreeMatch();
+    ClearMatch();
+
+    for (i = 0; i < 2; i++)
+        if (bm.aszName[i])
+            g_strlcpy(ap[i].szName, bm.aszName[i], sizeof(ap[i].szName));
+    mi = bm.mi;
+    memset(&bm.mi, 0, sizeof(bm.mi));
+
+    RestoreRecords(&bm);
+    FreeBinMatch(&bm);
+
+    UpdateSettings();
+
+#if USE_GTK
+    if (fX) {
+        GTKThaw();
+        GTKSet(ap);
+    }
+#endif
+
+    setDefaultFileName(sz);
+
+    if (fGotoFirstGame)
+        CommandFirstGame(NULL);
+}
+
+extern void
+CommandSaveBinary(char *sz)
+{
+    GByteArray *pba;
+    GError *error = NULL;
+    listOLD *pl;
+    guint iRecord;
+
+    sz = NextToken(&sz);
+
+    if (!plGame) {
+        outputl(_("No game in progress (type `new game' to start one)."));
+        return;
+    }
+
+    if (!sz || !*sz) {
+        outputl(_("You must specify a file to save to (see `help save " "binary')."));
+        return;
+    }
+
+    if (!confirmOverwrite(sz, fConfirmSave))
+        return;
+
+    pba = g_byte_array_sized_new(1 << 16);
+
+    g_byte_array_append(pba, (const guint8 *) BINMATCH_MAGIC, sizeof(BINMATCH_MAGIC));
+    PutU32(pba, BINMATCH_VERSION);
+
+    iRecord = BeginRecord(pba, BINMATCH_MATCHINFO);
+    PutMatchInfo(pba);
+    EndRecord(pba, iRecord);
+
+    for (pl = lMatch.plNext; pl != &lMatch; pl = pl->plNext)
+        PutGame(pba, pl->p);
+
+    if (!g_file_set_contents(sz, (const gchar *) pba->data, pba->len, &error)) {
+        outputerrf("%s: %s", sz, error->message);
+        g_error_free(error);
+        g_byte_array_free(pba, TRUE);
+        return;
+    }
+
+    g_byte_array_free(pba, TRUE);
+
+    setDefaultFileName(sz);
+
+    delete_autosave();
+}
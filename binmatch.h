@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+#ifndef BINMATCH_H
+#define BINMATCH_H
+
+/* Binary match files.
+ *
+ * An alternative to SGF for analysed matches: the analysis is stored as
+ * it is held in memory, so files load and save without formatting or
+ * parsing floats.
+ *
+ * The file starts with the 8 bytes BINMATCH_MAGIC and a version number,
+ * followed by records. A record is a tag, the length of its payload and
+ * the payload. All numbers are little endian, 32 bits unless stated
+ * otherwise. Readers skip records with unknown tags. */
+
+#define BINMATCH_MAGIC "GNUBGBM"
+#define BINMATCH_VERSION 1
+
+typedef enum {
+    BINMATCH_MATCHINFO = 1,     /* player names and match information */
+    BINMATCH_GAME,              /* game information record, starts a game */
+    BINMATCH_MOVE               /* any other move record of the game */
+} binmatchtag;
+
+#endif
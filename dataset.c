@@ -0,0 +1,348 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* Position datasets, see dataset.h for the layout */
+
+#include "config.h"
+
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(HAVE_SYS_TYPES_H)
+#include <sys/types.h>
+#endif
+
+#include "backgammon.h"
+#include "dataset.h"
+#include "positionid.h"
+
+static float
+FloatToLE(float r)
+{
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+    guint32 n;
+
+    memcpy(&n, &r, sizeof(n));
+    n = GUINT32_SWAP_LE_BE(n);
+    memcpy(&r, &n, sizeof(r));
+#endif
+    return r;
+}
+
+static void
+PutOutputs(float arDest[7], const float arSrc[NUM_ROLLOUT_OUTPUTS])
+{
+    int i;
+
+    for (i = 0; i < NUM_ROLLOUT_OUTPUTS; i++)
+        arDest[i] = FloatToLE(arSrc[i]);
+}
+
+static void
+PutMove(int8_t anDest[8], const int anMove[8])
+{
+    int i;
+
+    for (i = 0; i < 8; i++)
+        anDest[i] = (int8_t) anMove[i];
+}
+
+static void
+PutEvalSetup(datasetrecord * pdr, const evalsetup * pes)
+{
+    pdr->et = (uint8_t) pes->et;
+
+    switch (pes->et) {
+    case EVAL_EVAL:
+        pdr->nPlies = (uint8_t) pes->ec.nPlies;
+        pdr->fCubeful = (uint8_t) pes->ec.fCubeful;
+        break;
+    case EVAL_ROLLOUT:
+        pdr->nPlies = (uint8_t) pes->rc.aecChequer[0].nPlies;
+        pdr->fCubeful = (uint8_t) pes->rc.fCubeful;
+        break;
+    default:
+        break;
+    }
+}
+
+/* Fills in the fields common to all decisions from the match state */
+
+static void
+PutState(datasetrecord * pdr, const matchstate * pms, datasettype dt, int fPlayer, guint32 iMatch, int iGame,
+         int iDecision)
+{
+    positionkey key;
+    int i, n;
+
+    memset(pdr, 0, sizeof(*pdr));
+
+    PositionKey((ConstTanBoard) pms->anBoard, &key);
+    for (i = 0; i < 7; i++)
+        pdr->anKey[i] = GUINT32_TO_LE(key.data[i]);
+
+    pdr->iMatch = GUINT32_TO_LE(iMatch);
+    pdr->iGame = GUINT16_TO_LE((uint16_t) iGame);
+    pdr->iDecision = GUINT16_TO_LE((uint16_t) iDecision);
+    pdr->iRank = GUINT16_TO_LE(DATASET_NO_RANK);
+    pdr->nMatchTo = GUINT16_TO_LE((uint16_t) pms->nMatchTo);
+    pdr->anScore[0] = GUINT16_TO_LE((uint16_t) pms->anScore[pms->fMove]);
+    pdr->anScore[1] = GUINT16_TO_LE((uint16_t) pms->anScore[!pms->fMove]);
+    memset(pdr->anMove, -1, sizeof(pdr->anMove));
+    memset(pdr->anBest, -1, sizeof(pdr->anBest));
+
+    pdr->dt = (uint8_t) dt;
+    pdr->fPlayer = (uint8_t) fPlayer;
+
+    for (n = pms->nCube; n > 1; n >>= 1)
+        pdr->nLogCube++;
+
+    if (pms->fCubeOwner < 0)
+        pdr->fCubeOwner = -1;
+    else
+        pdr->fCubeOwner = pms->fCubeOwner != pms->fMove;
+
+    if (pms->fCrawford)
+        pdr->fFlags |= DATASET_CRAWFORD;
+    if (pms->fPostCrawford)
+        pdr->fFlags |= DATASET_POSTCRAWFORD;
+    if (pms->fJacoby)
+        pdr->fFlags |= DATASET_JACOBY;
+    if (pms->fCubeUse)
+        pdr->fFlags |= DATASET_CUBEUSE;
+
+    pdr->bgv = (uint8_t) pms->bgv;
+    pdr->et = EVAL_NONE;
+}
+
+static void
+AddCubeDecision(GArray * pa, const matchstate * pms, const moverecord * pmr, datasettype dt, guint32 iMatch,
+                int iGame, int iDecision)
+{
+    datasetrecord dr;
+    const cubedecisiondata *pcdd = pmr->CubeDecPtr;
+
+    PutState(&dr, pms, dt, pmr->fPlayer, iMatch, iGame, iDecision);
+
+    if (pcdd && pcdd->esDouble.et != EVAL_NONE) {
+        PutOutputs(dr.arPlayed, pcdd->aarOutput[0]);
+        PutOutputs(dr.arBest, pcdd->aarOutput[1]);
+        PutEvalSetup(&dr, &pcdd->esDouble);
+    }
+
+    g_array_append_val(pa, dr);
+}
+
+static void
+AddMove(GArray * pa, const matchstate * pms, const moverecord * pmr, guint32 iMatch, int iGame, int iDecision)
+{
+    datasetrecord dr;
+    const movelist *pml = &pmr->ml;
+
+    PutState(&dr, pms, DATASET_MOVE, pmr->fPlayer, iMatch, iGame, iDecision);
+
+    dr.anDice[0] = (uint8_t) pmr->anDice[0];
+    dr.anDice[1] = (uint8_t) pmr->anDice[1];
+    PutMove(dr.anMove, pmr->n.anMove);
+
+    if (pml->cMoves && pmr->n.iMove < pml->cMoves) {
+        dr.iRank = GUINT16_TO_LE((uint16_t) MIN(pmr->n.iMove, DATASET_NO_RANK - 1));
+        PutOutputs(dr.arPlayed, pml->amMoves[pmr->n.iMove].arEvalMove);
+        PutOutputs(dr.arBest, pml->amMoves[0].arEvalMove);
+        PutMove(dr.anBest, pml->amMoves[0].anMove);
+        PutEvalSetup(&dr, &pml->amMoves[0].esMove);
+    }
+
+    g_array_append_val(pa, dr);
+}
+
+/* Appends a record for every decision of the game to pa */
+
+static void
+AddGameDecisions(GArray * pa, const listOLD * plGame, guint32 iMatch, int iGame)
+{
+    const listOLD *pl;
+    matchstate msExport;
+    int iDecision = 0;
+
+    memset(&msExport, 0, sizeof(msExport));
+
+    for (pl = plGame->plNext; pl != plGame; pl = pl->plNext) {
+        const moverecord *pmr = pl->p;
+
+        FixMatchState(&msExport, pmr);
+
+        switch (pmr->mt) {
+        case MOVE_NORMAL:
+            if (pmr->fPlayer != msExport.fMove) {
+                SwapSides(msExport.anBoard);
+                msExport.fMove = pmr->fPlayer;
+            }
+
+            if (pmr->CubeDecPtr && pmr->CubeDecPtr->esDouble.et != EVAL_NONE)
+                AddCubeDecision(pa, &msExport, pmr, DATASET_NODOUBLE, iMatch, iGame, iDecision++);
+
+            AddMove(pa, &msExport, pmr, iMatch, iGame, iDecision++);
+            break;
+
+        case MOVE_DOUBLE:
+            AddCubeDecision(pa, &msExport, pmr, DATASET_DOUBLE, iMatch, iGame, iDecision++);
+            break;
+
+        case MOVE_TAKE:
+        case MOVE_DROP:
+            AddCubeDecision(pa, &msExport, pmr, pmr->mt == MOVE_TAKE ? DATASET_TAKE : DATASET_DROP,
+                            iMatch, iGame, iDecision++);
+            break;
+
+        default:
+            break;
+        }
+
+        ApplyMoveRecord(&msExport, plGame, pmr);
+    }
+}
+
+/* fseek() to byte n of pf; a dataset passes 2 GB long before n passes
+ * LONG_MAX on systems where long is 32 bits */
+
+static int
+SeekDataset(FILE * pf, guint64 n)
+{
+#if defined(WIN32)
+    return _fseeki64(pf, (__int64) n, SEEK_SET);
+#elif defined(HAVE_FSEEKO)
+    if ((off_t) n < 0 || (guint64) (off_t) n != n) {
+        errno = ERANGE;
+        return -1;
+    }
+    return fseeko(pf, (off_t) n, SEEK_SET);
+#else
+    if (n > LONG_MAX) {
+        errno = ERANGE;
+        return -1;
+    }
+    return fseek(pf, (long) n, SEEK_SET);
+#endif
+}
+
+/* Opens sz for appending, creating it if necessary. Returns the file
+ * positioned after the last record, with *pdh filled in. */
+
+static FILE *
+OpenDataset(const char *sz, datasetheader * pdh)
+{
+    FILE *pf;
+
+    /* the layout in dataset.h must not depend on the compiler */
+    g_assert(sizeof(datasetheader) == 64 && sizeof(datasetrecord) == 128);
+    g_assert(NUM_ROLLOUT_OUTPUTS == 7);
+
+    if ((pf = g_fopen(sz, "r+b")) == NULL) {
+        if (errno != ENOENT || (pf = g_fopen(sz, "w+b")) == NULL) {
+            outputerr(sz);
+            return NULL;
+        }
+
+        memset(pdh, 0, sizeof(*pdh));
+        memcpy(pdh->szMagic, DATASET_MAGIC, sizeof(DATASET_MAGIC));
+        pdh->nVersion = GUINT32_TO_LE(DATASET_VERSION);
+        pdh->cbRecord = GUINT32_TO_LE(sizeof(datasetrecord));
+
+        if (fwrite(pdh, sizeof(*pdh), 1, pf) != 1) {
+            outputerr(sz);
+            fclose(pf);
+            return NULL;
+        }
+
+        return pf;
+    }
+
+    if (fread(pdh, sizeof(*pdh), 1, pf) != 1 || memcmp(pdh->szMagic, DATASET_MAGIC, sizeof(DATASET_MAGIC))) {
+        outputf(_("%s is not a dataset.\n"), sz);
+        fclose(pf);
+        return NULL;
+    }
+
+    if (GUINT32_FROM_LE(pdh->nVersion) != DATASET_VERSION ||
+        GUINT32_FROM_LE(pdh->cbRecord) != sizeof(datasetrecord)) {
+        outputf(_("%s was written by another version of GNU Backgammon.\n"), sz);
+        fclose(pf);
+        return NULL;
+    }
+
+    if (SeekDataset(pf, sizeof(*pdh) + GUINT64_FROM_LE(pdh->cRecords) * sizeof(datasetrecord)) < 0) {
+        outputerr(sz);
+        fclose(pf);
+        return NULL;
+    }
+
+    return pf;
+}
+
+extern void
+CommandExportDataset(char *sz)
+{
+    FILE *pf;
+    datasetheader dh;
+    GArray *pa;
+    listOLD *pl;
+    guint32 iMatch;
+    int i, fOK;
+
+    sz = NextToken(&sz);
+
+    if (!CheckGameExists())
+        return;
+
+    if (!sz || !*sz) {
+        outputl(_("You must specify a file to export to (see `help export dataset')."));
+        return;
+    }
+
+    if ((pf = OpenDataset(sz, &dh)) == NULL)
+        return;
+
+    iMatch = GUINT32_FROM_LE(dh.cMatches);
+    pa = g_array_new(FALSE, FALSE, sizeof(datasetrecord));
+
+    for (i = 0, pl = lMatch.plNext; pl != &lMatch; i++, pl = pl->plNext)
+        AddGameDecisions(pa, pl->p, iMatch, i);
+
+    /* the header is only updated once all records are written */
+    fOK = (pa->len == 0 || fwrite(pa->data, sizeof(datasetrecord), pa->len, pf) == pa->len) && !fflush(pf);
+
+    if (fOK) {
+        dh.cRecords = GUINT64_TO_LE(GUINT64_FROM_LE(dh.cRecords) + pa->len);
+        dh.cMatches = GUINT32_TO_LE(iMatch + 1);
+        fOK = !fseek(pf, 0L, SEEK_SET) && fwrite(&dh, sizeof(dh), 1, pf) == 1;
+    }
+
+    if (fclose(pf) || !fOK)
+        outputerr(sz);
+    else
+        outputf(ngettext("%u decision appended to %s.\n", "%u decisions appended to %s.\n", pa->len), pa->len, sz);
+
+    g_array_free(pa, TRUE);
+
+    setDefaultFileName(sz);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+#ifndef DATASET_H
+#define DATASET_H
+
+#include <stdint.h>
+
+/* Position datasets written by "export dataset".
+ *
+ * A dataset is a datasetheader followed by cRecords datasetrecords, all
+ * little endian. Records have a fixed size, so record i starts at
+ * sizeof(datasetheader) + i * cbRecord and the file can be mapped and
+ * used as an array. Each export appends the decisions of the current
+ * match or session and then updates the header, so an interrupted export
+ * leaves the previous contents intact.
+ *
+ * This header only uses fixed width types and is meant to be shared with
+ * programs reading the data, such as the net trainer. */
+
+#define DATASET_MAGIC "GNUBGDS"
+#define DATASET_VERSION 1
+
+/* iRank of a decision that was not analysed */
+#define DATASET_NO_RANK 0xFFFF
+
+typedef enum {
+    DATASET_MOVE,               /* chequer play */
+    DATASET_NODOUBLE,           /* the player on roll did not double */
+    DATASET_DOUBLE,             /* the player on roll doubled */
+    DATASET_TAKE,               /* the opponent took */
+    DATASET_DROP                /* the opponent passed */
+} datasettype;
+
+/* fFlags of a record */
+#define DATASET_CRAWFORD 1      /* this is the Crawford game */
+#define DATASET_POSTCRAWFORD 2
+#define DATASET_JACOBY 4
+#define DATASET_CUBEUSE 8
+
+typedef struct {
+    char szMagic[8];
+    uint32_t nVersion;
+    uint32_t cbRecord;          /* sizeof(datasetrecord) */
+    uint64_t cRecords;
+    uint32_t cMatches;          /* number of exports appended */
+    uint8_t abReserved[36];
+} datasetheader;
+
+/* One decision. The position, score and cube are seen from the player on
+ * roll; for take and drop decisions that is the doubler, and fPlayer is
+ * the player taking the decision.
+ *
+ * For chequer plays arPlayed and arBest are the evaluations of the move
+ * made and of the best move, and et/nPlies describe the evaluation of the
+ * best move. For cube decisions they are the two evaluations of the cube
+ * analysis (cube as it is and doubled) and anMove/anBest are unused. */
+
+typedef struct {
+    uint32_t anKey[7];          /* positionkey before the decision */
+    uint32_t iMatch;            /* export this record was appended by */
+    float arPlayed[7];          /* NUM_ROLLOUT_OUTPUTS */
+    float arBest[7];
+    uint16_t iGame;
+    uint16_t iDecision;         /* decision number within the game */
+    uint16_t iRank;             /* rank of the move made, 0 for the best */
+    uint16_t nMatchTo;          /* 0 for money sessions */
+    uint16_t anScore[2];
+    int8_t anMove[8];           /* move made, -1 terminated */
+    int8_t anBest[8];
+    uint8_t dt;                 /* datasettype */
+    uint8_t fPlayer;
+    uint8_t anDice[2];          /* 0 for cube decisions */
+    uint8_t nLogCube;           /* the cube value is 1 << nLogCube */
+    int8_t fCubeOwner;          /* -1 centred, 0 player on roll, 1 opponent */
+    uint8_t fFlags;
+    uint8_t bgv;                /* bgvariation */
+    uint8_t et;                 /* evaltype */
+    uint8_t nPlies;             /* plies of the evaluation or rollout */
+    uint8_t fCubeful;
+    uint8_t nReserved;
+} datasetrecord;
+
+#endif
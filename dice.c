@@ -52,6 +52,11 @@
 #include "gtkgame.h"
 #endif
 
+/* number of dice drawn at a time by RollDiceBuffered(), and the
+ * smaller first block drawn after seeding */
+#define DICE_BUFFER 256
+#define DICE_BUFFER_FIRST 32
+
 const char *aszRNG[NUM_RNGS] = {
     N_("Blum, Blum and Shub"),
     "ISAAC",
@@ -106,8 +111,18 @@ struct rngcontext {
 #endif
     unsigned int n;             /* seed */
 
+    /* dice drawn ahead by RollDiceBuffered() */
+    unsigned char anBuffered[DICE_BUFFER];
+    unsigned int iBuffered;
+    unsigned int nBuffered;
+    unsigned int nFill;         /* size of the next block; 0 after seeding */
+
 };
 
+/* 2^32 / 6 and the largest multiple of 6 not above 2^32 */
+static const unsigned long exp232_q = 715827882;
+static const unsigned long exp232_l = 4294967292U;
+
 
 static unsigned int
  ReadDiceFile(rngcontext * rngctx);
@@ -457,6 +472,7 @@ InitRNGSeed(unsigned int n, const rng rngx, rngcontext * rngctx)
 
     rngctx->n = n;
     rngctx->c = 0;
+    rngctx->iBuffered = rngctx->nBuffered = rngctx->nFill = 0;
 
     switch (rngx) {
 
@@ -527,6 +543,7 @@ InitRNGSeedMP(mpz_t n, rng rng, rngcontext * rngctx)
                     tempmtkey[i] = 0;
                 }
                 init_by_array(tempmtkey, MT_ARRAY_N, &rngctx->mti, rngctx->mt);
+                rngctx->iBuffered = rngctx->nBuffered = rngctx->nFill = 0;
 
                 free(achState);
             } else {
@@ -760,8 +777,6 @@ extern int
 RollDice(unsigned int anDice[2], rng * prng, rngcontext * rngctx)
 {
     unsigned long tmprnd;
-    const unsigned long exp232_q = 715827882;
-    const unsigned long exp232_l = 4294967292U;
 
     anDice[0] = anDice[1] = 0;
 
@@ -851,6 +866,69 @@ RollDice(unsigned int anDice[2], rng * prng, rngcontext * rngctx)
     return 0;
 }
 
+/*
+ * Draw a block of dice from the ISAAC or Mersenne Twister generator,
+ * keeping a die left over from the previous block. The dice come in
+ * the same order as from RollDice().
+ *
+ * Rollouts reseed every trial, and a truncated trial uses only a few
+ * dozen dice, so the first block after seeding is small and the blocks
+ * double up to DICE_BUFFER from there.
+ */
+
+static void
+FillDiceBuffer(const rng rngx, rngcontext * rngctx)
+{
+    unsigned long an[DICE_BUFFER];
+    unsigned int i, n = rngctx->nBuffered - rngctx->iBuffered;
+    unsigned int cFill = rngctx->nFill ? rngctx->nFill : DICE_BUFFER_FIRST;
+    unsigned int cWords = cFill - n;
+
+    g_assert(n < 2);
+
+    rngctx->nFill = MIN(2 * cFill, DICE_BUFFER);
+
+    if (n)
+        rngctx->anBuffered[0] = rngctx->anBuffered[rngctx->iBuffered];
+
+    if (rngx == RNG_MERSENNE)
+        genrand_int32_n(&rngctx->mti, rngctx->mt, an, cWords);
+    else
+        for (i = 0; i < cWords; ++i)
+            an[i] = irand(&rngctx->rc);
+
+    for (i = 0; i < cWords; ++i)
+        if (an[i] < exp232_l)   /* otherwise try again, as RollDice() */
+            rngctx->anBuffered[n++] = (unsigned char) (1 + an[i] / exp232_q);
+
+    rngctx->iBuffered = 0;
+    rngctx->nBuffered = n;
+}
+
+/*
+ * As RollDice(), for callers which draw many rolls from a context of
+ * their own (rollouts). ISAAC and Mersenne Twister dice are drawn a
+ * block at a time; the sequence of rolls for a seed does not change,
+ * but the generator runs ahead of the rolls, so a context must not be
+ * shared with RollDice() until it is seeded again.
+ */
+
+extern int
+RollDiceBuffered(unsigned int anDice[2], rng * prng, rngcontext * rngctx)
+{
+    if (*prng != RNG_MERSENNE && *prng != RNG_ISAAC)
+        return RollDice(anDice, prng, rngctx);
+
+    while (rngctx->nBuffered - rngctx->iBuffered < 2)
+        FillDiceBuffer(*prng, rngctx);
+
+    anDice[0] = rngctx->anBuffered[rngctx->iBuffered++];
+    anDice[1] = rngctx->anBuffered[rngctx->iBuffered++];
+    rngctx->c += 2;
+
+    return 0;
+}
+
 extern FILE *
 OpenDiceFile(rngcontext * rngctx, const char *sz)
 {
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* Engine counters and timers, see enginestats.h */
+
+#include "config.h"
+
+#include <glib.h>
+#include <string.h>
+
+#include "backgammon.h"
+#include "enginestats.h"
+
+#if defined(ENGINE_STATS)
+
+/* The counters of thread id are in aesThread[id + 1]. They are only
+ * added when threads are created, which is done by the main thread,
+ * and are never freed. */
+static GPtrArray *paesThread;
+
+/* the clock when the counters were last reset */
+static guint64 nTicksReset;
+static gint64 usReset;
+
+static gint64
+MonotonicTime(void)
+{
+#if GLIB_CHECK_VERSION (2,28,0)
+    return g_get_monotonic_time();
+#else
+    return 0;
+#endif
+}
+
+extern enginestats *
+EngineStatsThread(int id)
+{
+    guint i = (guint) (id + 1);
+
+    if (!paesThread) {
+        paesThread = g_ptr_array_new();
+        nTicksReset = ES_CLOCK();
+        usReset = MonotonicTime();
+    }
+
+    while (paesThread->len <= i)
+        g_ptr_array_add(paesThread, g_new0(enginestats, 1));
+
+    return g_ptr_array_index(paesThread, i);
+}
+
+extern int
+EngineStatsTotal(enginestats * pes, double *prTickRate)
+{
+    guint i;
+    int j;
+    gint64 usElapsed = MonotonicTime() - usReset;
+
+    memset(pes, 0, sizeof(*pes));
+
+    for (i = 0; paesThread && i < paesThread->len; i++) {
+        const enginestats *pesThread = g_ptr_array_index(paesThread, i);
+
+        for (j = 0; j < N_ENGINE_COUNTERS; j++)
+            pes->an[j] += pesThread->an[j];
+        for (j = 0; j < N_ENGINE_TIMERS; j++)
+            pes->anTicks[j] += pesThread->anTicks[j];
+        for (j = 0; j < ENGINE_STATS_PLIES; j++) {
+            pes->anCacheLookup[j] += pesThread->anCacheLookup[j];
+            pes->anCacheHit[j] += pesThread->anCacheHit[j];
+        }
+    }
+
+    *prTickRate = usElapsed > 0 ? (double) (ES_CLOCK() - nTicksReset) * 1e6 / (double) usElapsed : 0.0;
+
+    return TRUE;
+}
+
+extern void
+EngineStatsReset(void)
+{
+    guint i;
+
+    for (i = 0; paesThread && i < paesThread->len; i++)
+        memset(g_ptr_array_index(paesThread, i), 0, sizeof(enginestats));
+
+    nTicksReset = ES_CLOCK();
+    usReset = MonotonicTime();
+}
+
+#else
+
+extern enginestats *
+EngineStatsThread(int UNUSED(id))
+{
+    return NULL;
+}
+
+extern int
+EngineStatsTotal(enginestats * pes, double *prTickRate)
+{
+    memset(pes, 0, sizeof(*pes));
+    *prTickRate = 0.0;
+
+    return FALSE;
+}
+
+extern void
+EngineStatsReset(void)
+{
+}
+
+#endif
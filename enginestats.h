@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+#ifndef ENGINESTATS_H
+#define ENGINESTATS_H
+
+#include "config.h"
+
+#include <glib.h>
+
+/* Counters and timers for the hot paths of the engine.
+ *
+ * They are only compiled in with "configure --enable-engine-stats"
+ * (ENGINE_STATS); otherwise the macros below expand to nothing. Every
+ * thread counts into its own enginestats, reached through its
+ * ThreadLocalData, so counting takes no locks. "show statistics engine"
+ * adds up the threads; the sum is approximate while tasks are running.
+ *
+ * Timers count ticks of the cycle counter where there is one (x86 with a
+ * GNU compatible compiler), microseconds otherwise. The tick rate is
+ * measured against the monotonic clock when the statistics are read. */
+
+typedef enum {
+    ESC_EVAL_CONTACT,           /* neural net evaluations by class */
+    ESC_EVAL_CRASHED,
+    ESC_EVAL_RACE,
+    ESC_EVAL_BEAROFF,           /* bearoff and hypergammon database lookups */
+    ESC_EVAL_OSR,               /* one-sided rollouts (cache misses only) */
+    ESC_EVAL_PRUNE,             /* pruning net evaluations */
+    ESC_PRUNE_CACHE_HIT,        /* pruning evaluations found in the cache */
+    ESC_GENERATE,               /* calls to GenerateMoves */
+    ESC_MOVES,                  /* legal moves generated */
+    ESC_PRUNE_MOVES,            /* moves ranked by FindBestMoveInEval ... */
+    ESC_PRUNE_KEPT,             /* ... and of these, moves kept for full evaluation */
+    ESC_EXCLUSIVE,              /* calls to MT_Exclusive */
+    N_ENGINE_COUNTERS
+} enginecounter;
+
+typedef enum {
+    EST_EVAL,                   /* static evaluations of all classes */
+    EST_GENERATE,               /* GenerateMoves */
+    EST_EXCLUSIVE,              /* waiting for MT_Exclusive */
+    N_ENGINE_TIMERS
+} enginetimer;
+
+/* cache lookups are counted by ply, the last entry includes deeper plies */
+#define ENGINE_STATS_PLIES 5
+
+typedef struct {
+    guint64 an[N_ENGINE_COUNTERS];
+    guint64 anTicks[N_ENGINE_TIMERS];
+    guint64 anCacheLookup[ENGINE_STATS_PLIES];
+    guint64 anCacheHit[ENGINE_STATS_PLIES];
+} enginestats;
+
+#if defined(ENGINE_STATS)
+
+#include "multithread.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ES_CLOCK() ((guint64) __builtin_ia32_rdtsc())
+#elif GLIB_CHECK_VERSION (2,28,0)
+#define ES_CLOCK() ((guint64) g_get_monotonic_time())
+#else
+#define ES_CLOCK() ((guint64) 0)
+#endif
+
+#define ES_COUNT(c) (MT_GetTLD()->pes->an[c]++)
+#define ES_ADD(c, n) (MT_GetTLD()->pes->an[c] += (guint64) (n))
+#define ES_CACHE(nPlies, fHit) \
+    do { \
+        enginestats *pes_ = MT_GetTLD()->pes; \
+        int i_ = MIN((int) (nPlies), ENGINE_STATS_PLIES - 1); \
+        pes_->anCacheLookup[i_]++; \
+        if (fHit) \
+            pes_->anCacheHit[i_]++; \
+    } while (0)
+#define ES_TIMER_START(v) guint64 v = ES_CLOCK()
+#define ES_TIMER_STOP(t, v) (MT_GetTLD()->pes->anTicks[t] += ES_CLOCK() - (v))
+
+#else
+
+#define ES_COUNT(c) ((void) 0)
+#define ES_ADD(c, n) ((void) 0)
+#define ES_CACHE(nPlies, fHit) ((void) 0)
+#define ES_TIMER_START(v)
+#define ES_TIMER_STOP(t, v) ((void) 0)
+
+#endif
+
+/* Returns the counters for thread id (-1 for the main thread), to be
+ * kept in its ThreadLocalData. Threads with the same id share them, so
+ * the counts of a thread pool survive "set threads". */
+extern enginestats *EngineStatsThread(int id);
+
+/* Adds up the counters of all threads; returns FALSE if the statistics
+ * are not compiled in. prTickRate gets the timer ticks per second. */
+extern int EngineStatsTotal(enginestats * pes, double *prTickRate);
+
+extern void EngineStatsReset(void);
+
+#endif
@@ -26,6 +26,9 @@
 #include <string.h>
 #include <errno.h>
 #include <stdlib.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "isaac.h"
 #include "md5.h"
 #include "bearoffgammon.h"
@@ -35,9 +38,18 @@
 #include "format.h"
 #include "simd.h"
 #include "multithread.h"
+#include "snapshot.h"
 #include "util.h"
 #include "lib/simd.h"
 
+#if !GLIB_CHECK_VERSION (2,26,0)
+#ifdef WIN32
+#define GStatBuf struct _g_stat_struct
+#else
+typedef struct stat GStatBuf;
+#endif
+#endif
+
 typedef void (*classstatusfunc) (char *szOutput);
 typedef int (*cfunc) (const void *, const void *);
 
@@ -203,6 +215,7 @@ f_FindBestMove FindBestMove = FindBestMoveNoLocking;
 f_EvaluatePosition EvaluatePosition = EvaluatePositionNoLocking;
 f_ScoreMove ScoreMove = ScoreMoveNoLocking;
 f_GeneralCubeDecisionE GeneralCubeDecisionE = GeneralCubeDecisionENoLocking;
+f_GeneralCubeDecisionEScores GeneralCubeDecisionEScores = GeneralCubeDecisionEScoresNoLocking;
 f_GeneralEvaluationE GeneralEvaluationE = GeneralEvaluationENoLocking;
 
 #define FindnSaveBestMoves FindnSaveBestMovesNoLocking
@@ -210,6 +223,7 @@ f_GeneralEvaluationE GeneralEvaluationE = GeneralEvaluationENoLocking;
 #define EvaluatePosition EvaluatePositionNoLocking
 #define ScoreMove ScoreMoveNoLocking
 #define GeneralCubeDecisionE GeneralCubeDecisionENoLocking
+#define GeneralCubeDecisionEScores GeneralCubeDecisionEScoresNoLocking
 #define GeneralEvaluationE GeneralEvaluationENoLocking
 #define EvaluatePositionCache EvaluatePositionCacheNoLocking
 #define FindBestMovePlied FindBestMovePliedNoLocking
@@ -233,12 +247,36 @@ static int FindBestMovePlied(int anMove[8], int nDice0, int nDice1,
 static int anEscapes[0x1000];
 static int anEscapes1[0x1000];
 
-static int anPoint[16] = { 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
-
 neuralnet nnContact, nnRace, nnCrashed;
 
 neuralnet nnpContact, nnpRace, nnpCrashed;
 
+/* the nets point into the snapshot and are not ours to free */
+static int fNetsMapped = FALSE;
+
+/* the file the nets were read from, NULL for new nets */
+static char *szWeightsFile = NULL;
+
+/* The start of the weights block of a snapshot; the name of the file the
+ * nets were read from follows, with its terminating NUL */
+typedef struct {
+    guint64 cbFile;             /* size and modification time of the file */
+    gint64 tModified;
+} weightssnapshot;
+
+static const struct {
+    snapblock id;
+    neuralnet *pnn;
+    unsigned int cInput;
+} anSnapshotNets[] = {
+    { SNAP_NET_CONTACT, &nnContact, NUM_INPUTS },
+    { SNAP_NET_RACE, &nnRace, NUM_RACE_INPUTS },
+    { SNAP_NET_CRASHED, &nnCrashed, NUM_INPUTS },
+    { SNAP_NET_PCONTACT, &nnpContact, NUM_PRUNING_INPUTS },
+    { SNAP_NET_PRACE, &nnpRace, NUM_PRUNING_INPUTS },
+    { SNAP_NET_PCRASHED, &nnpCrashed, NUM_PRUNING_INPUTS }
+};
+
 bearoffcontext *pbcOS = NULL;
 bearoffcontext *pbcTS = NULL;
 bearoffcontext *pbc1 = NULL;
@@ -414,18 +452,49 @@ ComputeTable0(void)
     }
 }
 
-static int
-Escapes(const unsigned int anBoard[25], int n)
+/* Bit i of the result is set if point i of anBoard holds at least nMin
+ * chequers (nMin from 1 to 15) */
+
+static inline unsigned int
+PointsWith(const unsigned int anBoard[25], unsigned int nMin)
 {
+#if defined(__SSE2__)
+    const __m128i *p = (const __m128i *) (const void *) anBoard;
+    __m128i const below = _mm_set1_epi8((char) (nMin - 1));
+    __m128i lo, hi;
+
+    /* the counts are at most 15, so they survive packing to bytes */
+    lo = _mm_packs_epi16(_mm_packs_epi32(_mm_loadu_si128(p), _mm_loadu_si128(p + 1)),
+                         _mm_packs_epi32(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3)));
+    hi = _mm_packs_epi16(_mm_packs_epi32(_mm_loadu_si128(p + 4), _mm_loadu_si128(p + 5)), _mm_setzero_si128());
+
+    return (unsigned int) _mm_movemask_epi8(_mm_cmpgt_epi8(lo, below)) |
+        (unsigned int) _mm_movemask_epi8(_mm_cmpgt_epi8(hi, below)) << 16 | (unsigned int) (anBoard[24] >= nMin) << 24;
+#else
+    unsigned int i, n = 0;
+
+    for (i = 0; i < 25; i++)
+        n |= (unsigned int) (anBoard[i] >= nMin) << i;
 
-    int i, af = 0, m;
+    return n;
+#endif
+}
 
-    m = (n < 12) ? n : 12;
+/* The points 24 - n to 24 - n + 11 (at most 23) of the made points nMade,
+ * as an index into anEscapes and anEscapes1 */
+
+static inline unsigned int
+EscapesIndex(unsigned int nMade, int n)
+{
+    int m = (n < 12) ? n : 12;
 
-    for (i = 0; i < m; i++)
-        af |= (anPoint[anBoard[24 + i - n]] << i);
+    return m > 0 ? (nMade >> (24 - n)) & ((1u << m) - 1) : 0;
+}
 
-    return anEscapes[af];
+static int
+Escapes(unsigned int nMade, int n)
+{
+    return anEscapes[EscapesIndex(nMade, n)];
 }
 
 static void
@@ -456,30 +525,112 @@ ComputeTable1(void)
 }
 
 static int
-Escapes1(const unsigned int anBoard[25], int n)
+Escapes1(unsigned int nMade, int n)
 {
-
-    int i, af = 0, m;
-
-    m = (n < 12) ? n : 12;
-
-    for (i = 0; i < m; i++)
-        af |= (anPoint[anBoard[24 + i - n]] << i);
-
-    return anEscapes1[af];
+    return anEscapes1[EscapesIndex(nMade, n)];
 }
 
 
 static void
 ComputeTable(void)
 {
+    gsize cb;
+    const int *pn = SnapshotBlock(SNAP_ESCAPES, &cb);
+
+    if (pn && cb >= sizeof(anEscapes) + sizeof(anEscapes1)) {
+        memcpy(anEscapes, pn, sizeof(anEscapes));
+        memcpy(anEscapes1, pn + G_N_ELEMENTS(anEscapes), sizeof(anEscapes1));
+        return;
+    }
+
     ComputeTable0();
     ComputeTable1();
 }
 
+extern void
+EvalSnapshotSave(snapshotwriter * psw)
+{
+    GStatBuf st;
+    unsigned int i;
+
+    /* only nets read from a file can be checked for changes */
+    if (szWeightsFile && g_stat(szWeightsFile, &st) == 0) {
+        weightssnapshot ws;
+
+        memset(&ws, 0, sizeof(ws));
+        ws.cbFile = (guint64) st.st_size;
+        ws.tModified = (gint64) st.st_mtime;
+
+        SnapshotWriterAdd(psw, SNAP_WEIGHTS, &ws, sizeof(ws));
+        SnapshotWriterAdd(psw, SNAP_WEIGHTS, szWeightsFile, strlen(szWeightsFile) + 1);
+
+        for (i = 0; i < G_N_ELEMENTS(anSnapshotNets); i++)
+            SnapshotWriterAddNet(psw, anSnapshotNets[i].id, anSnapshotNets[i].pnn);
+    }
+
+    /* both tables in one block, sizeof(anEscapes) is a multiple of the alignment */
+    SnapshotWriterAdd(psw, SNAP_ESCAPES, anEscapes, sizeof(anEscapes));
+    SnapshotWriterAdd(psw, SNAP_ESCAPES, anEscapes1, sizeof(anEscapes1));
+}
+
+/* Points the nets into the snapshot, if it has all of them with the
+ * expected shapes and if they were read from szWeightsBinary or szWeights
+ * as it is on disk now */
+static int
+NetsFromSnapshot(const char *szWeights, const char *szWeightsBinary)
+{
+    gsize cb;
+    const weightssnapshot *pws = SnapshotBlock(SNAP_WEIGHTS, &cb);
+    const char *szFile;
+    neuralnet ann[G_N_ELEMENTS(anSnapshotNets)];
+    GStatBuf st;
+    unsigned int i;
+
+    if (!pws || cb <= SNAPSHOT_PAD(sizeof(weightssnapshot)))
+        return FALSE;
+
+    szFile = (const char *) pws + SNAPSHOT_PAD(sizeof(weightssnapshot));
+    cb -= (gsize) SNAPSHOT_PAD(sizeof(weightssnapshot));
+
+    if (!memchr(szFile, 0, cb))
+        return FALSE;
+
+    if ((!szWeightsBinary || strcmp(szFile, szWeightsBinary)) && (!szWeights || strcmp(szFile, szWeights)))
+        return FALSE;
+
+    if (g_stat(szFile, &st) != 0 || pws->cbFile != (guint64) st.st_size || pws->tModified != (gint64) st.st_mtime)
+        return FALSE;
+
+    for (i = 0; i < G_N_ELEMENTS(anSnapshotNets); i++)
+        if (SnapshotNet(anSnapshotNets[i].id, &ann[i], anSnapshotNets[i].cInput, NUM_OUTPUTS))
+            return FALSE;
+
+    for (i = 0; i < G_N_ELEMENTS(anSnapshotNets); i++)
+        *anSnapshotNets[i].pnn = ann[i];
+
+    g_free(szWeightsFile);
+    szWeightsFile = g_strdup(szFile);
+
+    return TRUE;
+}
+
 static void
 DestroyWeights(void)
 {
+    g_free(szWeightsFile);
+    szWeightsFile = NULL;
+
+    if (fNetsMapped) {
+        memset(&nnContact, 0, sizeof(neuralnet));
+        memset(&nnCrashed, 0, sizeof(neuralnet));
+        memset(&nnRace, 0, sizeof(neuralnet));
+        memset(&nnpContact, 0, sizeof(neuralnet));
+        memset(&nnpCrashed, 0, sizeof(neuralnet));
+        memset(&nnpRace, 0, sizeof(neuralnet));
+        fNetsMapped = FALSE;
+        return;
+    }
+
     NeuralNetDestroy(&nnContact);
     NeuralNetDestroy(&nnCrashed);
     NeuralNetDestroy(&nnRace);
@@ -689,7 +840,10 @@ EvalInitialise(char *szWeights, char *szWeightsBinary, int fNoBearoff, void (*pf
 
     }
 
-    if (szWeightsBinary) {
+    if (!fReadWeights && NetsFromSnapshot(szWeights, szWeightsBinary))
+        fReadWeights = fNetsMapped = TRUE;
+
+    if (!fReadWeights && szWeightsBinary) {
         pfWeights = g_fopen(szWeightsBinary, "rb");
         if (!binary_weights_failed(szWeightsBinary, pfWeights)) {
             if (!fReadWeights && !(fReadWeights =
@@ -701,6 +855,8 @@ EvalInitialise(char *szWeights, char *szWeightsBinary, int fNoBearoff, void (*pf
                                    !NeuralNetLoadBinary(&nnpRace, pfWeights))) {
                 perror(szWeightsBinary);
             }
+            if (fReadWeights)
+                szWeightsFile = g_strdup(szWeightsBinary);
         }
         if (pfWeights)
             fclose(pfWeights);
@@ -719,6 +875,8 @@ EvalInitialise(char *szWeights, char *szWeightsBinary, int fNoBearoff, void (*pf
                   !NeuralNetLoad(&nnpCrashed, pfWeights) && !NeuralNetLoad(&nnpRace, pfWeights)
                 ))
                 perror(szWeights);
+            else
+                szWeightsFile = g_strdup(szWeights);
             setlocale(LC_ALL, "");
         }
         if (pfWeights)
@@ -749,6 +907,8 @@ static void
 CalculateHalfInputs(const unsigned int anBoard[25], const unsigned int anBoardOpp[25], float afInput[])
 {
     int i, j, k, l, nOppBack, n, aHit[39], nBoard;
+    unsigned int nMade = PointsWith(anBoard, 2), nMadeOpp = PointsWith(anBoardOpp, 2);
+    unsigned int nBlotsOpp, nHitters, nFrom;
 
     /* aanCombination[n] -
      * How many ways to hit from a distance of n pips.
@@ -1007,18 +1167,22 @@ CalculateHalfInputs(const unsigned int anBoard[25], const unsigned int anBoardOp
 
     memset(aHit, 0, sizeof(aHit));
 
-    /* for every point we'd consider hitting a blot on, */
+    /* the blots we'd consider hitting, and the points we have a hitter
+     * on and are willing to hit from */
+
+    nBlotsOpp = PointsWith(anBoardOpp, 1) & ~nMadeOpp & ((2u << ((nBoard > 2) ? 23 : 21)) - 1);
+    nHitters = PointsWith(anBoard, 1) & ~(nMade & ~PointsWith(anBoard, 3) & 0x3f);
 
-    for (i = (nBoard > 2) ? 23 : 21; i >= 0; i--)
-        /* if there's a blot there, then */
+    /* for every blot, */
 
-        if (unlikely(anBoardOpp[i] == 1))
-            /* for every point beyond */
+    for (; nBlotsOpp; nBlotsOpp ^= 1u << i) {
+        i = msb32((int) nBlotsOpp);
 
-            for (j = 24 - i; j < 25; j++)
-                /* if we have a hitter and are willing to hit */
+        /* for every hitter beyond */
+
+        for (nFrom = nHitters & (~0u << (24 - i)); nFrom; nFrom ^= 1u << j) {
+            j = msb32((int) nFrom);
 
-                if (anBoard[j] && !(j < 6 && anBoard[j] == 2))
                     /* for every roll that can hit from that point */
 
                     for (n = 0; n < 5; n++) {
@@ -1036,14 +1200,15 @@ CalculateHalfInputs(const unsigned int anBoard[25], const unsigned int anBoardOp
                                 /* all the intermediate points are required */
 
                                 for (k = 0; k < 3 && pi->anIntermediate[k] > 0; k++)
-                                    if (anBoardOpp[i - pi->anIntermediate[k]] > 1)
+                                    if (nMadeOpp & (1u << (i - pi->anIntermediate[k])))
                                         /* point is blocked; look for other hits */
                                         goto cannot_hit;
                             }
                         } else {
                             /* either of two points are required */
 
-                            if (anBoardOpp[i - pi->anIntermediate[0]] > 1 && anBoardOpp[i - pi->anIntermediate[1]] > 1) {
+                            if (nMadeOpp & (1u << (i - pi->anIntermediate[0])) &&
+                                nMadeOpp & (1u << (i - pi->anIntermediate[1]))) {
                                 /* both are blocked; look for other hits */
                                 goto cannot_hit;
                             }
@@ -1054,6 +1219,8 @@ CalculateHalfInputs(const unsigned int anBoard[25], const unsigned int anBoardOp
                         aHit[aanCombination[j - 24 + i][n]] |= 1 << j;
                       cannot_hit:;
                     }
+        }
+    }
 
     memset(aRoll, 0, sizeof(aRoll));
 
@@ -1259,12 +1426,12 @@ CalculateHalfInputs(const unsigned int anBoard[25], const unsigned int anBoardOp
         afInput[I_P2] = (float) n2 / 36.0f;
     }
 
-    afInput[I_BACKESCAPES] = (float) Escapes(anBoard, 23 - nOppBack) / 36.0f;
+    afInput[I_BACKESCAPES] = (float) Escapes(nMade, 23 - nOppBack) / 36.0f;
 
-    afInput[I_BACKRESCAPES] = (float) Escapes1(anBoard, 23 - nOppBack) / 36.0f;
+    afInput[I_BACKRESCAPES] = (float) Escapes1(nMade, 23 - nOppBack) / 36.0f;
 
     for (n = 36, i = 15; i < 24 - nOppBack; i++)
-        if ((j = Escapes(anBoard, i)) < n)
+        if ((j = Escapes(nMade, i)) < n)
             n = j;
 
     afInput[I_ACONTAIN] = (float) (36 - n) / 36.0f;
@@ -1277,7 +1444,7 @@ CalculateHalfInputs(const unsigned int anBoard[25], const unsigned int anBoardOp
     }
 
     for (; i < 24; i++)
-        if ((j = Escapes(anBoard, i)) < n)
+        if ((j = Escapes(nMade, i)) < n)
             n = j;
 
 
@@ -1286,7 +1453,7 @@ CalculateHalfInputs(const unsigned int anBoard[25], const unsigned int anBoardOp
 
     for (n = 0, i = 6; i < 25; i++)
         if (anBoard[i])
-            n += (i - 5) * anBoard[i] * Escapes(anBoardOpp, i);
+            n += (i - 5) * anBoard[i] * Escapes(nMadeOpp, i);
 
     afInput[I_MOBILITY] = (float) n / 3600.0f;
 
@@ -1606,11 +1773,30 @@ swap(int *p0, int *p1)
 extern void
 SwapSides(TanBoard anBoard)
 {
+#if defined(__SSE2__)
+    __m128i *p0 = (__m128i *) (void *) anBoard[0];
+    __m128i *p1 = (__m128i *) (void *) anBoard[1];
+    unsigned int n;
+
+    /* 24 points four at a time, then the bar */
+    for (int i = 0; i < 6; i++) {
+        __m128i v0 = _mm_loadu_si128(p0 + i);
+        __m128i v1 = _mm_loadu_si128(p1 + i);
+
+        _mm_storeu_si128(p0 + i, v1);
+        _mm_storeu_si128(p1 + i, v0);
+    }
+
+    n = anBoard[0][24];
+    anBoard[0][24] = anBoard[1][24];
+    anBoard[1][24] = n;
+#else
     for (int i = 0; i < 25; i++) {
         int n = anBoard[0][i];
         anBoard[0][i] = anBoard[1][i];
         anBoard[1][i] = n;
     }
+#endif
 }
 
 /* An upper bound on the number of turns it can take to complete a bearoff
@@ -2871,6 +3057,8 @@ GenerateMoves(movelist * pml, const TanBoard anBoard, int n0, int n1, int fParti
 {
 
     int anRoll[4], anMoves[8];
+    ES_TIMER_START(nStart);
+
     anRoll[0] = n0;
     anRoll[1] = n1;
 
@@ -2886,6 +3074,10 @@ GenerateMoves(movelist * pml, const TanBoard anBoard, int n0, int n1, int fParti
         GenerateMovesSub(pml, anRoll, 0, 23, 0, anBoard, anMoves, fPartial);
     }
 
+    ES_COUNT(ESC_GENERATE);
+    ES_ADD(ESC_MOVES, pml->cMoves);
+    ES_TIMER_STOP(EST_GENERATE, nStart);
+
     return pml->cMoves;
 }
 
@@ -3181,6 +3373,20 @@ EvalCacheFlush(void)
     CacheFlush(&cEval);
 }
 
+extern void
+EvalSetDeadline(double rDeadline)
+{
+    MT_GetTLD()->rDeadline = rDeadline;
+}
+
+extern int
+EvalDeadlinePassed(void)
+{
+    double rDeadline = MT_GetTLD()->rDeadline;
+
+    return rDeadline > 0.0 && get_time() >= rDeadline;
+}
+
 void
 CommandClearCache(char *UNUSED(sz))
 {
@@ -5247,6 +5453,7 @@ DoubleType(const int fDoubled, const int fMove, const int fTurn)
 #define EvaluatePosition EvaluatePositionWithLocking
 #define ScoreMove ScoreMoveWithLocking
 #define GeneralCubeDecisionE GeneralCubeDecisionEWithLocking
+#define GeneralCubeDecisionEScores GeneralCubeDecisionEScoresWithLocking
 #define GeneralEvaluationE GeneralEvaluationEWithLocking
 #define EvaluatePositionCache EvaluatePositionCacheWithLocking
 #define FindBestMovePlied FindBestMovePliedWithLocking
@@ -5350,6 +5557,7 @@ FindBestMoveInEval(NNState * nnStates, int const nDice0, int const nDice1, const
         if ((l = CacheLookup(&cpEval, &ec, arOutput, NULL)) != CACHEHIT) {
             SSE_ALIGN(float arInput[NUM_PRUNING_INPUTS]);
 
+            ES_COUNT(ESC_EVAL_PRUNE);
             baseInputs((ConstTanBoard) anBoardOut, arInput);
             {
                 const neuralnet *nets[] = { &nnpRace, &nnpCrashed, &nnpContact };
@@ -5372,7 +5580,8 @@ FindBestMoveInEval(NNState * nnStates, int const nDice0, int const nDice1, const
             memcpy(ec.ar, arOutput, sizeof(float) * NUM_OUTPUTS);
             ec.ar[5] = 0.f;
             CacheAdd(&cpEval, &ec, l);
-        }
+        } else
+            ES_COUNT(ESC_PRUNE_CACHE_HIT);
         pm->rScore = UtilityME(arOutput, pci);
         if (i < prune_moves) {
             bmovesi[i] = i;
@@ -5395,9 +5604,11 @@ FindBestMoveInEval(NNState * nnStates, int const nDice0, int const nDice1, const
 
     pci->fMove = !pci->fMove;
 
-    if (i == ml.cMoves)
+    if (i == ml.cMoves) {
+        ES_ADD(ESC_PRUNE_MOVES, ml.cMoves);
+        ES_ADD(ESC_PRUNE_KEPT, prune_moves);
         ScoreMovesPruned(&ml, pci, pec, bmovesi, prune_moves);
-    else
+    } else
         ScoreMoves(&ml, pci, pec, 0);
 
     PositionFromKey(anBoardOut, &ml.amMoves[ml.iMoveBest].key);
@@ -5435,7 +5646,7 @@ EvaluatePositionFull(NNState * nnStates, const TanBoard anBoard, float arOutput[
                     anBoardNew[1][i] = anBoard[1][i];
                 }
 
-                if (fInterrupt) {
+                if (fInterrupt || EvalDeadlinePassed()) {
                     errno = EINTR;
                     return -1;
                 }
@@ -5481,10 +5692,18 @@ EvaluatePositionFull(NNState * nnStates, const TanBoard anBoard, float arOutput[
 
     } else {
         /* at leaf node; use static evaluation */
+        ES_TIMER_START(nStart);
 
         if (acef[pc] (anBoard, arOutput, pci->bgv, nnStates))
             return -1;
 
+        ES_TIMER_STOP(EST_EVAL, nStart);
+        if (pc >= CLASS_RACE)
+            /* the counters are in the reverse order of the classes */
+            ES_COUNT(ESC_EVAL_CONTACT + CLASS_CONTACT - pc);
+        else if (pc > CLASS_OVER)
+            ES_COUNT(ESC_EVAL_BEAROFF);
+
         if (pec->rNoise > 0.0f && pc != CLASS_OVER) {
             for (i = 0; i < NUM_OUTPUTS; i++) {
                 arOutput[i] += Noise(pec, anBoard, i);
@@ -5519,8 +5738,10 @@ EvaluatePositionCache(NNState * nnStates, const TanBoard anBoard, float arOutput
 
     ec.nEvalContext = EvalKey(pecx, nPlies, pci, FALSE);
     if ((l = CacheLookup(&cEval, &ec, arOutput, NULL)) == CACHEHIT) {
+        ES_CACHE(nPlies, TRUE);
         return 0;
     }
+    ES_CACHE(nPlies, FALSE);
 
     if (EvaluatePositionFull(nnStates, anBoard, arOutput, pci, pecx, nPlies, pc))
         return -1;
@@ -5902,6 +6123,66 @@ GeneralCubeDecisionE(float aarOutput[2][NUM_ROLLOUT_OUTPUTS],
 
 }
 
+/*
+ * 0-ply cube decisions for one position at several scores (or cube
+ * values). The cube positions of all the scores go through a single
+ * search, sharing the cubeless evaluation. Deeper, the chequer play at
+ * the inner nodes depends on the score, so there is nothing to share;
+ * use GeneralCubeDecisionE() for each score instead.
+ */
+
+extern int
+GeneralCubeDecisionEScores(float aaarOutput[][2][NUM_ROLLOUT_OUTPUTS],
+                           const TanBoard anBoard, cubeinfo aci[], const int cci, const evalcontext * pec)
+{
+
+    SSE_ALIGN(float arOutput[NUM_OUTPUTS]);
+    cubeinfo *aciCubePos;
+    float *arCubeful;
+    int i, j, k;
+
+    g_return_val_if_fail(pec->nPlies == 0, -1);
+
+    if (cci < 1)
+        return 0;
+
+    /* Setup cube for "no double" and "double, take" at every score */
+
+    aciCubePos = (cubeinfo *) g_alloca(2 * cci * sizeof(cubeinfo));
+    arCubeful = (float *) g_alloca(2 * cci * sizeof(float));
+
+    for (i = 0; i < cci; i++) {
+        memcpy(&aciCubePos[2 * i], &aci[i], sizeof(cubeinfo));
+        memcpy(&aciCubePos[2 * i + 1], &aci[i], sizeof(cubeinfo));
+        aciCubePos[2 * i + 1].fCubeOwner = !aciCubePos[2 * i + 1].fMove;
+        aciCubePos[2 * i + 1].nCube *= 2;
+    }
+
+    if (EvaluatePositionCubeful3(NULL, anBoard, arOutput, arCubeful, aciCubePos, 2 * cci, &aci[0], pec, 0, TRUE))
+        return -1;
+
+    for (i = 0; i < cci; i++) {
+
+        /* Scale double-take equity */
+        if (!aci[i].nMatchTo)
+            arCubeful[2 * i + 1] *= 2.0f;
+
+        for (j = 0; j < 2; j++) {
+
+            /* copy cubeless winning chances */
+            for (k = 0; k < NUM_OUTPUTS; k++)
+                aaarOutput[i][j][k] = arOutput[k];
+
+            aaarOutput[i][j][OUTPUT_EQUITY] = UtilityME(arOutput, &aciCubePos[2 * i + j]);
+            aaarOutput[i][j][OUTPUT_CUBEFUL_EQUITY] = arCubeful[2 * i + j];
+
+        }
+    }
+
+    return 0;
+
+}
+
 extern int
 GeneralEvaluationE(float arOutput[NUM_ROLLOUT_OUTPUTS],
                    const TanBoard anBoard, cubeinfo * const pci, const evalcontext * pec)
@@ -6005,7 +6286,7 @@ EvaluatePositionCubeful4(NNState * nnStates, const TanBoard anBoard,
                     anBoardNew[1][i] = anBoard[1][i];
                 }
 
-                if (fInterrupt) {
+                if (fInterrupt || EvalDeadlinePassed()) {
                     errno = EINTR;
                     return -1;
                 }
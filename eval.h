@@ -25,6 +25,7 @@
 #include "bearoff.h"
 #include "neuralnet.h"
 #include "cache.h"
+#include "snapshot.h"
 
 #define EXP_LOCK_FUN(ret, name, ...) \
 	typedef ret (*f_##name)( __VA_ARGS__); \
@@ -80,6 +81,9 @@ typedef struct movefilter_s {
     float Threshold;            /* ...if they are within this equity difference */
 } movefilter;
 
+/* deepest evaluation the settings allow */
+#define MAX_PLIES 7
+
 /* we'll have filters for 1..4 ply evaluation */
 #define MAX_FILTER_PLIES	4
 extern movefilter defaultFilters[MAX_FILTER_PLIES][MAX_FILTER_PLIES];
@@ -347,6 +351,9 @@ extern void EvalInitialise(char *szWeights, char *szWeightsBinary, int fNoBearof
 
 extern int EvalShutdown(void);
 
+/* Adds the nets and the escape tables to a snapshot, see snapshot.h */
+extern void EvalSnapshotSave(snapshotwriter * psw);
+
 extern void EvalStatus(char *szOutput);
 
 extern int EvalNewWeights(int nSize);
@@ -395,6 +402,11 @@ extern int
  GameStatus(const TanBoard anBoard, const bgvariation bgv);
 
 extern void EvalCacheFlush(void);
+
+/* Evaluations deeper than 0-ply on the calling thread fail with EINTR
+ * once get_time() reaches rDeadline; 0 clears the deadline */
+extern void EvalSetDeadline(double rDeadline);
+extern int EvalDeadlinePassed(void);
 extern int EvalCacheResize(unsigned int cNew);
 extern int EvalCacheStats(unsigned int *pcUsed, unsigned int *pcLookup, unsigned int *pcHit);
 extern double GetEvalCacheSize(void);
@@ -471,6 +483,9 @@ extern cubedecision FindCubeDecision(float arDouble[], float aarOutput[][NUM_ROL
 EXP_LOCK_FUN(int, GeneralCubeDecisionE, float aarOutput[2][NUM_ROLLOUT_OUTPUTS],
              const TanBoard anBoard, cubeinfo * const pci, const evalcontext * pec, const evalsetup * pes);
 
+EXP_LOCK_FUN(int, GeneralCubeDecisionEScores, float aaarOutput[][2][NUM_ROLLOUT_OUTPUTS],
+             const TanBoard anBoard, cubeinfo aci[], const int cci, const evalcontext * pec);
+
 EXP_LOCK_FUN(int, GeneralEvaluationE, float arOutput[NUM_ROLLOUT_OUTPUTS],
              const TanBoard anBoard, cubeinfo * const pci, const evalcontext * pec);
 
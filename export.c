@@ -576,6 +576,7 @@ GenerateImage(renderimages * pri, renderdata * prd,
     int fResign = 0, nResignOrientation = 0;
     int anArrowPosition[2];
     int cube_owner;
+    int n;
 
     memcpy(anBoardTemp, anBoard, sizeof anBoardTemp);
 
@@ -656,13 +657,167 @@ GenerateImage(renderimages * pri, renderdata * prd,
 
     /* write png */
 
-    WritePNG(szName, puch, nSizeX * nSize * 3, nSizeX * nSize, nSizeY * nSize);
+    n = WritePNG(szName, puch, nSizeX * nSize * 3, nSizeX * nSize, nSizeY * nSize);
 
     free(puch);
 
+    return n;
+}
+
+/* Images of positions already exported.
+ *
+ * An image depends only on what GenerateImage draws (the board, dice and
+ * cube as seen by the player on roll, the orientation) and the 2d
+ * rendering preferences, so these are the key. The value is the file the
+ * image was last written to; exporting the same image again copies that
+ * file instead of rendering and encoding it, as long as the file has not
+ * changed since. */
+
+#if !GLIB_CHECK_VERSION (2,26,0)
+#ifdef WIN32
+#define GStatBuf struct _g_stat_struct
+#else
+typedef struct stat GStatBuf;
+#endif
+#endif
+
+/* forget all images when there are more than this */
+#define PNG_CACHE_MAX 4096
+
+typedef struct {
+    TanBoard anBoard;
+    unsigned int anDice[2];
+    int fMove, fTurn, fCube, nCube, fDoubled, fCubeOwner, fClockwise, fPlaying;
+    unsigned char achPrefs[RENDER_PREFS_2D_SIZE];
+} pngkey;
+
+typedef struct {
+    gchar *szFile;
+    guint64 cb;
+    time_t tModified;
+} pngfile;
+
+static GHashTable *phtPNG;
+
+static guint
+PNGKeyHash(gconstpointer p)
+{
+    /* FNV-1a */
+    const unsigned char *pch = p;
+    guint32 n = 2166136261U;
+    size_t i;
+
+    for (i = 0; i < sizeof(pngkey); i++)
+        n = (n ^ pch[i]) * 16777619U;
+
+    return n;
+}
+
+static gboolean
+PNGKeyEqual(gconstpointer p0, gconstpointer p1)
+{
+    return !memcmp(p0, p1, sizeof(pngkey));
+}
+
+static void
+PNGFileFree(gpointer p)
+{
+    pngfile *ppf = p;
+
+    g_free(ppf->szFile);
+    g_free(ppf);
+}
+
+static void
+PNGKeyMake(pngkey * ppk, const renderdata * prd, const TanBoard anBoard,
+           const int fMove, const int fTurn, const int fCube,
+           const unsigned int anDice[2], const int nCube, const int fDoubled, const int fCubeOwner)
+{
+    /* zeroed first so that padding compares equal */
+    memset(ppk, 0, sizeof(*ppk));
+
+    memcpy(ppk->anBoard, anBoard, sizeof(ppk->anBoard));
+    if (!fMove)
+        SwapSides(ppk->anBoard);
+    ppk->anDice[0] = anDice[0];
+    ppk->anDice[1] = anDice[1];
+    ppk->fMove = fMove;
+    ppk->fTurn = fTurn;
+    ppk->fCube = fCube;
+    ppk->nCube = nCube;
+    ppk->fDoubled = fDoubled;
+    ppk->fCubeOwner = fCubeOwner;
+    ppk->fClockwise = fClockwise;
+    ppk->fPlaying = ms.gs != GAME_NONE;
+    memcpy(ppk->achPrefs, prd, RENDER_PREFS_2D_SIZE);
+}
+
+static int
+PNGFileStat(const char *sz, guint64 * pcb, time_t * ptModified)
+{
+    GStatBuf st;
+
+    if (g_stat(sz, &st))
+        return -1;
+
+    *pcb = (guint64) st.st_size;
+    *ptModified = st.st_mtime;
+
     return 0;
 }
 
+/* Writes the image for ppk to szName from an earlier export; returns
+ * -1 if there is none (or it is gone) */
+static int
+PNGCacheWrite(const pngkey * ppk, const char *szName)
+{
+    pngfile *ppf;
+    guint64 cb;
+    time_t tModified;
+    gchar *pch;
+    gsize cch;
+    int n;
+
+    if (!phtPNG || !(ppf = g_hash_table_lookup(phtPNG, ppk)))
+        return -1;
+
+    if (PNGFileStat(ppf->szFile, &cb, &tModified) || cb != ppf->cb || tModified != ppf->tModified)
+        return -1;
+
+    if (!strcmp(ppf->szFile, szName))
+        return 0;
+
+    if (!g_file_get_contents(ppf->szFile, &pch, &cch, NULL))
+        return -1;
+
+    n = g_file_set_contents(szName, pch, (gssize) cch, NULL) ? 0 : -1;
+    g_free(pch);
+
+    return n;
+}
+
+static void
+PNGCacheAdd(const pngkey * ppk, const char *szName)
+{
+    pngfile *ppf = g_new(pngfile, 1);
+    pngkey *ppkCopy;
+
+    if (PNGFileStat(szName, &ppf->cb, &ppf->tModified)) {
+        g_free(ppf);
+        return;
+    }
+
+    if (!phtPNG)
+        phtPNG = g_hash_table_new_full(PNGKeyHash, PNGKeyEqual, g_free, PNGFileFree);
+    else if (g_hash_table_size(phtPNG) >= PNG_CACHE_MAX)
+        g_hash_table_remove_all(phtPNG);
+
+    ppkCopy = g_new(pngkey, 1);
+    memcpy(ppkCopy, ppk, sizeof(*ppkCopy));
+    ppf->szFile = g_strdup(szName);
+    g_hash_table_replace(phtPNG, ppkCopy, ppf);
+}
+
 extern void
 CommandExportPositionPNG(char *sz)
 {
@@ -689,17 +844,25 @@ CommandExportPositionPNG(char *sz)
     {
         renderimages ri;
         renderdata rd;
+        pngkey pk;
 
         CopyAppearance(&rd);
         rd.nSize = exsExport.nPNGSize;
 
         g_assert(rd.nSize >= 1);
 
+        PNGKeyMake(&pk, &rd, msBoard(), ms.fMove, ms.fTurn, fCubeUse, ms.anDice, ms.nCube, ms.fDoubled,
+                   ms.fCubeOwner);
+
+        if (!PNGCacheWrite(&pk, sz))
+            return;
+
         RenderImages(&rd, &ri);
 
-        GenerateImage(&ri, &rd, msBoard(), sz,
-                      exsExport.nPNGSize, BOARD_WIDTH, BOARD_HEIGHT, 0, 0,
-                      ms.fMove, ms.fTurn, fCubeUse, ms.anDice, ms.nCube, ms.fDoubled, ms.fCubeOwner);
+        if (!GenerateImage(&ri, &rd, msBoard(), sz,
+                           exsExport.nPNGSize, BOARD_WIDTH, BOARD_HEIGHT, 0, 0,
+                           ms.fMove, ms.fTurn, fCubeUse, ms.anDice, ms.nCube, ms.fDoubled, ms.fCubeOwner))
+            PNGCacheAdd(&pk, sz);
 
         FreeImages(&ri);
     }
@@ -39,6 +39,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include <string.h>
+#include <fcntl.h>
 
 #if HAVE_SYS_SOCKET_H
 #include <sys/types.h>
@@ -47,6 +48,7 @@
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <sys/un.h>
+#include <sys/select.h>
 #endif                          /* #if HAVE_SYS_SOCKET_H */
 
 #else                           /* #ifndef WIN32 */
@@ -103,12 +105,14 @@
 
 #endif                          /* HAVE_SOCKETS */
 
+#include "anytime.h"
 #include "backgammon.h"
 #include "drawboard.h"
 #include "external.h"
 #include "rollout.h"
 #include "eval.h"
 #include "matchid.h"
+#include "multithread.h"
 #include "lib/gnubg-types.h"
 
 #if HAVE_SOCKETS
@@ -438,14 +442,55 @@ ExtEvaluation(scancontext * pec)
     return szResponse;
 }
 
+/* The cube decision for the external player, within rSeconds if that is
+ * positive and the cube is evaluated rather than rolled out */
+static int
+ExtCubeDecision(float aarOutput[2][NUM_ROLLOUT_OUTPUTS], ConstTanBoard anBoard, cubeinfo * pci, double rSeconds)
+{
+    evalsetup *pes = GetEvalCube();
+    float aarStdDev[2][NUM_ROLLOUT_OUTPUTS];
+    rolloutstat aarsStatistics[2][2];
+
+    if (rSeconds > 0.0 && pes->et == EVAL_EVAL) {
+        evalcontext ec = pes->ec;
+
+        return CubeDecisionBudget(aarOutput, anBoard, pci, &ec, rSeconds);
+    }
+
+    return GeneralCubeDecision(aarOutput, aarStdDev, aarsStatistics, anBoard, pci, pes, NULL, NULL);
+}
+
+/* The move for the external player, within rSeconds if that is positive */
+static int
+ExtFindMove(int anMove[8], int nDice0, int nDice1, TanBoard anBoard, cubeinfo * pci, double rSeconds)
+{
+    movelist ml;
+
+    if (rSeconds <= 0.0)
+        return FindBestMove(anMove, nDice0, nDice1, anBoard, pci, &GetEvalChequer()->ec, *GetEvalMoveFilter());
+
+    if (FindBestMovesBudget(&ml, nDice0, nDice1, (ConstTanBoard) anBoard, pci, &GetEvalChequer()->ec,
+                            *GetEvalMoveFilter(), rSeconds) < 0)
+        return -1;
+
+    if (ml.cMoves)
+        memcpy(anMove, ml.amMoves[0].anMove, sizeof(ml.amMoves[0].anMove));
+    else
+        memset(anMove, -1, 8 * sizeof(int));
+
+    g_free(ml.amMoves);
+
+    return 0;
+}
+
 static char *
 ExtFIBSBoard(scancontext * pec)
 {
     ProcessedFIBSBoard processedBoard;
     TanBoard anBoardOrig;
     int anScore[2], anMove[8], fTurn;
-    float arDouble[NUM_CUBEFUL_OUTPUTS], aarOutput[2][NUM_ROLLOUT_OUTPUTS], aarStdDev[2][NUM_ROLLOUT_OUTPUTS];
-    rolloutstat aarsStatistics[2][2];
+    float arDouble[NUM_CUBEFUL_OUTPUTS], aarOutput[2][NUM_ROLLOUT_OUTPUTS];
+    double rSeconds = pec->rTime > 0.0f ? pec->rTime : rTimeBudget;
     cubeinfo ci;
     char *szResponse;
 
@@ -478,9 +523,7 @@ ExtFIBSBoard(scancontext * pec)
         SetCubeInfo(&ci, processedBoard.nCube, processedBoard.fCubeOwner, fTurn, processedBoard.nMatchTo, anScore,
                     processedBoard.fCrawford, processedBoard.fJacoby, nBeavers, bgvDefault);
 
-        if (GeneralCubeDecision(aarOutput, aarStdDev,
-                                aarsStatistics, (ConstTanBoard) processedBoard.anBoard, &ci, GetEvalCube(), NULL,
-                                NULL) < 0)
+        if (ExtCubeDecision(aarOutput, (ConstTanBoard) processedBoard.anBoard, &ci, rSeconds) < 0)
             return NULL;
 
         switch (FindCubeDecision(arDouble, aarOutput, &ci)) {
@@ -540,17 +583,15 @@ ExtFIBSBoard(scancontext * pec)
     } else if (processedBoard.anDice[0]) {
         /* move */
         char szMove[FORMATEDMOVESIZE];
-        if (FindBestMove(anMove, processedBoard.anDice[0], processedBoard.anDice[1],
-                         processedBoard.anBoard, &ci, &GetEvalChequer()->ec, *GetEvalMoveFilter()) < 0)
+        if (ExtFindMove(anMove, processedBoard.anDice[0], processedBoard.anDice[1],
+                        processedBoard.anBoard, &ci, rSeconds) < 0)
             return NULL;
 
         FormatMovePlain(szMove, (ConstTanBoard)anBoardOrig, anMove);
         szResponse = g_strconcat(szMove, "\n", NULL);
     } else {
         /* double decision */
-        if (GeneralCubeDecision(aarOutput, aarStdDev,
-                                aarsStatistics, (ConstTanBoard) processedBoard.anBoard, &ci, GetEvalCube(),
-                                NULL, NULL) < 0)
+        if (ExtCubeDecision(aarOutput, (ConstTanBoard) processedBoard.anBoard, &ci, rSeconds) < 0)
             return NULL;
 
         switch (FindCubeDecision(arDouble, aarOutput, &ci)) {
@@ -595,267 +636,600 @@ ExtFIBSBoard(scancontext * pec)
 
     return szResponse;
 }
-#endif
 
-extern void
-CommandExternal(char *sz)
+/* A connection to the external server. Clients may send commands
+ * without waiting for the responses. The main thread parses them in
+ * order with the client's parser; board evaluations are then done in
+ * parallel on the thread pool, for all clients at once, and the
+ * responses written back in the order of the commands.
+ *
+ * A command may be prefixed with "@<id> ", and then every line of its
+ * response is prefixed with the same "@<id> ". */
+
+typedef struct {
+    char *szId;                 /* "@<id> " or NULL */
+    int fEvaluate;              /* scanctx still has to be evaluated */
+    scancontext scanctx;        /* the parsed board and options */
+    GString *gsOut;             /* response */
+} extrequest;
+
+typedef struct {
+    int h;
+    scancontext scanctx;
+    GString *gsIn;              /* received, but not parsed yet */
+    GPtrArray *paRequests;      /* extrequests parsed, not answered yet */
+    GString *gsOut;             /* answered, but not written yet */
+    int fExit;                  /* close after answering paRequests */
+    int fClosed;                /* the connection failed */
+} extclient;
+
+/* a client sending longer lines is disconnected */
+#define EXTERNAL_MAX_LINE 65536
+
+/* no more commands are read from a client while this much of its
+ * output is waiting to be written */
+#define EXTERNAL_MAX_PENDING 65536
+
+/* commands parsed from a client before they are answered */
+#define EXTERNAL_MAX_PIPELINE 256
+
+static void
+ExtDebugBoard(scancontext * pscanctx, GString * gsOut)
 {
+    ProcessedFIBSBoard processedBoard;
+    GValue *optionsmapgv;
+    GValue *boarddatagv;
+    GString *dbgStr;
+    int anScore[2];
+    int fcrawford, fjacoby;
+    char *asz[7] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+    char szBoard[10000];
+    char **aszLines, **aszLinesOrig;
+    char *szMatchID;
+
+    optionsmapgv = (GValue *) g_list_nth_data(g_value_get_boxed(pscanctx->pCmdData), 1);
+    boarddatagv = (GValue *) g_list_nth_data(g_value_get_boxed(pscanctx->pCmdData), 0);
+    dbgStr = g_string_new(DEBUG_PREFIX);
+    g_value_tostring(dbgStr, optionsmapgv, 0);
+    g_string_append(dbgStr, "\n" DEBUG_PREFIX);
+    g_value_tostring(dbgStr, boarddatagv, 0);
+    g_string_append(dbgStr, "\n" DEBUG_PREFIX "\n");
+    g_string_append(gsOut, dbgStr->str);
+    ProcessFIBSBoardInfo(&pscanctx->bi, &processedBoard);
+
+    anScore[0] = processedBoard.nScoreOpp;
+    anScore[1] = processedBoard.nScore;
+    /* If the session isn't using Crawford rule, set Crawford flag to false */
+    fcrawford = pscanctx->fCrawfordRule ? processedBoard.fCrawford : FALSE;
+    /* Set the Jacoby flag appropriately from the external interface settings */
+    fjacoby = pscanctx->fJacobyRule;
+
+    /* MatchID returns a static buffer */
+    MT_Exclusive();
+    szMatchID = MatchID((unsigned int *) processedBoard.anDice, 1, processedBoard.nResignation,
+                        processedBoard.fDoubled, 1, processedBoard.fCubeOwner, fcrawford,
+                        processedBoard.nMatchTo, anScore, processedBoard.nCube, fjacoby, GAME_PLAYING);
+
+    DrawBoard(szBoard, (ConstTanBoard) & processedBoard.anBoard, 1, asz, szMatchID, 15);
+    MT_Release();
+
+    aszLines = g_strsplit(&szBoard[0], "\n", 32);
+    aszLinesOrig = aszLines;
+    while (*aszLines) {
+        g_string_append(gsOut, DEBUG_PREFIX);
+        g_string_append(gsOut, *aszLines);
+        g_string_append(gsOut, "\n");
+        aszLines++;
+    }
 
-#if !defined(HAVE_SOCKETS)
-    (void) sz;                  /* silence compiler warning */
-    outputl(_("This installation of GNU Backgammon was compiled without\n"
-              "socket support, and does not implement external controllers."));
-#else
-    int h, hPeer, cb;
-    struct sockaddr *psa;
-    char szCommand[256];
+    dbgStr = g_string_assign(dbgStr, "");
+    g_string_append_printf(dbgStr, DEBUG_PREFIX "X is %s, O is %s\n", processedBoard.szPlayer, processedBoard.szOpp);
+    if (processedBoard.nMatchTo) {
+        g_string_append_printf(dbgStr, DEBUG_PREFIX "Match Play %s Crawford Rule\n",
+                               pscanctx->fCrawfordRule ? "with" : "without");
+        g_string_append_printf(dbgStr, DEBUG_PREFIX "Score: %d-%d/%d%s, ", processedBoard.nScore,
+                               processedBoard.nScoreOpp, processedBoard.nMatchTo, fcrawford ? "*" : "");
+    } else {
+        g_string_append_printf(dbgStr, DEBUG_PREFIX "Money Session %s Jacoby Rule, %s Beavers\n",
+                               pscanctx->fJacobyRule ? "with" : "without", pscanctx->fBeavers ? "with" : "without");
+        g_string_append_printf(dbgStr, DEBUG_PREFIX "Score: %d-%d, ", processedBoard.nScore,
+                               processedBoard.nScoreOpp);
+    }
+    g_string_append_printf(dbgStr, "Roll: %d%d\n", processedBoard.anDice[0], processedBoard.anDice[1]);
+    g_string_append_printf(dbgStr,
+                           DEBUG_PREFIX "CubeOwner: %d, Cube: %d, Turn: %c, Doubled: %d, Resignation: %d\n",
+                           processedBoard.fCubeOwner, processedBoard.nCube, 'X',
+                           processedBoard.fDoubled, processedBoard.nResignation);
+    g_string_append(dbgStr, DEBUG_PREFIX "\n");
+    g_string_append(gsOut, dbgStr->str);
+
+    g_string_free(dbgStr, TRUE);
+    g_strfreev(aszLinesOrig);
+}
+
+/* Parses szCommand. Everything but board evaluations is answered at
+ * once; for those, the parsed state is moved to preq for ExtEvaluate. */
+
+static void
+ExtCommand(extclient * pxc, extrequest * preq, const char *szCommand)
+{
+    scancontext *pscanctx = &pxc->scanctx;
     char *szResponse = NULL;
-    struct sockaddr_in saRemote;
-    socklen_t saLen;
-    scancontext scanctx;
-    int fExit;
-    int fRestart = TRUE;
-    int retval = 0;
 
-    sz = NextToken(&sz);
+    if ((ExtParse(pscanctx, szCommand)) == 0) {
+        /* parse error */
+        szResponse = pscanctx->szError;
+        pscanctx->szError = NULL;
+    } else {
+        gchar *szOptStr;
 
-    if (!sz || !*sz) {
-        outputl(_("You must specify the name of the socket to the external controller."));
+        switch (pscanctx->ct) {
+        case COMMAND_HELP:
+            szResponse = g_strdup("\tNo help information available\n");
+            break;
+
+        case COMMAND_SET:
+            szOptStr = g_value_get_gstring_gchar(g_list_nth_data(pscanctx->pCmdData, 0));
+            if (g_ascii_strcasecmp(szOptStr, KEY_STR_DEBUG) == 0) {
+                pscanctx->fDebug = g_value_get_int(g_list_nth_data(pscanctx->pCmdData, 1));
+                szResponse = g_strdup_printf("Debug output %s\n", pscanctx->fDebug ? "ON" : "OFF");
+            } else if (g_ascii_strcasecmp(szOptStr, KEY_STR_NEWINTERFACE) == 0) {
+                pscanctx->fNewInterface = g_value_get_int(g_list_nth_data(pscanctx->pCmdData, 1));
+                szResponse = g_strdup_printf("New interface %s\n", pscanctx->fNewInterface ? "ON" : "OFF");
+            } else {
+                szResponse = g_strdup_printf("Error: set option '%s' not supported\n", szOptStr);
+            }
+            g_list_gv_boxed_free(pscanctx->pCmdData);
+
+            break;
+
+        case COMMAND_VERSION:
+            szResponse = g_strdup("Interface: " EXTERNAL_INTERFACE_VERSION "\n"
+                                  "RFBF: " RFBF_VERSION_SUPPORTED "\n"
+                                  "Engine: " WEIGHTS_VERSION "\n" "Software: " VERSION "\n");
+
+            break;
+
+        case COMMAND_NONE:
+            szResponse = g_strdup("Error: no command given\n");
+            break;
+
+        case COMMAND_FIBSBOARD:
+        case COMMAND_EVALUATION:
+            /* the request takes over the board names and command data */
+            memcpy(&preq->scanctx, pscanctx, sizeof(preq->scanctx));
+            preq->scanctx.scanner = NULL;
+            preq->fEvaluate = TRUE;
+            pscanctx->bi.gsName = NULL;
+            pscanctx->bi.gsOpp = NULL;
+            pscanctx->pCmdData = NULL;
+            break;
+
+        case COMMAND_EXIT:
+            pxc->fExit = TRUE;
+            break;
+
+        default:
+            szResponse = g_strdup("Unsupported Command\n");
+        }
+        unset_scan_context(pscanctx, FALSE);
+    }
+
+    if (szResponse) {
+        g_string_append(preq->gsOut, szResponse);
+        g_free(szResponse);
+    }
+}
+
+/* Evaluates a board request. This may run in a thread of the pool, so
+ * it must not output anything. */
+
+static void
+ExtEvaluate(void *p)
+{
+    extrequest *preq = p;
+    scancontext *pscanctx = &preq->scanctx;
+    char *szResponse;
+
+    if (pscanctx->fDebug)
+        ExtDebugBoard(pscanctx, preq->gsOut);
+    g_value_unsetfree(pscanctx->pCmdData);
+
+    if (pscanctx->ct == COMMAND_EVALUATION)
+        szResponse = ExtEvaluation(pscanctx);
+    else
+        szResponse = ExtFIBSBoard(pscanctx);
+
+    /* every request gets a reply */
+    if (szResponse) {
+        g_string_append(preq->gsOut, szResponse);
+        g_free(szResponse);
+    } else
+        g_string_append(preq->gsOut, "Error: evaluation failed\n");
+
+    unset_scan_context(pscanctx, FALSE);
+    preq->fEvaluate = FALSE;
+}
+
+static void
+ExtFreeRequest(extrequest * preq)
+{
+    if (preq->fEvaluate) {
+        g_value_unsetfree(preq->scanctx.pCmdData);
+        unset_scan_context(&preq->scanctx, FALSE);
+    }
+
+    g_free(preq->szId);
+    g_string_free(preq->gsOut, TRUE);
+    g_free(preq);
+}
+
+/* Appends the response of preq to gs, tagged with its id */
+
+static void
+ExtAppendResponse(GString * gs, const extrequest * preq)
+{
+    const char *pch = preq->gsOut->str;
+
+    if (!preq->szId) {
+        g_string_append_len(gs, preq->gsOut->str, (gssize) preq->gsOut->len);
         return;
     }
 
-    memset(&scanctx, 0, sizeof(scanctx));
-    ExtInitParse(&scanctx.scanner);
+    while (*pch) {
+        const char *pchEnd = strchr(pch, '\n');
+        gsize cch = pchEnd ? (gsize) (pchEnd - pch) + 1 : strlen(pch);
 
-  listenloop:
-    {
-        fExit = FALSE;
-        scanctx.fDebug = FALSE;
-        scanctx.fNewInterface = FALSE;
+        g_string_append(gs, preq->szId);
+        g_string_append_len(gs, pch, (gssize) cch);
+        pch += cch;
+    }
+}
 
-        if ((h = ExternalSocket(&psa, &cb, sz)) < 0) {
-            SockErr(sz);
-            ExtDestroyParse(scanctx.scanner);
-            return;
-        }
+/* The server waits for all its clients in one select() loop, so their
+ * sockets must not block it */
 
-        if (bind(h, psa, cb) < 0) {
-            SockErr(sz);
-            closesocket(h);
-            g_free(psa);
-            ExtDestroyParse(scanctx.scanner);
-            return;
-        }
+static int
+ExtSetNonBlocking(int h)
+{
+#ifdef WIN32
+    u_long f = 1;
 
-        g_free(psa);
+    return ioctlsocket((SOCKET) h, FIONBIO, &f) ? -1 : 0;
+#else
+    int f = fcntl(h, F_GETFL);
 
-        if (listen(h, 1) < 0) {
-            SockErr("listen");
-            closesocket(h);
-            ExternalUnbind(sz);
-            ExtDestroyParse(scanctx.scanner);
-            return;
-        }
-        outputf(_("Waiting for a connection from %s...\n"), sz);
-        outputx();
-        ProcessEvents();
+    return f < 0 ? -1 : fcntl(h, F_SETFL, f | O_NONBLOCK);
+#endif
+}
+
+static int
+ExtWouldBlock(void)
+{
+#ifdef WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+static extclient *
+ExtNewClient(int h)
+{
+    extclient *pxc = g_new0(extclient, 1);
+
+    pxc->h = h;
+    ExtInitParse(&pxc->scanctx.scanner);
+    pxc->gsIn = g_string_new(NULL);
+    pxc->paRequests = g_ptr_array_new();
+    pxc->gsOut = g_string_new(NULL);
 
-        /* Must set length when using windows */
-        saLen = sizeof(struct sockaddr);
-        while ((hPeer = accept(h, (struct sockaddr *) &saRemote, &saLen)) < 0) {
-            if (errno == EINTR) {
-                ProcessEvents();
+    return pxc;
+}
+
+static void
+ExtFreeClient(extclient * pxc)
+{
+    guint i;
+
+    closesocket(pxc->h);
+    unset_scan_context(&pxc->scanctx, TRUE);
+    g_string_free(pxc->gsIn, TRUE);
+    for (i = 0; i < pxc->paRequests->len; i++)
+        ExtFreeRequest(g_ptr_array_index(pxc->paRequests, i));
+    g_ptr_array_free(pxc->paRequests, TRUE);
+    g_string_free(pxc->gsOut, TRUE);
+    g_free(pxc);
+}
+
+/* Reads what the client has sent. Returns FALSE if the connection was
+ * closed or failed. */
+
+static int
+ExtReceive(extclient * pxc)
+{
+    char ach[4096];
+#ifndef WIN32
+    ssize_t n;
+#else
+    int n;
+#endif
+
+    do
+        n = recv(pxc->h, ach, sizeof(ach), 0);
+    while (n < 0 && errno == EINTR && !fInterrupt);
+
+    if (!n) {
+        outputl(_("External connection closed."));
+        return FALSE;
+    } else if (n < 0) {
+        if (ExtWouldBlock())
+            return TRUE;
 
-                if (fInterrupt) {
-                    closesocket(h);
-                    ExternalUnbind(sz);
-                    ExtDestroyParse(scanctx.scanner);
-                    return;
-                }
+        SockErr(_("reading from external connection"));
+        return FALSE;
+    }
+
+    g_string_append_len(pxc->gsIn, ach, n);
+
+    return pxc->gsIn->len < EXTERNAL_MAX_LINE || memchr(pxc->gsIn->str, '\n', pxc->gsIn->len);
+}
 
+/* Writes as much of pxc->gsOut as the client will take now. Returns
+ * FALSE if the connection failed. */
+
+static int
+ExtSend(extclient * pxc)
+{
+#ifndef WIN32
+    ssize_t n;
+    psighandler sh;
+#else
+    int n;
+#endif
+
+    while (pxc->gsOut->len) {
+#ifndef WIN32
+        PortableSignal(SIGPIPE, SIG_IGN, &sh, FALSE);
+        n = write(pxc->h, pxc->gsOut->str, pxc->gsOut->len);
+        PortableSignalRestore(SIGPIPE, &sh);
+#else
+        n = send((SOCKET) pxc->h, pxc->gsOut->str, (int) pxc->gsOut->len, 0);
+#endif
+
+        if (!n)
+            return TRUE;
+        else if (n < 0) {
+            if (errno == EINTR)
                 continue;
-            }
+            if (ExtWouldBlock())
+                return TRUE;
 
-            SockErr("accept");
-            closesocket(h);
-            ExternalUnbind(sz);
-            ExtDestroyParse(scanctx.scanner);
-            return;
+            SockErr(_("writing to external connection"));
+            return FALSE;
         }
 
-        closesocket(h);
-        ExternalUnbind(sz);
+        g_string_erase(pxc->gsOut, 0, n);
+    }
 
-        /* print info about remove client */
+    return TRUE;
+}
+
+/* Parses the first complete line of pxc->gsIn, if there is one */
 
-        outputf(_("Accepted connection from %s.\n"), inet_ntoa(saRemote.sin_addr));
-        outputx();
+static extrequest *
+ExtNextRequest(extclient * pxc)
+{
+    char *pch = memchr(pxc->gsIn->str, '\n', pxc->gsIn->len);
+    char *szCommand, *pchCommand;
+    extrequest *preq;
+
+    if (!pch)
+        return NULL;
+
+    /* To keep lexer happy terminate each line with \n */
+    szCommand = g_strndup(pxc->gsIn->str, (gsize) (pch - pxc->gsIn->str) + 1);
+    g_string_erase(pxc->gsIn, 0, (pch - pxc->gsIn->str) + 1);
+
+    preq = g_new0(extrequest, 1);
+    preq->gsOut = g_string_new(NULL);
+
+    pchCommand = szCommand;
+    if (*pchCommand == '@') {
+        gsize cch = strcspn(pchCommand, " \t\n");
+
+        preq->szId = g_strdup_printf("%.*s ", (int) cch, pchCommand);
+        pchCommand += cch;
+        pchCommand += strspn(pchCommand, " \t");
+    }
+
+    ExtCommand(pxc, preq, pchCommand);
+    g_free(szCommand);
+
+    return preq;
+}
+
+static void
+ExternalServe(int h)
+{
+    GPtrArray *pa = g_ptr_array_new();
+    GPtrArray *paEval = g_ptr_array_new();
+    guint i, j;
+
+    while (!fInterrupt) {
+        fd_set fds, fdsOut;
+        struct timeval tv;
+        int hMax = h, n;
+
+        /* wake up now and then for the user interface and interrupts,
+         * or at once if a client has commands we have not parsed yet;
+         * a client with too much unwritten output is only written to */
+        tv.tv_sec = 0;
+        tv.tv_usec = 100000;
+
+        FD_ZERO(&fds);
+        FD_ZERO(&fdsOut);
+        FD_SET(h, &fds);
+        for (i = 0; i < pa->len; i++) {
+            extclient *pxc = g_ptr_array_index(pa, i);
+
+            hMax = MAX(hMax, pxc->h);
+            if (pxc->gsOut->len)
+                FD_SET(pxc->h, &fdsOut);
+            if (pxc->fExit || pxc->gsOut->len >= EXTERNAL_MAX_PENDING)
+                continue;
+            FD_SET(pxc->h, &fds);
+            if (memchr(pxc->gsIn->str, '\n', pxc->gsIn->len))
+                tv.tv_usec = 0;
+        }
+
+        n = select(hMax + 1, &fds, &fdsOut, NULL, &tv);
         ProcessEvents();
 
-        while (!fExit && !(retval = ExternalRead(hPeer, szCommand, sizeof(szCommand)))) {
-            /* To keep lexer happy terminate each line with \n */
-            if (szCommand[strlen(szCommand) - 1] != '\n')
-                strcat(szCommand, "\n");
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+
+            SockErr("select");
+            break;
+        }
+
+        if (FD_ISSET(h, &fds)) {
+            struct sockaddr_in saRemote;
+            /* Must set length when using windows */
+            socklen_t saLen = sizeof(struct sockaddr);
+            int hPeer = accept(h, (struct sockaddr *) &saRemote, &saLen);
 
-            if ((ExtParse(&scanctx, szCommand)) == 0) {
-                /* parse error */
-                szResponse = scanctx.szError;
+            if (hPeer < 0) {
+                if (errno != EINTR)
+                    SockErr("accept");
+#ifndef WIN32
+            } else if (hPeer >= FD_SETSIZE) {
+                outputl(_("Too many external connections, connection refused."));
+                closesocket(hPeer);
+#endif
+            } else if (ExtSetNonBlocking(hPeer) < 0) {
+                SockErr("accept");
+                closesocket(hPeer);
             } else {
-                ProcessedFIBSBoard processedBoard;
-                gchar *szOptStr;
-
-                switch (scanctx.ct) {
-                case COMMAND_HELP:
-                    szResponse = g_strdup("\tNo help information available\n");
-                    break;
-
-                case COMMAND_SET:
-                    szOptStr = g_value_get_gstring_gchar(g_list_nth_data(scanctx.pCmdData, 0));
-                    if (g_ascii_strcasecmp(szOptStr, KEY_STR_DEBUG) == 0) {
-                        scanctx.fDebug = g_value_get_int(g_list_nth_data(scanctx.pCmdData, 1));
-                        szResponse = g_strdup_printf("Debug output %s\n", scanctx.fDebug ? "ON" : "OFF");
-                    } else if (g_ascii_strcasecmp(szOptStr, KEY_STR_NEWINTERFACE) == 0) {
-                        scanctx.fNewInterface = g_value_get_int(g_list_nth_data(scanctx.pCmdData, 1));
-                        szResponse = g_strdup_printf("New interface %s\n", scanctx.fNewInterface ? "ON" : "OFF");
-                    } else {
-                        szResponse = g_strdup_printf("Error: set option '%s' not supported\n", szOptStr);
-                    }
-                    g_list_gv_boxed_free(scanctx.pCmdData);
-
-                    break;
-
-                case COMMAND_VERSION:
-                    szResponse = g_strdup("Interface: " EXTERNAL_INTERFACE_VERSION "\n"
-                                          "RFBF: " RFBF_VERSION_SUPPORTED "\n"
-                                          "Engine: " WEIGHTS_VERSION "\n" "Software: " VERSION "\n");
-
-                    break;
-
-                case COMMAND_NONE:
-                    szResponse = g_strdup("Error: no command given\n");
-                    break;
-
-                case COMMAND_FIBSBOARD:
-                case COMMAND_EVALUATION:
-                    if (scanctx.fDebug) {
-                        GValue *optionsmapgv;
-                        GValue *boarddatagv;
-                        GString *dbgStr;
-                        int anScore[2];
-                        int fcrawford, fjacoby;
-                        char *asz[7] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL };
-                        char szBoard[10000];
-                        char **aszLines, **aszLinesOrig;
-                        char *szMatchID;
-
-                        optionsmapgv = (GValue *) g_list_nth_data(g_value_get_boxed(scanctx.pCmdData), 1);
-                        boarddatagv = (GValue *) g_list_nth_data(g_value_get_boxed(scanctx.pCmdData), 0);
-                        dbgStr = g_string_new(DEBUG_PREFIX);
-                        g_value_tostring(dbgStr, optionsmapgv, 0);
-                        g_string_append(dbgStr, "\n" DEBUG_PREFIX);
-                        g_value_tostring(dbgStr, boarddatagv, 0);
-                        g_string_append(dbgStr, "\n" DEBUG_PREFIX "\n");
-                        ExternalWrite(hPeer, dbgStr->str, strlen(dbgStr->str));
-                        ProcessFIBSBoardInfo(&scanctx.bi, &processedBoard);
-
-                        anScore[0] = processedBoard.nScoreOpp;
-                        anScore[1] = processedBoard.nScore;
-                        /* If the session isn't using Crawford rule, set Crawford flag to false */
-                        fcrawford = scanctx.fCrawfordRule ? processedBoard.fCrawford : FALSE;
-                        /* Set the Jacoby flag appropriately from the external interface settings */
-                        fjacoby = scanctx.fJacobyRule;
-
-                        szMatchID = MatchID((unsigned int *) processedBoard.anDice, 1, processedBoard.nResignation,
-                                            processedBoard.fDoubled, 1, processedBoard.fCubeOwner, fcrawford,
-                                            processedBoard.nMatchTo, anScore, processedBoard.nCube, fjacoby,
-                                            GAME_PLAYING);
-
-                        DrawBoard(szBoard, (ConstTanBoard) & processedBoard.anBoard, 1, asz, szMatchID, 15);
-
-                        aszLines = g_strsplit(&szBoard[0], "\n", 32);
-                        aszLinesOrig = aszLines;
-                        while (*aszLines) {
-                            ExternalWrite(hPeer, DEBUG_PREFIX, strlen(DEBUG_PREFIX));
-                            ExternalWrite(hPeer, *aszLines, strlen(*aszLines));
-                            ExternalWrite(hPeer, "\n", 1);
-                            aszLines++;
-                        }
-
-                        dbgStr = g_string_assign(dbgStr, "");
-                        g_string_append_printf(dbgStr, DEBUG_PREFIX "X is %s, O is %s\n", processedBoard.szPlayer,
-                                               processedBoard.szOpp);
-                        if (processedBoard.nMatchTo) {
-                            g_string_append_printf(dbgStr, DEBUG_PREFIX "Match Play %s Crawford Rule\n",
-                                                   scanctx.fCrawfordRule ? "with" : "without");
-                            g_string_append_printf(dbgStr, DEBUG_PREFIX "Score: %d-%d/%d%s, ", processedBoard.nScore,
-                                                   processedBoard.nScoreOpp, processedBoard.nMatchTo,
-                                                   fcrawford ? "*" : "");
-                        } else {
-                            g_string_append_printf(dbgStr, DEBUG_PREFIX "Money Session %s Jacoby Rule, %s Beavers\n",
-                                                   scanctx.fJacobyRule ? "with" : "without",
-                                                   scanctx.fBeavers ? "with" : "without");
-                            g_string_append_printf(dbgStr, DEBUG_PREFIX "Score: %d-%d, ", processedBoard.nScore,
-                                                   processedBoard.nScoreOpp);
-                        }
-                        g_string_append_printf(dbgStr, "Roll: %d%d\n",
-                                               processedBoard.anDice[0], processedBoard.anDice[1]);
-                        g_string_append_printf(dbgStr,
-                                               DEBUG_PREFIX
-                                               "CubeOwner: %d, Cube: %d, Turn: %c, Doubled: %d, Resignation: %d\n",
-                                               processedBoard.fCubeOwner, processedBoard.nCube, 'X',
-                                               processedBoard.fDoubled, processedBoard.nResignation);
-                        g_string_append(dbgStr, DEBUG_PREFIX "\n");
-                        ExternalWrite(hPeer, dbgStr->str, strlen(dbgStr->str));
-
-                        g_string_free(dbgStr, TRUE);
-                        g_strfreev(aszLinesOrig);
-                    }
-                    g_value_unsetfree(scanctx.pCmdData);
-
-                    if (scanctx.ct == COMMAND_EVALUATION)
-                        szResponse = ExtEvaluation(&scanctx);
-                    else
-                        szResponse = ExtFIBSBoard(&scanctx);
-
-                    break;
-
-                case COMMAND_EXIT:
-                    closesocket(hPeer);
-                    fExit = TRUE;
-                    break;
-
-                default:
-                    szResponse = g_strdup("Unsupported Command\n");
-                }
-                unset_scan_context(&scanctx, FALSE);
+                /* print info about remote client */
+                outputf(_("Accepted connection from %s.\n"), inet_ntoa(saRemote.sin_addr));
+                outputx();
+                g_ptr_array_add(pa, ExtNewClient(hPeer));
             }
+        }
 
-            if (szResponse) {
-                /* outputf("%s", szResponse); */
-                if (ExternalWrite(hPeer, szResponse, strlen(szResponse)))
-                    break;
+        /* write what the clients are ready for, and parse what they
+         * have sent */
+        for (i = 0; i < pa->len; i++) {
+            extclient *pxc = g_ptr_array_index(pa, i);
+            extrequest *preq;
 
-                g_free(szResponse);
-                szResponse = NULL;
+            if ((FD_ISSET(pxc->h, &fdsOut) && !ExtSend(pxc)) || (FD_ISSET(pxc->h, &fds) && !ExtReceive(pxc))) {
+                pxc->fClosed = TRUE;
+                continue;
             }
 
+            while (!pxc->fExit && pxc->gsOut->len < EXTERNAL_MAX_PENDING &&
+                   pxc->paRequests->len < EXTERNAL_MAX_PIPELINE && (preq = ExtNextRequest(pxc)) != NULL) {
+                g_ptr_array_add(pxc->paRequests, preq);
+                if (preq->fEvaluate)
+                    g_ptr_array_add(paEval, preq);
+            }
         }
-        /* Interrupted : get out of listen loop */
-        if (retval == -2) {
-            ProcessEvents();
-            fRestart = FALSE;
+
+#if defined(USE_MULTITHREAD)
+        /* a command may start a rollout, which needs the pool itself */
+        if (MT_GetNumThreads() > 1 && paEval->len > 1 &&
+            GetEvalChequer()->et != EVAL_ROLLOUT && GetEvalCube()->et != EVAL_ROLLOUT) {
+            for (i = 0; i < paEval->len; i++)
+                mt_add_tasks(1, ExtEvaluate, g_ptr_array_index(paEval, i), NULL);
+            (void) MT_WaitForTasks(NULL, 0, FALSE);
+        } else
+#endif
+            for (i = 0; i < paEval->len && !fInterrupt; i++)
+                ExtEvaluate(g_ptr_array_index(paEval, i));
+
+        g_ptr_array_set_size(paEval, 0);
+
+        /* answer in the order of the commands; what a client does not
+         * take now is written when select() finds it writable */
+        for (i = pa->len; i-- > 0;) {
+            extclient *pxc = g_ptr_array_index(pa, i);
+
+            for (j = 0; j < pxc->paRequests->len; j++) {
+                extrequest *preq = g_ptr_array_index(pxc->paRequests, j);
+
+                ExtAppendResponse(pxc->gsOut, preq);
+                ExtFreeRequest(preq);
+            }
+            g_ptr_array_set_size(pxc->paRequests, 0);
+
+            if (!pxc->fClosed && !ExtSend(pxc))
+                pxc->fClosed = TRUE;
+
+            if ((pxc->fExit && !pxc->gsOut->len) || pxc->fClosed) {
+                ExtFreeClient(pxc);
+                g_ptr_array_remove_index(pa, i);
+            }
         }
+    }
+
+    for (i = 0; i < pa->len; i++)
+        ExtFreeClient(g_ptr_array_index(pa, i));
+
+    g_ptr_array_free(pa, TRUE);
+    g_ptr_array_free(paEval, TRUE);
+}
+#endif
+
+extern void
+CommandExternal(char *sz)
+{
 
-        closesocket(hPeer);
-        if (szResponse)
-            g_free(szResponse);
+#if !defined(HAVE_SOCKETS)
+    (void) sz;                  /* silence compiler warning */
+    outputl(_("This installation of GNU Backgammon was compiled without\n"
+              "socket support, and does not implement external controllers."));
+#else
+    int h, cb;
+    struct sockaddr *psa;
+
+    sz = NextToken(&sz);
 
-        szResponse = NULL;
-        scanctx.szError = NULL;
+    if (!sz || !*sz) {
+        outputl(_("You must specify the name of the socket to the external controller."));
+        return;
     }
-    if (fRestart)
-        goto listenloop;
 
-    unset_scan_context(&scanctx, TRUE);
+    if ((h = ExternalSocket(&psa, &cb, sz)) < 0) {
+        SockErr(sz);
+        return;
+    }
+
+    if (bind(h, psa, cb) < 0) {
+        SockErr(sz);
+        closesocket(h);
+        g_free(psa);
+        return;
+    }
+
+    g_free(psa);
+
+    if (listen(h, SOMAXCONN) < 0) {
+        SockErr("listen");
+        closesocket(h);
+        ExternalUnbind(sz);
+        return;
+    }
+    outputf(_("Waiting for connections from %s...\n"), sz);
+    outputx();
+    ProcessEvents();
+
+    /* serve clients until interrupted */
+    ExternalServe(h);
+
+    closesocket(h);
+    ExternalUnbind(sz);
 #endif
 }
@@ -41,6 +41,7 @@ extern void ExtDestroyParse(void *scancontext);
 #define KEY_STR_NOISE "noise"
 #define KEY_STR_CUBEFUL "cubeful"
 #define KEY_STR_PLIES "plies"
+#define KEY_STR_TIME "time"
 #define KEY_STR_NEWINTERFACE "newinterface"
 #define KEY_STR_DEBUG "debug"
 #define KEY_STR_PROMPT "prompt"
@@ -177,6 +178,7 @@ typedef struct scancontext {
     int fCrawfordRule;
     int nResignation;
     int fBeavers;
+    float rTime;                /* seconds per decision, 0 for "set timebudget" */
 
     /* fibs board */
     union {
@@ -200,7 +202,8 @@ typedef struct scancontext {
 #include <winsock2.h>
 #endif                          /* #ifndef WIN32 */
 
-#define EXTERNAL_INTERFACE_VERSION "2"
+/* 3: pipelined commands tagged with "@<id> " */
+#define EXTERNAL_INTERFACE_VERSION "3"
 #define RFBF_VERSION_SUPPORTED "0"
 
 extern int ExternalSocket(struct sockaddr **ppsa, int *pcb, char *sz);
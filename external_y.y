@@ -129,7 +129,7 @@ void yyerror(scancontext *scanner, const char *str)
 %token DEBUG SET NEW OLD OUTPUT E_INTERFACE HELP PROMPT
 %token E_STRING E_CHARACTER E_INTEGER E_FLOAT E_BOOLEAN
 %token FIBSBOARD FIBSBOARDEND EVALUATION
-%token CRAWFORDRULE JACOBYRULE RESIGNATION BEAVERS
+%token CRAWFORDRULE JACOBYRULE RESIGNATION BEAVERS TIME
 %token CUBE CUBEFUL CUBELESS DETERMINISTIC NOISE PLIES PRUNE
 
 %type <bool>        E_BOOLEAN
@@ -237,6 +237,7 @@ commands:
                     extcmd->fDeterministic = g_value_get_int(str2gv_map_get_key_value(optionsmap, KEY_STR_DETERMINISTIC, gvtrue));
                     extcmd->nResignation = g_value_get_int(str2gv_map_get_key_value(optionsmap, KEY_STR_RESIGNATION, gvfalse));
                     extcmd->fBeavers = g_value_get_int(str2gv_map_get_key_value(optionsmap, KEY_STR_BEAVERS, gvtrue));
+                    extcmd->rTime = g_value_get_float(str2gv_map_get_key_value(optionsmap, KEY_STR_TIME, gvfloatzero));
 
                     g_value_unsetfree(gvtrue);
                     g_value_unsetfree(gvfalse);
@@ -346,6 +347,19 @@ sessionoption:
         { 
             $$ = create_str2gvalue_tuple (KEY_STR_BEAVERS, $2);
         }
+    | 
+    TIME float_type
+        { 
+            $$ = create_str2gvalue_tuple (KEY_STR_TIME, $2);
+        }
+    |
+    TIME integer_type
+        {
+            float floatval = (float) g_value_get_int($2);
+            GVALUE_CREATE(G_TYPE_FLOAT, float, floatval, gvfloat); 
+            $$ = create_str2gvalue_tuple (KEY_STR_TIME, gvfloat); 
+            g_value_unsetfree($2);
+        }
     ;
     
 evaloption:
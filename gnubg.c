@@ -49,6 +49,7 @@ static char szCommandSeparators[] = " \t\n\r\v\f";
 #endif
 
 #include "analysis.h"
+#include "anytime.h"
 #include "backgammon.h"
 #include "dice.h"
 #include "drawboard.h"
@@ -69,6 +70,7 @@ static char szCommandSeparators[] = " \t\n\r\v\f";
 #include "credits.h"
 #include "external.h"
 #include "neuralnet.h"
+#include "snapshot.h"
 #include "util.h"
 
 #if defined(LIBCURL_PROTOCOL_HTTPS)
@@ -480,10 +482,12 @@ char player1aliases[256] = "";
 
 /* Usage strings */
 static char szDICE[] = N_("<die> <die>"),
+    szCALIBRATE[] = N_("[iterations|threads [maximum]]"),
     szCOMMAND[] = N_("<command>"),
     szCOMMENT[] = N_("<comment>"),
     szER[] = "evaluation|rollout",
     szFILENAME[] = N_("<filename>"),
+    szHINT[] = N_("[moves] [seconds]"),
     szKEYVALUE[] = N_("[<key>=<value> ...]"),
     szLENGTH[] = N_("<length>"),
     szLIMIT[] = N_("<limit>"),
@@ -505,6 +509,7 @@ static char szDICE[] = N_("<die> <die>"),
     szOPTNAME[] = N_("[name]"),
     szOPTPOSITION[] = N_("[position]"),
     szOPTSEED[] = N_("[seed]"),
+    szOPTSOCKETS[] = N_("[socket ...]"),
     szOPTVALUE[] = N_("[value]"),
     szPLAYER[] = N_("<player>"),
     szPLAYEROPTRATING[] = N_("<player> [rating]"),
@@ -513,9 +518,13 @@ static char szDICE[] = N_("<die> <die>"),
     szPRIORITY[] = N_("<priority>"),
     szPROMPT[] = N_("<prompt>"),
     szSCORE[] = N_("<score> [length]"),
+    szSECONDS[] = N_("<seconds>"),
+    szSELFPLAY[] = N_("<games> <filename> [seed]"),
     szSIZE[] = N_("<size>"),
+    szSOCKET[] = N_("<socket>"),
     szSTEP[] = N_("[game|roll|rolled|marked] <count>"),
     szTRIALS[] = N_("<trials>"),
+    szTUNEFILTERS[] = N_("<dataset> <plies> [changed best moves in %]"),
     szVALUE[] = N_("<value>"),
     szMATCHID[] = N_("<matchid>"),
     szGNUBGID[] = N_("<gnubgid>"),
@@ -2270,6 +2279,21 @@ hint_take(int show, int did_take)
             (pmr->CubeDecPtr->aarOutput, pmr->CubeDecPtr->aarStdDev, &pmr->CubeDecPtr->esDouble, &ci, 1));
 }
 
+/* Shows a level of an anytime hint as it completes */
+
+static void
+HintLevel(unsigned int nPlies, const movelist * pml, void *UNUSED(p))
+{
+    char szMove[FORMATEDMOVESIZE];
+
+    if (!pml->cMoves)
+        return;
+
+    outputf(_("%u-ply: %s (%+.3f)\n"), nPlies, FormatMove(szMove, msBoard(), pml->amMoves[0].anMove),
+            pml->amMoves[0].rScore);
+    outputx();
+}
+
 extern void
 hint_move(char *sz, gboolean show, procrecorddata * procdatarec)
 {
@@ -2277,6 +2301,8 @@ hint_move(char *sz, gboolean show, procrecorddata * procdatarec)
     char szBuf[1024];
     int parse_n = ParseNumber(&sz);
     unsigned int n = (parse_n <= 0) ? 10 : parse_n;
+    /* a time limit asks for an anytime hint */
+    float rSeconds = ParseReal(&sz);
     moverecord *pmr;
     cubeinfo ci;
     int hist;
@@ -2293,7 +2319,26 @@ hint_move(char *sz, gboolean show, procrecorddata * procdatarec)
     if (!pmr)
         return;
 
-    if (pmr->esChequer.et == EVAL_NONE) {
+    if (pmr->esChequer.et == EVAL_NONE && rSeconds > 0.0f) {
+        evalsetup es = *GetEvalChequer();
+        int nPlies;
+
+        if (procdatarec) {
+            show = FALSE;
+            fShowProgress = (procdatarec->avInputData[PROCREC_HINT_ARGIN_SHOWPROGRESS] != NULL);
+        }
+        ProgressStart(_("Considering move..."));
+        nPlies = RunAnytime(&ml, ms.anDice[0], ms.anDice[1], msBoard(), &ci, &es.ec, *GetEvalMoveFilter(), rSeconds,
+                            show ? HintLevel : NULL, NULL);
+        ProgressEnd();
+        fShowProgress = fSaveShowProg;
+        if (nPlies < 0 || fInterrupt)
+            return;
+
+        /* the moves are only as deep as the last completed level */
+        es.ec.nPlies = (unsigned int) nPlies;
+        pmr_movelist_set(pmr, &es, &ml);
+    } else if (pmr->esChequer.et == EVAL_NONE) {
         fd.pml = &ml;
         fd.pboard = msBoard();
         fd.keyMove = NULL;
@@ -2324,16 +2369,19 @@ hint_move(char *sz, gboolean show, procrecorddata * procdatarec)
         pmr->n.iMove = locateMove(msBoard(), pmr->n.anMove, &pmr->ml);
         /* Tutor mode may have called asyncFindMove() above before
          * n.iMove was known. Do it again, ensuring that the actual
-         * move is evaluated at the best ply. */
-        fd.pml = &ml;
-        fd.pboard = msBoard();
-        fd.keyMove = &(pmr->ml.amMoves[pmr->n.iMove].key);
-        fd.rThr = arSkillLevel[SKILL_DOUBTFUL];
-        fd.pci = &ci;
-        fd.pec = &GetEvalChequer()->ec;
-        fd.aamf = *GetEvalMoveFilter();
-        asyncFindMove(&fd);
-        pmr_movelist_set(pmr, GetEvalChequer(), &ml);
+         * move is evaluated at the best ply, unless the hint has a time
+         * limit. */
+        if (rSeconds <= 0.0f) {
+            fd.pml = &ml;
+            fd.pboard = msBoard();
+            fd.keyMove = &(pmr->ml.amMoves[pmr->n.iMove].key);
+            fd.rThr = arSkillLevel[SKILL_DOUBTFUL];
+            fd.pci = &ci;
+            fd.pec = &GetEvalChequer()->ec;
+            fd.aamf = *GetEvalMoveFilter();
+            asyncFindMove(&fd);
+            pmr_movelist_set(pmr, GetEvalChequer(), &ml);
+        }
         find_skills(pmr, &ms, FALSE, -1);
     }
 
@@ -3197,11 +3245,14 @@ SavePlayerSettings(FILE * pf)
 static void
 SavePlayingSettings(FILE * pf)
 {
+    gchar buf[G_ASCII_DTOSTR_BUF_SIZE];
+
     fprintf(pf, "set automatic bearoff %s\n", fAutoBearoff ? "on" : "off");
     fprintf(pf, "set automatic crawford %s\n", fAutoCrawford ? "on" : "off");
     fprintf(pf, "set automatic game %s\n", fAutoGame ? "on" : "off");
     fprintf(pf, "set automatic move %s\n", fAutoMove ? "on" : "off");
     fprintf(pf, "set automatic roll %s\n", fAutoRoll ? "on" : "off");
+    fprintf(pf, "set timebudget %s\n", g_ascii_formatd(buf, G_ASCII_DTOSTR_BUF_SIZE, "%0.3g", rTimeBudget));
 }
 
 static void
@@ -3281,6 +3332,35 @@ SaveMiscSettings(FILE * pf)
     fprintf(pf, "set ratingoffset %s\n", g_ascii_formatd(buf, G_ASCII_DTOSTR_BUF_SIZE, "%f", rRatingOffset));
 }
 
+extern void
+CommandSaveSnapshot(char *sz)
+{
+    snapshotwriter *psw;
+    GError *pError = NULL;
+
+    sz = NextToken(&sz);
+
+    if (!sz || !*sz) {
+        outputl(_("You must specify a file to save to (see `help save snapshot')."));
+        return;
+    }
+
+    if (!confirmOverwrite(sz, fConfirmSave))
+        return;
+
+    psw = SnapshotWriterNew();
+    EvalSnapshotSave(psw);
+    METSnapshotSave(psw);
+
+    if (SnapshotWriterSave(psw, sz, &pError) < 0) {
+        outputerrf("%s: %s", sz, pError->message);
+        g_error_free(pError);
+        return;
+    }
+
+    outputf(_("Snapshot saved to %s.\n"), sz);
+}
+
 extern void
 CommandSaveSettings(char *szParam)
 {
@@ -4517,7 +4597,7 @@ main(int argc, char *argv[])
     char *pchMatch = NULL;
     char *met = NULL;
 
-    static char *pchCommands = NULL, *lang = NULL;
+    static char *pchCommands = NULL, *pchSnapshot = NULL, *lang = NULL;
     static int fNoBearoff = FALSE, fNoX = FALSE, fSplash = FALSE, fNoTTY = FALSE, show_version = FALSE, debug = FALSE;
     GOptionEntry ao[] = {
         {"no-bearoff", 'b', 0, G_OPTION_ARG_NONE, &fNoBearoff,
@@ -4535,6 +4615,8 @@ main(int argc, char *argv[])
          NULL},
         {"splash", 'S', 0, G_OPTION_ARG_NONE, &fSplash,
          N_("Show gtk splash screen"), NULL},
+        {"snapshot", 'm', 0, G_OPTION_ARG_FILENAME, &pchSnapshot,
+         N_("Start from the engine snapshot in FILE instead of gnubg.snap (\"\" for none)"), "FILE"},
         {"tty", 't', 0, G_OPTION_ARG_NONE, &fNoX,
          N_("Start the command-line instead of using the graphical interface"), NULL},
         {"version", 'v', 0, G_OPTION_ARG_NONE, &show_version,
@@ -4658,6 +4740,16 @@ main(int argc, char *argv[])
     PushSplash(pwSplash, _("Initialising"), _("Random number generator"));
     init_rng();
 
+    /* before the state it may hold is set up */
+    if (pchSnapshot) {
+        if (*pchSnapshot && !SnapshotOpen(pchSnapshot) && !g_file_test(pchSnapshot, G_FILE_TEST_EXISTS))
+            g_printerr(_("%s: No such snapshot\n"), pchSnapshot);
+    } else {
+        char *szSnapshot = BuildFilename("gnubg.snap");
+        (void) SnapshotOpen(szSnapshot);
+        g_free(szSnapshot);
+    }
+
     PushSplash(pwSplash, _("Initialising"), _("match equity table"));
     met = BuildFilename2("met", "Kazaross-XG2.xml");
     InitMatchEquity(met);
@@ -5305,6 +5397,14 @@ asyncFindMove(findData * pfd)
         MT_SetResultFailed();
 }
 
+void
+asyncFindMoveBudget(findData * pfd)
+{
+    if (FindBestMovesBudget(pfd->pml, ms.anDice[0], ms.anDice[1], pfd->pboard,
+                            pfd->pci, pfd->pec, pfd->aamf, rTimeBudget) < 0)
+        MT_SetResultFailed();
+}
+
 void
 asyncDumpDecision(decisionData * pdd)
 {
@@ -5362,6 +5462,14 @@ asyncCubeDecision(decisionData * pdd)
         MT_SetResultFailed();
 }
 
+/* pdd->pes must be a copy; its plies are set to those used */
+void
+asyncCubeDecisionBudget(decisionData * pdd)
+{
+    if (CubeDecisionBudget(pdd->aarOutput, pdd->pboard, pdd->pci, &pdd->pes->ec, rTimeBudget) < 0)
+        MT_SetResultFailed();
+}
+
 extern int
 RunAsyncProcess(AsyncFun fun, void *data, const char *msg)
 {
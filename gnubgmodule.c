@@ -25,14 +25,18 @@
 #endif
 
 #include <signal.h>
+#include <time.h>
 #include <glib.h>
 #include <glib/gstdio.h>
 
 #include "backgammon.h"
+#include "anytime.h"
 #include "drawboard.h"
+#include "enginestats.h"
 #include "eval.h"
 #include "matchequity.h"
 #include "positionid.h"
+#include "selfplay.h"
 #include "matchid.h"
 #include "util.h"
 #include "lib/gnubg-types.h"
@@ -910,6 +914,92 @@ PythonHint(PyObject * UNUSED(self), PyObject * args)
     return retval;
 }
 
+static PyObject *
+AnytimeLevelToPy(const movelist * pml)
+{
+    PyObject *pyMoves = PyList_New(0);
+    unsigned int i;
+
+    for (i = 0; pyMoves && i < pml->cMoves; i++) {
+        char szMove[FORMATEDMOVESIZE];
+        PyObject *pyMove;
+
+        FormatMove(szMove, msBoard(), pml->amMoves[i].anMove);
+        if ((pyMove = Py_BuildValue("(sf)", szMove, pml->amMoves[i].rScore)) != NULL) {
+            PyList_Append(pyMoves, pyMove);
+            Py_DECREF(pyMove);
+        }
+    }
+
+    return pyMoves;
+}
+
+static void
+PythonAnytimeHint_Callback(unsigned int nPlies, const movelist * pml, void *p)
+{
+    PyObject *pyCallback = p, *pyResult;
+
+    /* stop calling back after an exception */
+    if (PyErr_Occurred())
+        return;
+
+    pyResult = PyObject_CallFunction(pyCallback, "(IN)", nPlies, AnytimeLevelToPy(pml));
+    Py_XDECREF(pyResult);
+}
+
+static PyObject *
+PythonAnytimeHint(PyObject * UNUSED(self), PyObject * args)
+{
+    double rSeconds;
+    PyObject *pyCallback = NULL;
+    cubeinfo ci;
+    movelist ml;
+    int nPlies, fSaveShowProg = fShowProgress;
+
+    if (!PyArg_ParseTuple(args, "d|O:anytimehint", &rSeconds, &pyCallback))
+        return NULL;
+
+    if (pyCallback == Py_None)
+        pyCallback = NULL;
+
+    if (pyCallback && !PyCallable_Check(pyCallback)) {
+        PyErr_SetString(PyExc_TypeError, _("the callback must be callable"));
+        return NULL;
+    }
+
+    if (ms.gs != GAME_PLAYING || !ms.anDice[0] || ms.fDoubled || ms.fResigned) {
+        PyErr_SetString(PyExc_StandardError, _("There is no chequer play decision to give a hint on."));
+        return NULL;
+    }
+
+    GetMatchStateCubeInfo(&ci, &ms);
+
+    fShowProgress = FALSE;
+    nPlies = RunAnytime(&ml, ms.anDice[0], ms.anDice[1], msBoard(), &ci, &GetEvalChequer()->ec,
+                        *GetEvalMoveFilter(), rSeconds, pyCallback ? PythonAnytimeHint_Callback : NULL, pyCallback);
+    fShowProgress = fSaveShowProg;
+
+    if (nPlies < 0 || fInterrupt) {
+        ResetInterrupt();
+        g_free(ml.amMoves);
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_StandardError, _("interrupted/errno in anytimehint"));
+        return NULL;
+    }
+
+    if (PyErr_Occurred()) {
+        g_free(ml.amMoves);
+        return NULL;
+    }
+
+    {
+        PyObject *pyRet = Py_BuildValue("{s:i,s:N}", "plies", nPlies, "moves", AnytimeLevelToPy(&ml));
+
+        g_free(ml.amMoves);
+        return pyRet;
+    }
+}
+
 static PyObject *
 PythonUpdateUI(PyObject * UNUSED(self), PyObject * UNUSED(args))
 {
@@ -1094,6 +1184,78 @@ PythonLuckRating(PyObject * UNUSED(self), PyObject * args)
 
 }
 
+static PyObject *
+PythonSelfPlay(PyObject * UNUSED(self), PyObject * args)
+{
+    unsigned int nGames;
+    char *szFile;
+    unsigned long nSeed = (unsigned long) time(NULL);
+    int cGames;
+
+    if (!PyArg_ParseTuple(args, "Is|k:selfplay", &nGames, &szFile, &nSeed))
+        return NULL;
+
+    if ((cGames = SelfPlay(nGames, szFile, nSeed)) < 0 || fInterrupt) {
+        ResetInterrupt();
+        PyErr_SetString(PyExc_StandardError, _("self-play failed or was interrupted"));
+        return NULL;
+    }
+
+    return PyInt_FromLong(cGames);
+}
+
+static PyObject *
+PythonEngineStats(PyObject * UNUSED(self), PyObject * args)
+{
+    int fReset = FALSE, i;
+    enginestats es;
+    double rTickRate;
+    PyObject *pyCache;
+
+    if (!PyArg_ParseTuple(args, "|i:enginestats", &fReset))
+        return NULL;
+
+    if (!EngineStatsTotal(&es, &rTickRate)) {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    if (fReset)
+        EngineStatsReset();
+
+    if (!(pyCache = PyList_New(ENGINE_STATS_PLIES)))
+        return NULL;
+
+    for (i = 0; i < ENGINE_STATS_PLIES; i++)
+        PyList_SET_ITEM(pyCache, i, Py_BuildValue("(KK)", (unsigned long long) es.anCacheLookup[i],
+                                                  (unsigned long long) es.anCacheHit[i]));
+
+    if (rTickRate <= 0.0)
+        /* no clock, report zero times */
+        rTickRate = 1.0;
+
+    return Py_BuildValue("{s:{s:K,s:K,s:K,s:K,s:K,s:K,s:K},s:{s:K,s:K,s:K,s:K},s:N,s:{s:d,s:d,s:d},s:K}",
+                         "evaluations",
+                         "contact", (unsigned long long) es.an[ESC_EVAL_CONTACT],
+                         "crashed", (unsigned long long) es.an[ESC_EVAL_CRASHED],
+                         "race", (unsigned long long) es.an[ESC_EVAL_RACE],
+                         "bearoff", (unsigned long long) es.an[ESC_EVAL_BEAROFF],
+                         "osr", (unsigned long long) es.an[ESC_EVAL_OSR],
+                         "pruning", (unsigned long long) es.an[ESC_EVAL_PRUNE],
+                         "pruningcached", (unsigned long long) es.an[ESC_PRUNE_CACHE_HIT],
+                         "movegen",
+                         "calls", (unsigned long long) es.an[ESC_GENERATE],
+                         "moves", (unsigned long long) es.an[ESC_MOVES],
+                         "ranked", (unsigned long long) es.an[ESC_PRUNE_MOVES],
+                         "kept", (unsigned long long) es.an[ESC_PRUNE_KEPT],
+                         "cache", pyCache,
+                         "seconds",
+                         "eval", (double) es.anTicks[EST_EVAL] / rTickRate,
+                         "movegen", (double) es.anTicks[EST_GENERATE] / rTickRate,
+                         "exclusive", (double) es.anTicks[EST_EXCLUSIVE] / rTickRate,
+                         "exclusivecalls", (unsigned long long) es.an[ESC_EXCLUSIVE]);
+}
+
 static PyObject *
 PythonClassifyPosition(PyObject * UNUSED(self), PyObject * args)
 {
@@ -3149,6 +3311,14 @@ PythonNavigate(PyObject * UNUSED(self), PyObject * args, PyObject * keywds)
 
 static PyMethodDef gnubgMethods[] = {
 
+    {"anytimehint", PythonAnytimeHint, METH_VARARGS,
+     "rank the moves for the current roll at 0-ply, 1-ply, ... until the\n"
+     "    chequer play plies are reached or the time is up\n"
+     "    arguments: float seconds (0 for no limit), [callable]\n"
+     "       callable(plies, moves) is called with every completed level\n"
+     "    returns: dictionary 'plies'=>deepest completed level,\n"
+     "       'moves'=>list of (move, equity), best first"}
+    ,
     {"board", PythonBoard, METH_VARARGS,
      "Get the current board\n"
      "    arguments: none\n"
@@ -3386,6 +3556,16 @@ static PyMethodDef gnubgMethods[] = {
      "convert an error per move amount to a rating 0 = awful..7=supernatural\n"
      "    arguments: float error per move\n" "    returns: int\n"}
     ,
+    {"enginestats", (PyCFunction) PythonEngineStats, METH_VARARGS,
+     "engine counters and timers, see enginestats.h\n"
+     "    arguments: [int reset]\n"
+     "    returns: dict with evaluations, movegen, cache (lookups and hits by ply)\n"
+     "    and seconds, or None if the statistics are not compiled in"}
+    ,
+    {"selfplay", (PyCFunction) PythonSelfPlay, METH_VARARGS,
+     "play computer vs computer games and append them to a file, see selfplay.h\n"
+     "    arguments: int games, string file, [int seed]\n" "    returns: int games played"}
+    ,
     {"updateui", (PyCFunction) PythonUpdateUI, METH_VARARGS,
      "Allows the UI to update itself\n" "    arguments: none\n" "    returns: None"}
     ,
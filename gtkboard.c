@@ -2964,6 +2964,23 @@ game_set(Board * board, TanBoard points, int roll,
 
 int showingGray;
 
+/* milliseconds without a new size before the board's images go to the
+ * render cache */
+#define RENDER_CACHE_DELAY 2000
+
+static guint idRenderCacheSave;
+
+static gboolean
+RenderCacheSaveTimeout(gpointer p)
+{
+    BoardData *bd = p;
+
+    idRenderCacheSave = 0;
+    RenderImagesSave(&bd->ri);
+
+    return FALSE;
+}
+
 void
 GrayScaleColC(unsigned char *pCols)
 {
@@ -3032,6 +3049,15 @@ board_create_pixmaps(GtkWidget * UNUSED(board), BoardData * bd)
         }
     }
     RenderImages(bd->rd, &bd->ri);
+
+    /* only the main board is worth keeping, and not each size it passes
+     * through while the window is resized */
+    if (bd->ri.pvCacheHead && pwBoard && bd == BOARD(pwBoard)->board_data) {
+        if (idRenderCacheSave)
+            g_source_remove(idRenderCacheSave);
+        idRenderCacheSave = g_timeout_add(RENDER_CACHE_DELAY, RenderCacheSaveTimeout, bd);
+    }
+
     nSizeReal = bd->rd->nSize;
     bd->rd->nSize = 3;
     RenderBoard(bd->rd, auchBoard, BOARD_WIDTH * 3);
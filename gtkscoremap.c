@@ -102,6 +102,7 @@ and come back, it works again. It may be a movelist construction issue.
 #include "drawboard.h"
 #include "format.h"
 #include "gtkwindows.h"
+#include "multithread.h"
 
 // these sizes help define the requested minimum quadrant size; but then GTK can set a higher value
 // e.g. we may ask for height/width of 60, but final height will be 60 & final width 202
@@ -454,9 +455,10 @@ mmwc2eq(const float rMwc, const cubeinfo *pci) {
 }
 
 static int
-CalcQuadrantEquities(quadrantdata * pq, const scoremap * psm, int recomputeFully) {
+ComputeQuadrantEquities(quadrantdata * pq, const scoremap * psm, int recomputeFully) {
 /* In Cube ScoreMap: Calculates the DT and ND equities for the given quadrant. Updates data in pq accordingly.
 In Move ScoreMap: Calculates the ordered best moves and their equities.
+Does not touch the progress bar, so that it can run on the thread pool.
 */
     if (psm->cubeScoreMap) {
         if (!GetDPEq(NULL, NULL, & pq->ci)) { // Cube not available
@@ -470,7 +472,6 @@ In Move ScoreMap: Calculates the ordered best moves and their equities.
                         //GeneralCubeDecisionE is from eval.c
                         // extern int GeneralCubeDecisionE(float aarOutput[2][NUM_ROLLOUT_OUTPUTS], const TanBoard anBoard,
                         // cubeinfo * const pci, const evalcontext * pec, const evalsetup * UNUSED(pes))
-                    ProgressEnd();
                     return -1;
                 }
 
@@ -491,7 +492,6 @@ In Move ScoreMap: Calculates the ordered best moves and their equities.
         if (FindnSaveBestMoves(&(pq->ml),psm->pms->anDice[0],psm->pms->anDice[1], (ConstTanBoard) psm->pms->anBoard, NULL, //or pkey
                                         arSkillLevel[SKILL_DOUBTFUL], &(pq->ci), &psm->ec, aamfAnalysis) <0) {
             strcpy(pq->decisionString,"");
-            ProgressEnd();
             return -1;
         }
 
@@ -505,6 +505,17 @@ In Move ScoreMap: Calculates the ordered best moves and their equities.
     }
 }
 
+static int
+CalcQuadrantEquities(quadrantdata * pq, const scoremap * psm, int recomputeFully) {
+/* As ComputeQuadrantEquities(), on the main thread: ends the progress bar on errors.
+*/
+    if (ComputeQuadrantEquities(pq, psm, recomputeFully)) {
+        ProgressEnd();
+        return -1;
+    }
+    return 0;
+}
+
 static int
 CompareDecisionFrequencies (const void *a, const void *b)
 {
@@ -568,37 +579,142 @@ TODO: when changing ply etc., don't change colours.
 }
 
 
+/* One quadrant to compute on the thread pool */
+typedef struct {
+    quadrantdata *pq;
+    const scoremap *psm;
+    int recomputeFully;
+} quadranttask;
+
+static void
+CalcQuadrantEquitiesMT(void *p)
+{
+    quadranttask *pqt = (quadranttask *) p;
+
+    // The progress bar is ended by CalcScoreMapEquities() once all the tasks are done
+    if (ComputeQuadrantEquities(pqt->pq, pqt->psm, pqt->recomputeFully))
+        MT_SetResultFailed();
+}
+
+static gboolean
+UpdateScoreMapProgress(gpointer UNUSED(unused))
+{
+    ProgressValue(MT_GetDoneTasks());
+    return TRUE;
+}
+
+static int
+CalcCubeEquitiesShared(scoremap * psm, int oldSize)
+/* 0-ply cube scoremap: the cube decisions at all the scores to recompute (and money) come out of a single
+   search, see GeneralCubeDecisionEScores(), which only handles 0-ply. The decision strings are then set by
+   CalcQuadrantEquities() without recomputing.
+*/
+{
+    quadrantdata *apq[MAX_TABLE_SIZE * MAX_TABLE_SIZE + 1];
+    cubeinfo *aci;
+    float (*aaarOutput)[2][NUM_ROLLOUT_OUTPUTS];
+    int n = 0;
+    int k;
+
+    for (int i=0; i<psm->tableSize; i++)
+        for (int j=0; j<psm->tableSize; j++)
+            if (psm->aaQuadrantData[i][j].isAllowedScore == ALLOWED && (i>=oldSize || j>=oldSize)
+                && GetDPEq(NULL, NULL, & psm->aaQuadrantData[i][j].ci))
+                apq[n++] = & psm->aaQuadrantData[i][j];
+    if (GetDPEq(NULL, NULL, & psm->moneyQuadrantData.ci))
+        apq[n++] = & psm->moneyQuadrantData;
+
+    if (!n)
+        return 0;
+
+    aci = g_new(cubeinfo, n);
+    aaarOutput = g_malloc(n * sizeof(*aaarOutput));
+
+    for (k=0; k<n; k++)
+        aci[k] = apq[k]->ci;
+
+    if (GeneralCubeDecisionEScores(aaarOutput, psm->pms->anBoard, aci, n, & psm->ec)) {
+        g_free(aci);
+        g_free(aaarOutput);
+        return -1;
+    }
+
+    // Convert MWC to equity, and store in the scoremap
+    for (k=0; k<n; k++) {
+        apq[k]->ndEquity = mmwc2eq(aaarOutput[k][0][OUTPUT_CUBEFUL_EQUITY], & apq[k]->ci);
+        apq[k]->dtEquity = mmwc2eq(aaarOutput[k][1][OUTPUT_CUBEFUL_EQUITY], & apq[k]->ci);
+    }
+
+    g_free(aci);
+    g_free(aaarOutput);
+    return 0;
+}
+
 static int
 CalcScoreMapEquities(scoremap * psm, int oldSize)
 /* Iterate through scores. Find equities at each score, and use these to set the text for the corresponding box.
    (Does not update the gui.)
    Only does entries in the table >= oldSize. (Avoid computing old values when resizing the table.)
    In the move scoremap, it also computes the most frequent best moves across the scoremap
+   The scores are computed in parallel on the thread pool; at 0-ply, the cube scoremap shares one search
+   for all scores.
 */
 {
-    ProgressStartValue(_("Finding correct actions"), MAX(psm->tableSize*psm->tableSize+1-oldSize*oldSize, 1));
-            // - Should actually be 1 less if oldSize>0 (because money)
-            // - If we only recompute the money equity, the formula correctly yields 1 for oldSize = psm->tableSize
+    quadranttask aqt[MAX_TABLE_SIZE * MAX_TABLE_SIZE + 1];
+    int shared = psm->cubeScoreMap && psm->ec.nPlies == 0;
+    int nTasks = 0;
+    int result = 0;
+
+    if (shared) {
+        ProgressStart(_("Finding correct actions"));
+        result = CalcCubeEquitiesShared(psm, oldSize);
+        ProgressEnd();
+        if (result)
+            return -1;
+    }
+
 //g_print("Finding %d-ply cube equities:\n",pec->nPlies);
     for (int i=0; i<psm->tableSize; i++) {
         // i,j correspond to the locations in the table. E.g., in cube ScoreMap, the away-scores
         //      are 2+i, 2+j (because the (0,0)-entry of the table corresponds to 2-away 2-away).
         for (int j=0; j<psm->tableSize; j++) {
             if (psm->aaQuadrantData[i][j].isAllowedScore == ALLOWED) {
-                CalcQuadrantEquities(& psm->aaQuadrantData[i][j], psm, (i>=oldSize || j>=oldSize));
-                // g_print("i=%d,j=%d,FindnSaveBestMoves returned %d, %1.3f; decision: %s\n",i,j,psm->aaQuadrantData[i][j].ml.
-                //         cMoves,psm->aaQuadrantData[i][j].ml.rBestScore,psm->aaQuadrantData[i][j].decisionString);
-                if (i>=oldSize || j>=oldSize) // Only count the ones where equities are recomputed (other ones occur near-instantly)
-                    ProgressValueAdd(1);
+                int recompute = !shared && (i>=oldSize || j>=oldSize);
+
+                if (recompute || !psm->cubeScoreMap) {
+                    // Computed on the thread pool below
+                    aqt[nTasks].pq = & psm->aaQuadrantData[i][j];
+                    aqt[nTasks].psm = psm;
+                    aqt[nTasks].recomputeFully = recompute;
+                    nTasks++;
+                } else
+                    // Old or already computed equities: only sets the decision (occurs near-instantly)
+                    CalcQuadrantEquities(& psm->aaQuadrantData[i][j], psm, FALSE);
             } else {
                 strcpy(psm->aaQuadrantData[i][j].decisionString,"");
             }
         }
     }
-    CalcQuadrantEquities(&(psm->moneyQuadrantData), psm, TRUE);
-    ProgressValueAdd(1);
+    if (!shared) {
+        aqt[nTasks].pq = &(psm->moneyQuadrantData);
+        aqt[nTasks].psm = psm;
+        aqt[nTasks].recomputeFully = TRUE;
+        nTasks++;
+    } else
+        CalcQuadrantEquities(&(psm->moneyQuadrantData), psm, FALSE);
+
+    if (nTasks) {
+        ProgressStartValue(_("Finding correct actions"), nTasks);
+
+        for (int k=0; k<nTasks; k++)
+            mt_add_tasks(1, CalcQuadrantEquitiesMT, aqt + k, NULL);
+        result = MT_WaitForTasks(UpdateScoreMapProgress, 250, FALSE);
+
+        ProgressEnd();
+    }
 
-    ProgressEnd();
+    if (result == -1)
+        return -1;
 
     if (!psm->cubeScoreMap)
         FindMostFrequentMoves(psm);
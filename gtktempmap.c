@@ -34,6 +34,7 @@
 
 #include "backgammon.h"
 #include "eval.h"
+#include "analysis.h"
 #include "gtktempmap.h"
 #include "gtkgame.h"
 #include "drawboard.h"
@@ -94,11 +95,8 @@ TempMapEquities(evalcontext * pec, matchstate * pms,
 
 
     int i, j;
-    float arOutput[NUM_ROLLOUT_OUTPUTS];
-    TanBoard anBoard;
-    int aaan[6][6][8];
+    rollexpansion re;
     float aar[6][6];
-    cubeinfo ci;
     cubeinfo cix;
 
     /* calculate equities */
@@ -107,56 +105,34 @@ TempMapEquities(evalcontext * pec, matchstate * pms,
 
     if (szTitle && *szTitle) {
         gchar *sz = g_strdup_printf(_("Calculating equities for %s"), szTitle);
-        ProgressStartValue(sz, 21);
+        ProgressStart(sz);
         g_free(sz);
     } else
-        ProgressStartValue(_("Calculating equities"), 21);
-
-    for (i = 0; i < 6; ++i)
-        for (j = 0; j <= i; ++j) {
-
-            memcpy(&ci, &cix, sizeof ci);
-
-            /* find best move */
-
-            memcpy(anBoard, pms->anBoard, sizeof(anBoard));
-
-            if (FindBestMove(aaan[i][j], i + 1, j + 1, anBoard, &ci, pec, defaultFilters) < 0) {
-                ProgressEnd();
-                return -1;
-            }
+        ProgressStart(_("Calculating equities"));
 
-            /* evaluate resulting position */
+    /* best move and evaluation after it for each roll */
 
-            SwapSides(anBoard);
-            ci.fMove = !ci.fMove;
-
-            if (GeneralEvaluationE(arOutput, (ConstTanBoard) anBoard, &ci, pec) < 0) {
-                ProgressEnd();
-                return -1;
-            }
-
-            InvertEvaluationR(arOutput, &cix);
-
-            if (!cix.nMatchTo && rFac != 1.0f)
-                arOutput[OUTPUT_CUBEFUL_EQUITY] *= rFac;
+    if (EvaluateRolls(&re, pms->anBoard, &cix, pec) < 0) {
+        ProgressEnd();
+        return -1;
+    }
 
-            aar[i][j] = arOutput[OUTPUT_CUBEFUL_EQUITY];
-            aar[j][i] = arOutput[OUTPUT_CUBEFUL_EQUITY];
+    for (i = 0; i < 6; ++i)
+        for (j = 0; j < 6; ++j) {
 
-            if (i != j)
-                memcpy(aaan[j][i], aaan[i][j], sizeof aaan[0][0]);
+            /* the move evaluations hold equity, the map shows mwc in match play */
 
-            ProgressValueAdd(1);
+            if (cix.nMatchTo)
+                aar[i][j] = eq2mwc(re.aaarOutput[i][j][OUTPUT_CUBEFUL_EQUITY], &cix);
+            else
+                aar[i][j] = re.aaarOutput[i][j][OUTPUT_CUBEFUL_EQUITY] * rFac;
 
         }
 
-
-
     ProgressEnd();
 
     memcpy(aarEquity, aar, sizeof aar);
-    memcpy(aaanMove, aaan, sizeof aaan);
+    memcpy(aaanMove, re.aaanMove, sizeof re.aaanMove);
 
     return 0;
 
@@ -34,6 +34,7 @@
 
 #include "backgammon.h"
 #include "export.h"
+#include "multithread.h"
 #include <glib/gstdio.h>
 #include "render.h"
 #include "renderprefs.h"
@@ -68,13 +69,80 @@ static unsigned char *auchArrow[2];
 #endif
 static unsigned char *auchMidlb;
 
+/* The images are composed one after the other in the buffers above and
+ * copied to a queue; encoding them, which takes most of the time, is
+ * done on the thread pool once all are composed. */
+
+typedef struct {
+    gchar *szFile;
+    unsigned char *puch;        /* cx * cy RGB pixels without padding */
+    int cx, cy;
+    int fFailed;
+} pngjob;
+
+static GPtrArray *papjQueue;
+static int iJobNext, cJobsDone;
+
 static void
 WriteImageStride(unsigned char *img, int stride, int cx, int cy)
 {
-    if (WritePNG(szFile, img, (unsigned int) stride, (unsigned int) cx, (unsigned int) cy) == -1)
-        outputf(_("Error creating image file %s\n"), szFile);
+    pngjob *pj = g_new(pngjob, 1);
+    int y;
+
+    pj->szFile = g_strdup(szFile);
+    pj->puch = g_malloc((gsize) (cx * 3 * cy));
+    pj->cx = cx;
+    pj->cy = cy;
+    pj->fFailed = FALSE;
+
+    for (y = 0; y < cy; y++)
+        memcpy(pj->puch + y * cx * 3, img + y * stride, (size_t) (cx * 3));
+
+    g_ptr_array_add(papjQueue, pj);
     imagesWritten++;
-    ProgressValueAdd(1);
+}
+
+static void
+EncodeTask(void *UNUSED(unused))
+{
+    int i;
+
+    while ((i = MT_SafeIncValue(&iJobNext) - 1) < (int) papjQueue->len) {
+        pngjob *pj = g_ptr_array_index(papjQueue, i);
+
+        pj->fFailed = WritePNG(pj->szFile, pj->puch, (unsigned int) (pj->cx * 3),
+                               (unsigned int) pj->cx, (unsigned int) pj->cy) == -1;
+        MT_SafeInc(&cJobsDone);
+    }
+}
+
+static gboolean
+EncodeProgress(gpointer UNUSED(unused))
+{
+    ProgressValue(MT_SafeGet(&cJobsDone));
+
+    return TRUE;
+}
+
+static void
+EncodeImages(void)
+{
+    guint i;
+
+    iJobNext = cJobsDone = 0;
+    mt_add_tasks(MIN(MT_GetNumThreads(), papjQueue->len), EncodeTask, NULL, NULL);
+    (void) MT_WaitForTasks(EncodeProgress, 250, FALSE);
+
+    for (i = 0; i < papjQueue->len; i++) {
+        pngjob *pj = g_ptr_array_index(papjQueue, i);
+
+        if (pj->fFailed)
+            outputf(_("Error creating image file %s\n"), pj->szFile);
+        g_free(pj->szFile);
+        g_free(pj->puch);
+        g_free(pj);
+    }
+    g_ptr_array_set_size(papjQueue, 0);
 }
 
 static void
@@ -720,9 +788,12 @@ CommandExportHTMLImages(char *sz)
     szFile = GetFilenameBase(sz);
 
     ProgressStartValue(_("Generating image:"), NUM_IMAGES);
+    papjQueue = g_ptr_array_new();
     AllocObjects();
     RenderObjects();
     WriteImages();
+    EncodeImages();
+    g_ptr_array_free(papjQueue, TRUE);
     TidyObjects();
     ProgressEnd();
 }
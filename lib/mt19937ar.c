@@ -156,6 +156,41 @@ genrand_int32(int *mti, unsigned long mt[MT_ARRAY_N])
     return y;
 }
 
+/* n successive outputs of genrand_int32(), tempered a block at a time */
+void
+genrand_int32_n(int *mti, unsigned long mt[MT_ARRAY_N], unsigned long *out, unsigned int n)
+{
+    while (n) {
+        unsigned int i, k;
+
+        if (*mti >= MT_ARRAY_N) {
+            /* genrand_int32() generates the next N words */
+            *out++ = genrand_int32(mti, mt);
+            --n;
+            continue;
+        }
+
+        k = (unsigned int) (MT_ARRAY_N - *mti);
+        if (k > n)
+            k = n;
+
+        for (i = 0; i < k; ++i) {
+            unsigned long y = mt[*mti + i];
+
+            y ^= (y >> 11);
+            y ^= (y << 7) & 0x9d2c5680UL;
+            y ^= (y << 15) & 0xefc60000UL;
+            y ^= (y >> 18);
+
+            out[i] = y;
+        }
+
+        *mti += k;
+        out += k;
+        n -= k;
+    }
+}
+
 #if 0
 
 /* generates a random number on [0,0x7fffffff]-interval */
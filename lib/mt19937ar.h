@@ -25,6 +25,7 @@
 
 extern void init_genrand(unsigned long s, int *mti, unsigned long mt[MT_ARRAY_N]);
 extern unsigned long genrand_int32(int *mti, unsigned long mt[MT_ARRAY_N]);
+extern void genrand_int32_n(int *mti, unsigned long mt[MT_ARRAY_N], unsigned long *out, unsigned int n);
 void init_by_array(unsigned long init_key[], int key_length, int *mti, unsigned long mt[MT_ARRAY_N]);
 
 #endif
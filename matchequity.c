@@ -22,6 +22,7 @@
 
 #include <glib.h>
 #include <glib/gprintf.h>
+#include <glib/gstdio.h>
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
@@ -38,6 +39,14 @@
 #include "matchequity.h"
 #include "backgammon.h"
 
+#if !GLIB_CHECK_VERSION (2,26,0)
+#ifdef WIN32
+#define GStatBuf struct _g_stat_struct
+#else
+typedef struct stat GStatBuf;
+#endif
+#endif
+
 
 typedef struct {
     char *szName;
@@ -1503,12 +1512,117 @@ calcGammonPrices(float aafMET[MAXSCORE][MAXSCORE],
 
 }
 
+/* The match equity table in a snapshot. It is followed by the name, the
+ * file name and the description of the table, each with its terminating
+ * NUL; acch[] are their lengths including the NULs, 0 for NULL. */
+typedef struct {
+    guint64 cbFile;             /* size and modification time of the file */
+    gint64 tModified;
+    int nLength;
+    int acch[3];
+    float aafMET[MAXSCORE][MAXSCORE];
+    float aafMETPostCrawford[2][MAXSCORE];
+    float aaaafGammonPrices[MAXCUBELEVEL][MAXSCORE][MAXSCORE][4];
+    float aaaafGammonPricesPostCrawford[MAXCUBELEVEL][MAXSCORE][2][4];
+} metsnapshot;
+
+extern void
+METSnapshotSave(snapshotwriter * psw)
+{
+    metsnapshot *pms;
+    GStatBuf st;
+    const gchar *asz[3];
+    GString *gs;
+    int i;
+
+    /* only a table read from a file can be checked for changes */
+    if (!miCurrent.szFileName || g_stat(miCurrent.szFileName, &st) != 0)
+        return;
+
+    pms = g_new0(metsnapshot, 1);
+    pms->cbFile = (guint64) st.st_size;
+    pms->tModified = (gint64) st.st_mtime;
+    pms->nLength = miCurrent.nLength;
+    memcpy(pms->aafMET, aafMET, sizeof(aafMET));
+    memcpy(pms->aafMETPostCrawford, aafMETPostCrawford, sizeof(aafMETPostCrawford));
+    memcpy(pms->aaaafGammonPrices, aaaafGammonPrices, sizeof(aaaafGammonPrices));
+    memcpy(pms->aaaafGammonPricesPostCrawford, aaaafGammonPricesPostCrawford,
+           sizeof(aaaafGammonPricesPostCrawford));
+
+    asz[0] = miCurrent.szName;
+    asz[1] = miCurrent.szFileName;
+    asz[2] = miCurrent.szDescription;
+
+    gs = g_string_new(NULL);
+    for (i = 0; i < 3; i++)
+        if (asz[i]) {
+            pms->acch[i] = (int) strlen(asz[i]) + 1;
+            g_string_append_len(gs, asz[i], pms->acch[i]);
+        }
+
+    SnapshotWriterAdd(psw, SNAP_MET, pms, sizeof(metsnapshot));
+    SnapshotWriterAdd(psw, SNAP_MET, gs->str, gs->len);
+
+    g_string_free(gs, TRUE);
+    g_free(pms);
+}
+
+/* Takes the current table from the snapshot, if it has szFileName as it
+ * is on disk now */
+static int
+METFromSnapshot(const char *szFileName)
+{
+    gsize cb;
+    const metsnapshot *pms = SnapshotBlock(SNAP_MET, &cb);
+    const char *pch, *asz[3];
+    GStatBuf st;
+    int i;
+
+    if (!pms || cb < sizeof(metsnapshot))
+        return FALSE;
+
+    cb -= SNAPSHOT_PAD(sizeof(metsnapshot));
+    pch = (const char *) pms + SNAPSHOT_PAD(sizeof(metsnapshot));
+
+    for (i = 0; i < 3; i++) {
+        if (pms->acch[i] < 0 || (gsize) pms->acch[i] > cb || (pms->acch[i] && pch[pms->acch[i] - 1]))
+            return FALSE;
+
+        asz[i] = pms->acch[i] ? pch : NULL;
+        pch += pms->acch[i];
+        cb -= (gsize) pms->acch[i];
+    }
+
+    if (!asz[1] || strcmp(asz[1], szFileName) || g_stat(szFileName, &st) != 0 ||
+        pms->cbFile != (guint64) st.st_size || pms->tModified != (gint64) st.st_mtime)
+        return FALSE;
+
+    memcpy(aafMET, pms->aafMET, sizeof(aafMET));
+    memcpy(aafMETPostCrawford, pms->aafMETPostCrawford, sizeof(aafMETPostCrawford));
+    memcpy(aaaafGammonPrices, pms->aaaafGammonPrices, sizeof(aaaafGammonPrices));
+    memcpy(aaaafGammonPricesPostCrawford, pms->aaaafGammonPricesPostCrawford,
+           sizeof(aaaafGammonPricesPostCrawford));
+
+    g_free(miCurrent.szName);
+    g_free(miCurrent.szFileName);
+    g_free(miCurrent.szDescription);
+    miCurrent.szName = g_strdup(asz[0]);
+    miCurrent.szFileName = g_strdup(asz[1]);
+    miCurrent.szDescription = g_strdup(asz[2]);
+    miCurrent.nLength = pms->nLength;
+
+    return TRUE;
+}
+
 extern void
 InitMatchEquity(const char *szFileName)
 {
     int i, j;
     metdata md;
 
+    if (METFromSnapshot(szFileName))
+        return;
+
     /* Read match equity table from XML file */
     if (readMET(&md, szFileName) != 0) {        /* load failed - make default as must have a met */
         getDefaultMET(&md);
@@ -71,6 +71,9 @@ getMEAtScore(const int nScore0, const int nScore1, const int nMatchTo,
 void
  InitMatchEquity(const char *szFileName);
 
+/* Adds the current table to a snapshot, see snapshot.h */
+extern void METSnapshotSave(snapshotwriter * psw);
+
 /* Get double points */
 
 extern int
@@ -40,6 +40,7 @@ MT_CreateThreadLocalData(int id)
 {
     ThreadLocalData *tld = (ThreadLocalData *) g_malloc(sizeof(ThreadLocalData));
     tld->id = id;
+    tld->rDeadline = 0.0;
     tld->pnnState = (NNState *) g_malloc(sizeof(NNState) * 3);
     memset(tld->pnnState, 0, sizeof(NNState) * 3);
     tld->pnnState[CLASS_RACE - CLASS_RACE].savedBase = g_malloc(nnRace.cHidden * sizeof(float));
@@ -57,6 +58,9 @@ MT_CreateThreadLocalData(int id)
 
     tld->aMoves = (move *) g_malloc(sizeof(move) * MAX_INCOMPLETE_MOVES);
     memset(tld->aMoves, 0, sizeof(move) * MAX_INCOMPLETE_MOVES);
+#if defined(ENGINE_STATS)
+    tld->pes = EngineStatsThread(id);
+#endif
     return tld;
 }
 
@@ -315,9 +319,14 @@ MT_Close(void)
 extern void
 MT_Exclusive(void)
 {
+    ES_TIMER_START(nWait);
+
     multi_debug("exclusive asks lock (multiLock)");
     Mutex_Lock(&td.multiLock);
     multi_debug("exclusive gets lock (multiLock)");
+
+    ES_COUNT(ESC_EXCLUSIVE);
+    ES_TIMER_STOP(EST_EXCLUSIVE, nWait);
 }
 
 extern void
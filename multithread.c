@@ -38,7 +38,8 @@
 
 #if defined(USE_MULTITHREAD)
 
-static GThread* thread[MAX_NUMTHREADS];
+/* td.numThreads entries, allocated by MT_CreateThreads */
+static GThread **thread = NULL;
 
 extern unsigned int
 MT_GetNumThreads(void)
@@ -56,7 +57,10 @@ MT_CloseThreads(void)
     if (MT_WaitForTasks(NULL, 0, FALSE) != (int) td.numThreads)
         g_print(_("Error closing threads!\n"));
     for (i = 0; i < td.numThreads; i++)
-        g_thread_join(thread[i]);
+        if (thread[i])
+            g_thread_join(thread[i]);
+    g_free(thread);
+    thread = NULL;
 }
 
 static void
@@ -168,6 +172,7 @@ MT_CreateThreads(void)
 #endif
     MT_SafeSet(&td.result, 0);
     MT_SafeSet(&td.closingThreads, FALSE);
+    thread = g_new0(GThread *, td.numThreads);
     for (i = 0; i < td.numThreads; i++) {
         ThreadLocalData *pTLD = MT_CreateThreadLocalData(i);
 
@@ -202,6 +207,7 @@ MT_SetNumThreads(unsigned int num)
         if (num == 1) {         /* No locking in evals */
             EvaluatePosition = EvaluatePositionNoLocking;
             GeneralCubeDecisionE = GeneralCubeDecisionENoLocking;
+            GeneralCubeDecisionEScores = GeneralCubeDecisionEScoresNoLocking;
             GeneralEvaluationE = GeneralEvaluationENoLocking;
             ScoreMove = ScoreMoveNoLocking;
             FindBestMove = FindBestMoveNoLocking;
@@ -210,6 +216,7 @@ MT_SetNumThreads(unsigned int num)
         } else {                /* Locking version of evals */
             EvaluatePosition = EvaluatePositionWithLocking;
             GeneralCubeDecisionE = GeneralCubeDecisionEWithLocking;
+            GeneralCubeDecisionEScores = GeneralCubeDecisionEScoresWithLocking;
             GeneralEvaluationE = GeneralEvaluationEWithLocking;
             ScoreMove = ScoreMoveWithLocking;
             FindBestMove = FindBestMoveWithLocking;
@@ -36,6 +36,7 @@
 #endif
 
 #include "backgammon.h"
+#include "enginestats.h"
 
 /* #define DEBUG_MULTITHREADED 1 */
 
@@ -63,6 +64,10 @@ typedef struct {
     int id;
     move *aMoves;
     NNState *pnnState;
+    double rDeadline;           /* get_time() to abandon evaluations at, 0 for none */
+#if defined(ENGINE_STATS)
+    enginestats *pes;
+#endif
 } ThreadLocalData;
 
 typedef struct {
@@ -132,8 +137,10 @@ extern void FreeMutex(Mutex * mutex);
 
 #define TLSGet(item) *((size_t*)g_private_get(item))
 
+/* Only a sanity limit for "set threads": the thread pool and the
+ * per-thread data are allocated for the number of threads in use */
 #if !defined(MAX_NUMTHREADS)
-#define MAX_NUMTHREADS 48
+#define MAX_NUMTHREADS 1024
 #endif
 
 extern void MT_Release(void);
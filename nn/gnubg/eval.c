@@ -1169,8 +1169,12 @@ raceBGprob(CONST int anBoard[2][25], unsigned int side)
   }
 }  
 
-static void
-raceImprovement(CONST int anBoard[2][25], float arOutput[])
+/* The part of raceImprovement which depends only on the board. Computing it
+   once lets the trainer apply it to many evaluations of the same position
+   (and from several threads, since raceBGprob is not reentrant). */
+
+void
+raceImprovementInfo(CONST int anBoard[2][25], RaceFix* prf)
 {
   /* anBoard[1] is on roll */
   int totMen0 = 0, totMen1 = 0;
@@ -1179,7 +1183,11 @@ raceImprovement(CONST int anBoard[2][25], float arOutput[])
     
   {                      assert(anBoard[0][23] == 0 && anBoard[0][24] == 0); }
   {                      assert(anBoard[1][23] == 0 && anBoard[1][24] == 0); }
-    
+
+  prf->bgSide = -1;
+  prf->bgProb = 0.0;
+  prf->gSide = -1;
+  
   for(i = 22; i >= 0; --i) {
     totMen0 += anBoard[0][i];
     totMen1 += anBoard[1][i];
@@ -1222,29 +1230,8 @@ raceImprovement(CONST int anBoard[2][25], float arOutput[])
   if( any & (BG_POSSIBLE | OBG_POSSIBLE) ) {
     int side = (any & BG_POSSIBLE) ? 1 : 0;
 
-    float pr = raceBGprob(anBoard, side);
-
-    if( pr > 0.0 ) {
-      if( side == 1 ) {
-	arOutput[OUTPUT_WINBACKGAMMON] = pr;
-
-	if( arOutput[OUTPUT_WINGAMMON] < arOutput[OUTPUT_WINBACKGAMMON] ) {
-	  arOutput[OUTPUT_WINGAMMON] = arOutput[OUTPUT_WINBACKGAMMON];
-	}
-      } else {
-	arOutput[OUTPUT_LOSEBACKGAMMON] = pr;
-
-	if( arOutput[OUTPUT_LOSEGAMMON] < arOutput[OUTPUT_LOSEBACKGAMMON] ) {
-	  arOutput[OUTPUT_LOSEGAMMON] = arOutput[OUTPUT_LOSEBACKGAMMON];
-	}
-      }
-    } else {
-      if( side == 1 ) {
-	arOutput[OUTPUT_WINBACKGAMMON] = 0.0;
-      } else {
-	arOutput[OUTPUT_LOSEBACKGAMMON] = 0.0;
-      }
-    }
+    prf->bgSide = side;
+    prf->bgProb = raceBGprob(anBoard, side);
   }
 
   if( any & (G_POSSIBLE|OG_POSSIBLE) ) {
@@ -1278,13 +1265,58 @@ raceImprovement(CONST int anBoard[2][25], float arOutput[])
       
       if( opAtLeast < saverAtMostMoves + side ) {
 	/* certain gammon */
-	arOutput[side ? OUTPUT_WINGAMMON : OUTPUT_LOSEGAMMON] = 1.0;
-	arOutput[OUTPUT_WIN] = side ? 1.0 : 0.0;
+	prf->gSide = side;
       }
     }
   }
 }
 
+void
+raceImprovementApply(CONST RaceFix* prf, float arOutput[])
+{
+  if( prf->bgSide >= 0 ) {
+    float CONST pr = prf->bgProb;
+    
+    if( pr > 0.0 ) {
+      if( prf->bgSide == 1 ) {
+	arOutput[OUTPUT_WINBACKGAMMON] = pr;
+
+	if( arOutput[OUTPUT_WINGAMMON] < arOutput[OUTPUT_WINBACKGAMMON] ) {
+	  arOutput[OUTPUT_WINGAMMON] = arOutput[OUTPUT_WINBACKGAMMON];
+	}
+      } else {
+	arOutput[OUTPUT_LOSEBACKGAMMON] = pr;
+
+	if( arOutput[OUTPUT_LOSEGAMMON] < arOutput[OUTPUT_LOSEBACKGAMMON] ) {
+	  arOutput[OUTPUT_LOSEGAMMON] = arOutput[OUTPUT_LOSEBACKGAMMON];
+	}
+      }
+    } else {
+      if( prf->bgSide == 1 ) {
+	arOutput[OUTPUT_WINBACKGAMMON] = 0.0;
+      } else {
+	arOutput[OUTPUT_LOSEBACKGAMMON] = 0.0;
+      }
+    }
+  }
+
+  if( prf->gSide >= 0 ) {
+    int CONST side = prf->gSide;
+    
+    arOutput[side ? OUTPUT_WINGAMMON : OUTPUT_LOSEGAMMON] = 1.0;
+    arOutput[OUTPUT_WIN] = side ? 1.0 : 0.0;
+  }
+}
+
+static void
+raceImprovement(CONST int anBoard[2][25], float arOutput[])
+{
+  RaceFix rf;
+
+  raceImprovementInfo(anBoard, &rf);
+  raceImprovementApply(&rf, arOutput);
+}
+
 #if defined( OS_BEAROFF_DB )
 void
 disableOSdb(void)
@@ -2165,6 +2197,86 @@ NetEval(float* p, CONST int anBoard[2][25], positionclass pc, float* inputs)
   SanityCheck(anBoard, p);
 }
 
+int
+TrainNetClass(CONST int anBoard[2][25])
+{
+  int pc = ClassifyPosition(anBoard);
+  
+  if( ! nets[pc].net ) {
+    pc = alternate[pc];
+    if( pc < 0 || ! nets[pc].net ) {
+      return -1;
+    }
+  }
+
+  return pc;
+}
+
+int
+EvalNetClass(CONST int anBoard[2][25])
+{
+  int pc = ClassifyPosition(anBoard);
+
+  switch( pc ) {
+    case CLASS_RACE:
+#if defined( OS_BEAROFF_DB )
+      if( osDB && isBearoff(osDB, anBoard) ) {
+	return -1;
+      }
+#endif
+      break;
+      
+    case CLASS_CRASHED:
+    case CLASS_CONTACT:
+#if defined( CONTAINMENT_CODE )
+    case CLASS_BACKCONTAIN:
+#endif
+      break;
+
+    default:
+      return -1;
+  }
+
+  while( ! nets[pc].net ) {
+    pc = alternate[pc];
+    {                                                       assert( pc >= 0 ); }
+  }
+
+  return pc;
+}
+
+neuralnet*
+classNet(int pc)
+{
+  return nets[pc].net;
+}
+
+unsigned int
+classInputs(int pc, CONST int anBoard[2][25], float arInput[])
+{
+  nets[pc].netInputs->func(anBoard, arInput);
+
+  return nets[pc].net->cInput;
+}
+
+CONST char*
+classInputsName(int pc)
+{
+  return nets[pc].net ? nets[pc].netInputs->name : 0;
+}
+
+int
+classSameInputs(int pc0, int pc1)
+{
+  return nets[pc0].netInputs == nets[pc1].netInputs;
+}
+
+void
+EvalSanityCheck(CONST int anBoard[2][25], float arOutput[])
+{
+  SanityCheck(anBoard, arOutput);
+}
+
 extern int
 TrainPosition(CONST int anBoard[2][25], float arDesired[], float a,
 	      CONST int* tList)
@@ -188,6 +188,51 @@ extern int
 TrainPosition(CONST int anBoard[2][25], float arDesired[], float alpha,
 	      CONST int* k);
 
+/* Support for trainers which compute the net inputs once and then train or
+   evaluate nets directly (see py/pytrainer.cc) */
+
+/* Class of the net TrainPosition uses for the position, -1 if none */
+extern int
+TrainNetClass(CONST int anBoard[2][25]);
+
+/* Class of the net EvaluatePositionFast uses for the position, -1 if its
+   evaluation does not come from a net (game over, bearoff databases) */
+extern int
+EvalNetClass(CONST int anBoard[2][25]);
+
+struct _neuralnet;
+
+extern struct _neuralnet*
+classNet(int pc);
+
+/* Fill arInput with the inputs of the net for class pc, return their number */
+extern unsigned int
+classInputs(int pc, CONST int anBoard[2][25], float arInput[]);
+
+/* Name of the input function of the net for class pc, 0 if there is no net */
+extern CONST char*
+classInputsName(int pc);
+
+extern int
+classSameInputs(int pc0, int pc1);
+
+extern void
+EvalSanityCheck(CONST int anBoard[2][25], float arOutput[]);
+
+typedef struct RaceFix_ {
+  /* side whose backgammon probability is known, or -1 */
+  int		bgSide;
+  float		bgProb;
+  /* side with a certain gammon, or -1 */
+  int		gSide;
+} RaceFix;
+
+extern void
+raceImprovementInfo(CONST int anBoard[2][25], RaceFix* prf);
+
+extern void
+raceImprovementApply(CONST RaceFix* prf, float arOutput[]);
+
 extern int
 PruneTrainPosition(CONST int anBoard[2][25], float arDesired[], float alpha);
 
@@ -811,6 +811,171 @@ NeuralNetTrain(neuralnet* pnn, float arInput[], float arOutput[],
   return 0;
 }
 
+extern int
+NeuralNetGradCreate(neuralnetgrad* pg, CONST neuralnet* pnn)
+{
+  pg->cInput = pnn->cInput;
+  pg->cHidden = pnn->cHidden;
+  pg->cOutput = pnn->cOutput;
+  pg->nRows = 0;
+  
+  pg->arHiddenWeight = calloc(pnn->cInput * pnn->cHidden, sizeof(float));
+  pg->arOutputWeight = calloc(pnn->cOutput * pnn->cHidden, sizeof(float));
+  pg->arHiddenThreshold = calloc(pnn->cHidden, sizeof(float));
+  pg->arOutputThreshold = calloc(pnn->cOutput, sizeof(float));
+  pg->aiRows = malloc(pnn->cInput * sizeof(int));
+  pg->afRow = calloc(pnn->cInput, sizeof(char));
+
+  if( !(pg->arHiddenWeight && pg->arOutputWeight && pg->arHiddenThreshold &&
+	pg->arOutputThreshold && pg->aiRows && pg->afRow) ) {
+    NeuralNetGradDestroy(pg);
+    errno = ENOMEM;
+    return -1;
+  }
+  
+  return 0;
+}
+
+extern void
+NeuralNetGradDestroy(neuralnetgrad* pg)
+{
+  free(pg->arHiddenWeight); pg->arHiddenWeight = 0;
+  free(pg->arOutputWeight); pg->arOutputWeight = 0;
+  free(pg->arHiddenThreshold); pg->arHiddenThreshold = 0;
+  free(pg->arOutputThreshold); pg->arOutputThreshold = 0;
+  free(pg->aiRows); pg->aiRows = 0;
+  free(pg->afRow); pg->afRow = 0;
+}
+
+/* Accumulate the gradient of n samples against the current weights, then
+   apply their sum in a single update. With n == 1 this is exactly
+   NeuralNetTrain. Only hidden weight rows of non zero inputs are touched,
+   so the cost stays proportional to the (sparse) inputs of the batch.
+
+   Weights are read and written without locking: several threads may train
+   the same net concurrently (the occasional lost update is harmless for
+   SGD).
+*/
+
+extern int
+NeuralNetTrainBatch(neuralnet* pnn, neuralnetgrad* pg, unsigned int n,
+		    float* CONST aarInput[], float* CONST aarDesired[],
+		    float rAlpha)
+{
+  int i, j;
+  unsigned int k;
+  int CONST cHidden = pnn->cHidden;
+  
+  Intermediate ar[ cHidden ];
+  
+  float
+    arOutput[ pnn->cOutput ],
+    arOutputError[ pnn->cOutput ],
+    arHiddenError[ cHidden ];
+
+  {                                        assert( pg->cInput == pnn->cInput &&
+					     pg->cHidden == cHidden &&
+					     pg->cOutput == pnn->cOutput ); }
+  
+  memset(pg->arOutputWeight, 0, pnn->cOutput * cHidden * sizeof(float));
+  memset(pg->arOutputThreshold, 0, pnn->cOutput * sizeof(float));
+  memset(pg->arHiddenThreshold, 0, cHidden * sizeof(float));
+
+  for(k = 0; k < n; ++k) {
+    float CONST* CONST arInput = aarInput[k];
+    float* prWeight;
+    float* pr;
+    
+    Evaluate(pnn, (float*)arInput, ar, arOutput, 0);
+
+    /* Calculate error at output nodes */
+    for( i = 0; i < pnn->cOutput; i++ )
+      arOutputError[ i ] = ( aarDesired[k][ i ] - arOutput[ i ] ) *
+	pnn->rBetaOutput * (arOutput[i] * ( 1 - arOutput[i] ));
+
+    /* Calculate error at hidden nodes */
+    for( i = 0; i < cHidden; i++ )
+      arHiddenError[ i ] = 0.0;
+
+    prWeight = pnn->arOutputWeight;
+    
+    for( i = 0; i < pnn->cOutput; i++ )
+      for( j = 0; j < cHidden; j++ )
+	arHiddenError[j] += arOutputError[i] * *prWeight++;
+
+    for( i = 0; i < cHidden; i++ )
+      arHiddenError[i] *= pnn->rBetaHidden * ar[i] * (1 - ar[i]);
+
+    /* Accumulate output gradient */
+    pr = pg->arOutputWeight;
+    for( i = 0; i < pnn->cOutput; i++ ) {
+      float CONST e = arOutputError[ i ];
+      
+      for( j = 0; j < cHidden; j++ )
+	pr[j] += e * ar[ j ];
+      pr += cHidden;
+
+      pg->arOutputThreshold[ i ] += e;
+    }
+
+    /* Accumulate hidden gradient */
+    for( i = 0; i < pnn->cInput; i++ ) {
+      float CONST ari = arInput[ i ];
+      
+      if( ari != 0.0 ) {
+	pr = pg->arHiddenWeight + i * cHidden;
+
+	if( ! pg->afRow[i] ) {
+	  pg->afRow[i] = 1;
+	  pg->aiRows[pg->nRows++] = i;
+	  memset(pr, 0, cHidden * sizeof(float));
+	}
+
+	if( ari == 1.0 ) {
+	  for( j = 0; j < cHidden; j++ )
+	    pr[j] += arHiddenError[j];
+	} else {
+	  for( j = 0; j < cHidden; j++ )
+	    pr[j] += arHiddenError[j] * ari;
+	}
+      }
+    }
+
+    for( i = 0; i < cHidden; i++ )
+      pg->arHiddenThreshold[ i ] += arHiddenError[ i ];
+  }
+
+  /* Apply summed gradient */
+  {
+    int CONST nOutputWeights = pnn->cOutput * cHidden;
+    
+    for( i = 0; i < nOutputWeights; i++ )
+      pnn->arOutputWeight[ i ] += rAlpha * pg->arOutputWeight[ i ];
+    
+    for( i = 0; i < pnn->cOutput; i++ )
+      pnn->arOutputThreshold[ i ] += rAlpha * pg->arOutputThreshold[ i ];
+  }
+
+  for(k = 0; k < pg->nRows; ++k) {
+    int CONST r = pg->aiRows[k];
+    float* CONST prWeight = pnn->arHiddenWeight + r * cHidden;
+    float CONST* CONST pr = pg->arHiddenWeight + r * cHidden;
+
+    for( j = 0; j < cHidden; j++ )
+      prWeight[j] += rAlpha * pr[j];
+
+    pg->afRow[r] = 0;
+  }
+  pg->nRows = 0;
+  
+  for( i = 0; i < cHidden; i++ )
+    pnn->arHiddenThreshold[ i ] += rAlpha * pg->arHiddenThreshold[ i ];
+
+  pnn->nTrained += n;
+    
+  return 0;
+}
+
 extern int
 NeuralNetTrainS(neuralnet* pnn, float arInput[], float arOutput[],
 		float arDesired[], float rAlpha, CONST int* tList)
@@ -73,6 +73,31 @@ extern int
 NeuralNetTrainS(neuralnet* pnn, float arInput[], float arOutput[],
 		float arDesired[], float rAlpha, CONST int* tList);
 
+/* Gradient accumulator for NeuralNetTrainBatch, one per net and thread */
+
+typedef struct _neuralnetgrad {
+  int cInput, cHidden, cOutput;
+  
+  float *arHiddenWeight, *arOutputWeight,
+	*arHiddenThreshold, *arOutputThreshold;
+
+  /* hidden weight rows touched by the current batch */
+  int*		aiRows;
+  unsigned int	nRows;
+  char*		afRow;
+} neuralnetgrad;
+
+extern int
+NeuralNetGradCreate(neuralnetgrad* pg, CONST neuralnet* pnn);
+
+extern void
+NeuralNetGradDestroy(neuralnetgrad* pg);
+
+extern int
+NeuralNetTrainBatch(neuralnet* pnn, neuralnetgrad* pg, unsigned int n,
+		    float* CONST aarInput[], float* CONST aarDesired[],
+		    float rAlpha);
+
 extern int NeuralNetResize( neuralnet *pnn, int cInput, int cHidden,
 			    int cOutput );
 
@@ -23,9 +23,19 @@
 #include "config.h"
 #endif
 
+#include <errno.h>
+#include <math.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 extern "C" {
 #include <positionid.h>
 #include <eval.h>
+#include <inputs.h>
+#include <lib/neuralnet.h>
 }
 
 #include "pytrainer.h"
@@ -78,6 +88,72 @@ struct DataPosition {
   float		probs[5];
 };
 
+// A net input with a value other than 0 or 1.
+
+struct SparseInput {
+  unsigned short	i;
+  float			v;
+};
+
+// Net inputs of a position: indices of the inputs equal to 1 in
+// Trainer::binary, and the other non zero inputs in Trainer::inputs.
+
+struct InputRange {
+  uint		bfirst;
+  uint		bn;
+  uint		ffirst;
+  uint		fn;
+};
+
+// What the trainer needs of a position, computed once in Trainer::decode.
+
+struct DecodedPosition {
+  // net class used to train the position, -1 if none
+  int		trainClass;
+  // net class used to evaluate the position, -1 if the evaluation is fixed
+  int		evalClass;
+
+  InputRange	train;
+  // same as train unless the two classes use different inputs
+  InputRange	eval;
+
+  float		desired[5];
+
+  // evaluation when evalClass < 0
+  float		fixed[5];
+
+  int		raceFix;
+  RaceFix	rf;
+};
+
+// Header of a feature store file, written by Trainer::save. The sections
+// (positions, decoded positions, binary inputs, float inputs) follow, each
+// starting on a STORE_ALIGN boundary, so the whole file can be mapped and
+// used in place.
+
+#define STORE_MAGIC "gnubgFS"
+#define STORE_VERSION 2
+#define STORE_ALIGN 64
+#define STORE_NAMELEN 32
+#define STORE_SOURCELEN 64
+
+struct StoreHeader {
+  char		magic[8];
+  unsigned int	version;
+  // sizeof(DecodedPosition): stores are specific to a build
+  unsigned int	decodedSize;
+  unsigned int	ignoreBGs;
+  unsigned int	nPositions;
+  unsigned int	nBinary;
+  unsigned int	nInputs;
+  // input functions and number of inputs of the nets the store was made for
+  char		inputs[N_CLASSES][STORE_NAMELEN];
+  unsigned int	cInput[N_CLASSES];
+  // identifies the data file the positions came from, as given by the
+  // caller (train.py uses its size and MD5 sum)
+  char		source[STORE_SOURCELEN];
+};
+
 class Trainer {
 public:
   Trainer(uint n);
@@ -129,11 +205,42 @@ public:
       absEquityError = sqrt(absEquityError / n);
       noBGerror = sqrt(noBGerror / n);
     }
+
+    void merge(Errors const& e) {
+      equityError += e.equityError;
+      absEquityError += e.absEquityError;
+      noBGerror += e.noBGerror;
+      
+      if( e.maxEquityError > maxEquityError ) {
+	maxEquityError = e.maxEquityError;
+      }
+      if( e.maxAbsEquityError > maxAbsEquityError ) {
+	maxAbsEquityError = e.maxAbsEquityError;
+      }
+      if( e.maxNoBGerror > maxNoBGerror ) {
+	maxNoBGerror = e.maxNoBGerror;
+      }
+    }
   };
   
   void	errors(Errors& e) const;
   
-  void	train(double a, const int* order) const;
+  // Train on all positions with learning rate a, or with a rate that
+  // decreases with the number of positions trained when a < 0. Returns
+  // false (with errno set) when the batch gradients can not be allocated.
+  bool	train(double a, const int* order) const;
+
+  // Compute net classes and inputs of all positions. Training and error
+  // computation then work from those, in batches and on several threads.
+  void	decode(void);
+
+  // Write positions and decoded data to a feature store file.
+  bool	save(const char* fileName) const;
+
+  // Map a feature store file made by save(). Returns 0 on success,
+  // otherwise an error message. A non empty source must match the one
+  // the store was saved with.
+  const char* load(const char* fileName, const char* source);
   
   uint			nPositions;
   DataPosition*		positions;
@@ -141,6 +248,57 @@ public:
   bool			ignoreBGs;
   bool			pruneNet;
   int*			tList;
+
+  // written to the header by save()
+  char			source[STORE_SOURCELEN];
+
+  // number of threads used by train() and errors()
+  uint			nThreads;
+  // number of positions per weights update
+  uint			batchSize;
+
+  DecodedPosition*	decoded;
+  unsigned short*	binary;
+  uint			nBinary;
+  SparseInput*		inputs;
+  uint			nInputs;
+
+private:
+  // set when the data above lives in a mapped feature store
+  void*			map;
+  size_t		mapSize;
+
+  uint			nBinaryAlloc;
+  uint			nInputsAlloc;
+  
+  void		addInputs(InputRange& r, const float* arInput, uint cInput);
+  
+  static void	storeLayout(StoreHeader const& h, size_t offsets[5]);
+
+  struct Work {
+    Trainer const*	trainer;
+    
+    uint		from;
+    uint		to;
+
+    // train
+    double		a;
+    const int*		order;
+    bool		failed;
+
+    // errors
+    Errors		e;
+  };
+
+  static void*	trainWork(void* w);
+  static void*	errorsWork(void* w);
+
+  void		run(void* (*f)(void*), Work* work, uint n) const;
+
+  void		expand(float* arInput, InputRange const& r, uint cInput) const;
+  
+  void		errorsSerial(Errors& e) const;
+  void		trainSerial(double a, const int* order) const;
 };
 
 Trainer::Trainer(uint const n) :
@@ -148,19 +306,507 @@ Trainer::Trainer(uint const n) :
   positions(new DataPosition [nPositions]),
   ignoreBGs(false),
   pruneNet(false),
-  tList(0)
-{}
+  tList(0),
+  nThreads(1),
+  batchSize(1),
+  decoded(0),
+  binary(0),
+  nBinary(0),
+  inputs(0),
+  nInputs(0),
+  map(0),
+  mapSize(0),
+  nBinaryAlloc(0),
+  nInputsAlloc(0)
+{
+  memset(source, 0, sizeof(source));
+}
 
 Trainer::~Trainer()
 {
-  delete [] positions;
+  if( map ) {
+    munmap(map, mapSize);
+  } else {
+    delete [] positions;
+    delete [] decoded;
+    free(binary);
+    free(inputs);
+  }
   delete [] tList;
 }
 
 typedef int Board[2][25];
 
+void
+Trainer::addInputs(InputRange& r, const float* const arInput, uint const cInput)
+{
+  r.bfirst = nBinary;
+  r.ffirst = nInputs;
+
+  for(uint i = 0; i < cInput; ++i) {
+    if( arInput[i] == 1.0 ) {
+      if( nBinary == nBinaryAlloc ) {
+	nBinaryAlloc = nBinaryAlloc ? 2 * nBinaryAlloc : 32 * nPositions;
+	binary = static_cast<unsigned short*>
+	  (realloc(binary, nBinaryAlloc * sizeof(*binary)));
+      }
+      binary[nBinary++] = i;
+    } else if( arInput[i] != 0.0 ) {
+      if( nInputs == nInputsAlloc ) {
+	nInputsAlloc = nInputsAlloc ? 2 * nInputsAlloc : 32 * nPositions;
+	inputs = static_cast<SparseInput*>
+	  (realloc(inputs, nInputsAlloc * sizeof(*inputs)));
+      }
+      inputs[nInputs].i = i;
+      inputs[nInputs].v = arInput[i];
+      ++nInputs;
+    }
+  }
+
+  r.bn = nBinary - r.bfirst;
+  r.fn = nInputs - r.ffirst;
+}
+
+void
+Trainer::decode(void)
+{
+  Board board;
+  float arInput[MAX_NUM_INPUTS];
+
+  // pruning nets have their own entry points
+  if( pruneNet ) {
+    return;
+  }
+
+  decoded = new DecodedPosition [nPositions];
+
+  for(uint k = 0; k < nPositions; ++k) {
+    DataPosition& t = positions[k];
+    DecodedPosition& d = decoded[k];
+
+    PositionFromKey(board, t.auch);
+
+    d.trainClass = TrainNetClass(board);
+    d.evalClass = EvalNetClass(board);
+    d.raceFix = ClassifyPosition(board) == CLASS_RACE;
+    if( d.raceFix ) {
+      raceImprovementInfo(board, &d.rf);
+    }
+
+    // As TrainPosition, which sanity checks the data in place
+    if( ! ignoreBGs ) {
+      EvalSanityCheck(board, t.probs);
+      memcpy(d.desired, t.probs, sizeof(d.desired));
+    } else {
+      float const p[5] = {t.probs[0], t.probs[1], 0.0, t.probs[3], 0.0};
+      memcpy(d.desired, p, sizeof(d.desired));
+      EvalSanityCheck(board, d.desired);
+    }
+
+    if( d.evalClass < 0 ) {
+      EvaluatePositionFast(board, d.fixed);
+    }
+
+    memset(&d.train, 0, sizeof(d.train));
+    memset(&d.eval, 0, sizeof(d.eval));
+
+    if( d.trainClass >= 0 ) {
+      addInputs(d.train, arInput, classInputs(d.trainClass, board, arInput));
+    }
+
+    if( d.evalClass >= 0 ) {
+      if( d.trainClass >= 0 && classSameInputs(d.evalClass, d.trainClass) ) {
+	d.eval = d.train;
+      } else {
+	addInputs(d.eval, arInput, classInputs(d.evalClass, board, arInput));
+      }
+    }
+  }
+}
+
+void
+Trainer::storeLayout(StoreHeader const& h, size_t offsets[5])
+{
+  size_t const sizes[4] = {
+    h.nPositions * sizeof(DataPosition),
+    h.nPositions * sizeof(DecodedPosition),
+    h.nBinary * sizeof(unsigned short),
+    h.nInputs * sizeof(SparseInput)
+  };
+  size_t o = sizeof(StoreHeader);
+
+  for(uint k = 0; k < 4; ++k) {
+    o = (o + STORE_ALIGN - 1) & ~size_t(STORE_ALIGN - 1);
+    offsets[k] = o;
+    o += sizes[k];
+  }
+  // end of file
+  offsets[4] = o;
+}
+
+static void
+storeNets(StoreHeader& h)
+{
+  memset(h.inputs, 0, sizeof(h.inputs));
+
+  for(uint pc = 0; pc < N_CLASSES; ++pc) {
+    const char* const name = classInputsName(pc);
+
+    h.cInput[pc] = name ? classNet(pc)->cInput : 0;
+    if( name ) {
+      strncpy(h.inputs[pc], name, STORE_NAMELEN - 1);
+    }
+  }
+}
+
+bool
+Trainer::save(const char* const fileName) const
+{
+  if( ! decoded ) {
+    errno = EINVAL;
+    return false;
+  }
+
+  FILE* const f = fopen(fileName, "wb");
+
+  if( ! f ) {
+    return false;
+  }
+
+  StoreHeader h;
+  size_t offsets[5];
+
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, STORE_MAGIC, sizeof(STORE_MAGIC));
+  h.version = STORE_VERSION;
+  h.decodedSize = sizeof(DecodedPosition);
+  h.ignoreBGs = ignoreBGs;
+  h.nPositions = nPositions;
+  h.nBinary = nBinary;
+  h.nInputs = nInputs;
+  storeNets(h);
+  memcpy(h.source, source, sizeof(h.source));
+
+  storeLayout(h, offsets);
+
+  const void* const sections[4] = { positions, decoded, binary, inputs };
+  size_t const sizes[4] = {
+    nPositions * sizeof(DataPosition),
+    nPositions * sizeof(DecodedPosition),
+    nBinary * sizeof(unsigned short),
+    nInputs * sizeof(SparseInput)
+  };
+
+  bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+  size_t o = sizeof(h);
+
+  for(uint k = 0; ok && k < 4; ++k) {
+    static const char zeros[STORE_ALIGN] = {0};
+    size_t const pad = offsets[k] - o;
+
+    ok = fwrite(zeros, 1, pad, f) == pad &&
+      (sizes[k] == 0 || fwrite(sections[k], sizes[k], 1, f) == 1);
+    o = offsets[k] + sizes[k];
+  }
+
+  if( fclose(f) != 0 ) {
+    ok = false;
+  }
+
+  return ok;
+}
+
+const char*
+Trainer::load(const char* const fileName, const char* const src)
+{
+  int const fd = open(fileName, O_RDONLY);
+  struct stat st;
+
+  if( fd < 0 || fstat(fd, &st) != 0 ) {
+    const char* const err = strerror(errno);
+
+    if( fd >= 0 ) {
+      close(fd);
+    }
+    return err;
+  }
+
+  if( size_t(st.st_size) < sizeof(StoreHeader) ) {
+    close(fd);
+    return "not a feature store";
+  }
+
+  void* const m = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if( m == MAP_FAILED ) {
+    return strerror(errno);
+  }
+
+  StoreHeader const& h = *static_cast<StoreHeader*>(m);
+  StoreHeader nets;
+  size_t offsets[5];
+  const char* err = 0;
+
+  storeNets(nets);
+
+  if( memcmp(h.magic, STORE_MAGIC, sizeof(STORE_MAGIC)) != 0 ) {
+    err = "not a feature store";
+  } else if( h.version != STORE_VERSION ||
+	     h.decodedSize != sizeof(DecodedPosition) ) {
+    err = "feature store made by another version";
+  } else if( memcmp(h.inputs, nets.inputs, sizeof(h.inputs)) != 0 ||
+	     memcmp(h.cInput, nets.cInput, sizeof(h.cInput)) != 0 ) {
+    err = "feature store made for other nets";
+  } else if( src && *src && strncmp(h.source, src, STORE_SOURCELEN) != 0 ) {
+    err = "feature store made from another data file";
+  } else {
+    storeLayout(h, offsets);
+    if( offsets[4] > size_t(st.st_size) ) {
+      err = "truncated feature store";
+    }
+  }
+
+  if( err ) {
+    munmap(m, st.st_size);
+    return err;
+  }
+
+  char* const base = static_cast<char*>(m);
+
+  delete [] positions;
+
+  map = m;
+  mapSize = st.st_size;
+  nPositions = h.nPositions;
+  ignoreBGs = h.ignoreBGs;
+  positions = reinterpret_cast<DataPosition*>(base + offsets[0]);
+  decoded = reinterpret_cast<DecodedPosition*>(base + offsets[1]);
+  binary = reinterpret_cast<unsigned short*>(base + offsets[2]);
+  nBinary = h.nBinary;
+  inputs = reinterpret_cast<SparseInput*>(base + offsets[3]);
+  nInputs = h.nInputs;
+  memcpy(source, h.source, sizeof(source));
+
+  madvise(m, mapSize, MADV_WILLNEED);
+
+  return 0;
+}
+
+void
+Trainer::expand(float* const arInput, InputRange const& r,
+		uint const cInput) const
+{
+  memset(arInput, 0, cInput * sizeof(*arInput));
+
+  for(uint k = r.bfirst; k < r.bfirst + r.bn; ++k) {
+    arInput[binary[k]] = 1.0;
+  }
+  for(uint k = r.ffirst; k < r.ffirst + r.fn; ++k) {
+    arInput[inputs[k].i] = inputs[k].v;
+  }
+}
+
+void
+Trainer::run(void* (*f)(void*), Work* const work, uint const n) const
+{
+  uint const nt = n > 1 ? n : 1;
+  pthread_t* threads = new pthread_t [nt];
+  uint k;
+  
+  for(k = 0; k < nt; ++k) {
+    work[k].trainer = this;
+    work[k].from = (k * nPositions) / nt;
+    work[k].to = ((k + 1) * nPositions) / nt;
+  }
+
+  // The calling thread takes the first share
+  for(k = 1; k < nt; ++k) {
+    if( pthread_create(&threads[k], 0, f, &work[k]) != 0 ) {
+      break;
+    }
+  }
+
+  f(&work[0]);
+
+  for(uint j = 1; j < k; ++j) {
+    pthread_join(threads[j], 0);
+  }
+
+  // shares whose thread could not be started
+  for(/**/; k < nt; ++k) {
+    f(&work[k]);
+  }
+  
+  delete [] threads;
+}
+
+void*
+Trainer::errorsWork(void* const w)
+{
+  Work& work = *static_cast<Work*>(w);
+  Trainer const& t = *work.trainer;
+  float arInput[MAX_NUM_INPUTS];
+  Board board;
+  float p[5];
+
+  for(uint k = work.from; k < work.to; ++k) {
+    DecodedPosition const& d = t.decoded[k];
+
+    if( d.evalClass < 0 ) {
+      memcpy(p, d.fixed, sizeof(p));
+    } else {
+      neuralnet* const nn = classNet(d.evalClass);
+      
+      t.expand(arInput, d.eval, nn->cInput);
+      NeuralNetEvaluate(nn, arInput, p);
+
+      if( d.raceFix ) {
+	raceImprovementApply(&d.rf, p);
+      }
+      
+      PositionFromKey(board, t.positions[k].auch);
+      EvalSanityCheck(board, p);
+    }
+
+    float const* const probs = t.positions[k].probs;
+    
+    work.e.add_eq(eqErr(p, probs));
+    work.e.add_aeq(eqAbsErr(p, probs));
+    work.e.add_mnbg(noBGErr(p, probs));
+  }
+
+  return 0;
+}
+
+void*
+Trainer::trainWork(void* const w)
+{
+  Work& work = *static_cast<Work*>(w);
+  Trainer const& t = *work.trainer;
+  uint const nBatch = t.batchSize > 0 ? t.batchSize : 1;
+  
+  float* const arInputs = new float [nBatch * MAX_NUM_INPUTS];
+  float** const aarInput = new float* [nBatch];
+  float** const aarDesired = new float* [nBatch];
+  neuralnetgrad* agrad[N_CLASSES];
+  int pcBatch = -1;
+  uint n = 0;
+
+  for(uint k = 0; k < nBatch; ++k) {
+    aarInput[k] = arInputs + k * MAX_NUM_INPUTS;
+  }
+  for(uint k = 0; k < N_CLASSES; ++k) {
+    agrad[k] = 0;
+  }
+
+  for(uint k = work.from; k <= work.to; ++k) {
+    DecodedPosition const* const d =
+      k < work.to ? &t.decoded[work.order ? work.order[k] : k] : 0;
+
+    if( d && d->trainClass < 0 ) {
+      continue;
+    }
+    
+    if( n > 0 && (! d || d->trainClass != pcBatch || n == nBatch) ) {
+      neuralnet* const nn = classNet(pcBatch);
+      
+      if( ! agrad[pcBatch] ) {
+	agrad[pcBatch] = new neuralnetgrad;
+	if( NeuralNetGradCreate(agrad[pcBatch], nn) != 0 ) {
+	  delete agrad[pcBatch];
+	  agrad[pcBatch] = 0;
+	  work.failed = true;
+	  break;
+	}
+      }
+
+      // adaptive alpha, as TrainPosition does, taken once per batch
+      double const a =
+	work.a < 0 ? 2.0 / pow(100.0 + nn->nTrained, 0.25) : work.a;
+      
+      NeuralNetTrainBatch(nn, agrad[pcBatch], n, aarInput, aarDesired, a);
+      n = 0;
+    }
+
+    if( d ) {
+      pcBatch = d->trainClass;
+      t.expand(aarInput[n], d->train, classNet(pcBatch)->cInput);
+      aarDesired[n] = const_cast<float*>(d->desired);
+      ++n;
+    }
+  }
+
+  for(uint k = 0; k < N_CLASSES; ++k) {
+    if( agrad[k] ) {
+      NeuralNetGradDestroy(agrad[k]);
+      delete agrad[k];
+    }
+  }
+  delete [] aarDesired;
+  delete [] aarInput;
+  delete [] arInputs;
+  
+  return 0;
+}
+
 void
 Trainer::errors(Errors& e) const
+{
+  if( ! decoded ) {
+    errorsSerial(e);
+    return;
+  }
+
+  uint const nt = nThreads > 1 ? nThreads : 1;
+  Work* work = new Work [nt];
+
+  run(errorsWork, work, nt);
+
+  for(uint k = 0; k < nt; ++k) {
+    e.merge(work[k].e);
+  }
+  delete [] work;
+  
+  e.adjust(nPositions);
+}
+
+bool
+Trainer::train(double const a, const int* const order) const
+{
+  // partial training goes through TrainPosition, which honours tList
+  if( ! decoded || tList ) {
+    trainSerial(a, order);
+    return true;
+  }
+
+  uint const nt = nThreads > 1 ? nThreads : 1;
+  Work* work = new Work [nt];
+  bool ok = true;
+
+  for(uint k = 0; k < nt; ++k) {
+    work[k].a = a;
+    work[k].order = order;
+    work[k].failed = false;
+  }
+  
+  run(trainWork, work, nt);
+
+  for(uint k = 0; k < nt; ++k) {
+    if( work[k].failed ) {
+      ok = false;
+    }
+  }
+  delete [] work;
+
+  if( ! ok ) {
+    errno = ENOMEM;
+  }
+  return ok;
+}
+
+void
+Trainer::errorsSerial(Errors& e) const
 {
   Board board;
   float p[5];
@@ -185,7 +831,7 @@ Trainer::errors(Errors& e) const
 }
 
 void
-Trainer::train(double const a, const int* const order) const
+Trainer::trainSerial(double const a, const int* const order) const
 {
   Board board;
 
@@ -230,6 +876,11 @@ trainer_errors(PyObject* self, PyObject*);
 static PyObject*
 trainer_train(PyObject* self, PyObject* args);
 
+static PyObject*
+trainer_save(PyObject* self, PyObject* args);
+
+static PyObject*
+trainer_size(PyObject* self, PyObject*);
 
 static PyMethodDef trainer_methods[] = {
   {"errors",	trainer_errors, METH_NOARGS,
@@ -237,6 +888,12 @@ static PyMethodDef trainer_methods[] = {
 
   {"train",	trainer_train, METH_VARARGS,
    ""},
+
+  {"save",	trainer_save, METH_VARARGS,
+   "Save decoded positions to a feature store file"},
+
+  {"size",	trainer_size, METH_NOARGS,
+   "Number of training positions"},
   
   {0,0,0,0}		/* sentinel */
 };
@@ -353,14 +1010,47 @@ trainer_train(PyObject* self, PyObject* args)
     }
   }
   
-  t.train(a, order);
+  bool const ok = t.train(a, order);
 
   delete [] order;
+
+  if( ! ok ) {
+    PyErr_SetFromErrno(PyExc_MemoryError);
+    return 0;
+  }
   
   Py_INCREF(Py_None);
   return Py_None;
 }
 
+static PyObject*
+trainer_save(PyObject* self, PyObject* args)
+{
+  {                                 assert( self->ob_type == &Trainer_Type ); }
+
+  Trainer& t = *static_cast<TrainerObject*>(self)->trainer;
+  char* fileName;
+  
+  if( !PyArg_ParseTuple(args, "s", &fileName) ) {
+    return 0;
+  }
+
+  if( ! t.save(fileName) ) {
+    PyErr_SetFromErrnoWithFilename(PyExc_IOError, fileName);
+    return 0;
+  }
+  
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+static PyObject*
+trainer_size(PyObject* self, PyObject*)
+{
+  {                               assert( self->ob_type == &Trainer_Type ); }
+
+  return PyInt_FromLong(static_cast<TrainerObject*>(self)->trainer->nPositions);
+}
 
 PyObject*
 newTrainer(PyObject* const args)
@@ -369,12 +1059,60 @@ newTrainer(PyObject* const args)
   int flag = 0;
   int prune = 0;
   PyObject* tList = 0;
+  int nThreads = 1;
+  int batchSize = 1;
+  const char* source = 0;
   
-  if( !PyArg_ParseTuple(args, "O|iiO", &data, &flag, &prune, &tList)) {
+  if( !PyArg_ParseTuple(args, "O|iiOiis", &data, &flag, &prune, &tList,
+			&nThreads, &batchSize, &source)) {
     return 0;
   }
 
+  // gnubg.trainer(data, flag, prune, None, ...) means no list
+  if( tList == Py_None ) {
+    tList = 0;
+  }
+
+  if( nThreads < 1 || batchSize < 1 ) {
+    PyErr_SetString(PyExc_ValueError, "invalid threads/batch size.") ;
+    return 0;
+  }
+
+  // A feature store made by trainer.save()
+  if( PyString_Check(data) ) {
+    if( prune || tList ) {
+      PyErr_SetString(PyExc_ValueError,
+		      "feature stores do not support pruning or partial training.");
+      return 0;
+    }
+    
+    Trainer& t = *(new Trainer(0));
+    const char* const err = t.load(PyString_AS_STRING(data), source);
+    
+    if( err ) {
+      PyErr_Format(PyExc_ValueError, "%s: %s.", PyString_AS_STRING(data), err);
+      delete &t;
+      return 0;
+    }
+    
+    if( bool(flag) != t.ignoreBGs ) {
+      PyErr_SetString(PyExc_ValueError,
+		      "feature store made with another ignore BGs setting.");
+      delete &t;
+      return 0;
+    }
+
+    t.nThreads = nThreads;
+    t.batchSize = batchSize;
+    
+    TrainerObject* o = PyObject_New(TrainerObject, &Trainer_Type);
+    o->trainer = &t;
+  
+    return o;
+  }
+  
   if( ! PySequence_Check(data) ) {
+    PyErr_SetString(PyExc_ValueError, "not a list.") ;
     return 0;
   }
   
@@ -383,10 +1121,16 @@ newTrainer(PyObject* const args)
 
   t.ignoreBGs = flag;
   t.pruneNet = prune;
+  t.nThreads = nThreads;
+  t.batchSize = batchSize;
+  if( source ) {
+    strncpy(t.source, source, STORE_SOURCELEN - 1);
+  }
 
   if( tList ) {
     if( ! PySequence_Check(tList) ) {
       PyErr_SetString(PyExc_ValueError, "not a list.") ;
+      delete &t;
       return 0;
     }
     if( uint const s = PySequence_Size(tList) ) {
@@ -405,6 +1149,8 @@ newTrainer(PyObject* const args)
 
     PyObject* const pl = PySequence_Fast_GET_ITEM(data, k);
     if( ! (pl && PyString_Check(pl)) ) {
+      PyErr_SetString(PyExc_ValueError, "invalid position (not a string).");
+      delete &t;
       return 0;
     }
 
@@ -432,6 +1178,8 @@ newTrainer(PyObject* const args)
     }
   }
 
+  t.decode();
+  
   TrainerObject* o = PyObject_New(TrainerObject, &Trainer_Type);
   o->trainer = &t;
   
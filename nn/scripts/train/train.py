@@ -1,7 +1,7 @@
 #!/usr/bin/env pygnubg 
-""" train [-a alpha -l low-alpha -b benchnark -v -n] dat-file net-base-name"""
+""" train [-a alpha -l low-alpha -b benchnark -v -n -t threads --batch n --store file] dat-file net-base-name"""
 
-import sys, string, os, time, glob, getopt
+import sys, string, os, time, glob, getopt, hashlib
 
 from bgutil import *
 from referr import benchmarkError
@@ -30,9 +30,12 @@ targetClass = gnubg.c_contact
 benchmarkFile = None
 iTrain = list()
 ignoreBG = 0
+nThreads = 1
+batchSize = 1
+storeFile = None
 
-optlist, args = getopt.getopt(sys.argv[1:], "a:l:nvb:i:", \
-                              ["class=", "ignorebg"])
+optlist, args = getopt.getopt(sys.argv[1:], "a:l:nvb:i:t:", \
+                              ["class=", "ignorebg", "batch=", "store="])
 
 for o, a in optlist:
   if o == '-a':
@@ -51,6 +54,12 @@ for o, a in optlist:
     ignoreBG = 1
   elif o == '-i':
     iTrain = [int(x) for x in a.split()]
+  elif o == '-t':
+    nThreads = int(a)
+  elif o == '--batch':
+    batchSize = int(a)
+  elif o == '--store':
+    storeFile = a
     
 
 
@@ -60,22 +69,63 @@ except :
   print >> sys.stderr, "Usage:", sys.argv[0],"dat-file net-base-name"
   sys.exit(1)
   
-if verbose:
-  print "reading training data file"
-  
-data = readData(dataFileName)
-
-nPos = len(data)
-
 # Should training ignore backgammons?
 ignoreBGs = ignoreBG or targetClass == gnubg.c_race
 
-# Third argument is true if you want to train the small pruning nets.
-# iTrain is a list of input positions to train. Part of my experiments (JH)
+# Identifies the data file a feature store is made from: its size and MD5 sum
+#
+def dataSource(fileName) :
+  m = hashlib.md5()
+  f = open(fileName, "rb")
+  while 1 :
+    b = f.read(1 << 20)
+    if not b :
+      break
+    m.update(b)
+  f.close()
+  return "%d %s" % (os.path.getsize(fileName), m.hexdigest())
+
+source = ""
+if storeFile :
+  source = dataSource(dataFileName)
+
+# With a feature store, the net inputs of the training positions are computed
+# once and read back from the store on later runs.
 #
-trainer = gnubg.trainer(data, ignoreBGs, 0, iTrain)
+if storeFile and os.path.exists(storeFile) :
+  # the store holds all positions, it can't train a part of them
+  if len(iTrain) :
+    print >> sys.stderr, "-i can't be used with an existing feature store"
+    sys.exit(1)
+    
+  if verbose:
+    print "mapping feature store", storeFile
+
+  trainer = gnubg.trainer(storeFile, ignoreBGs, 0, None, nThreads, batchSize,
+                          source)
+  nPos = trainer.size()
+else :
+  if verbose:
+    print "reading training data file"
+  
+  data = readData(dataFileName)
+
+  nPos = len(data)
+
+  # Third argument is true if you want to train the small pruning nets.
+  # iTrain is a list of input positions to train. Part of my experiments (JH)
+  # Training and error computation use nThreads threads, and weights are
+  # updated once every batchSize positions.
+  #
+  trainer = gnubg.trainer(data, ignoreBGs, 0, iTrain, nThreads, batchSize,
+                          source)
   
-del data
+  del data
+
+  if storeFile :
+    if verbose:
+      print "creating feature store", storeFile
+    trainer.save(storeFile)
 
 alpha = alphaStart
 
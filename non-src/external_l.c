@@ -561,8 +561,8 @@ static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
 	yyg->yy_hold_char = *yy_cp; \
 	*yy_cp = '\0'; \
 	yyg->yy_c_buf_p = yy_cp;
-#define YY_NUM_RULES 36
-#define YY_END_OF_BUFFER 37
+#define YY_NUM_RULES 37
+#define YY_END_OF_BUFFER 38
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -570,352 +570,518 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[281] =
+static const flex_int16_t yy_accept[289] =
     {   0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       37,   35,   34,   34,   35,   35,   18,   35,   35,   17,
-       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
-       35,   35,   35,   35,   31,   31,   35,   35,   17,   30,
-       32,   32,   32,   32,   32,   32,   35,   35,   17,   33,
-       33,   33,   33,   33,   33,   35,   35,   35,   35,   35,
-       35,   35,   35,   35,   35,   34,    0,   15,    0,    0,
-       17,   16,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   31,    0,   32,    0,   17,   32,   32,   32,   32,
-
-       32,   32,   32,    0,   33,    0,   17,   33,   33,   33,
-       33,   33,   33,   33,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   14,    0,    0,   13,    0,    0,    0,
-        0,    0,    0,   32,   32,   32,   32,   33,   33,   33,
-       33,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   16,    0,    0,    0,    0,    0,    0,    0,    0,
-        3,    4,    0,    0,    7,    0,    0,   32,   32,   33,
-       33,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   10,    0,    0,    6,    0,    0,    0,
-
-       32,   33,    0,    0,   22,    0,    0,    0,    0,    0,
-        0,    0,    0,    1,    8,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   27,   28,   29,    0,
-        0,    0,    0,    2,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    9,   20,    0,   23,    0,
-        0,    0,    0,    0,    0,    0,    0,   24,    0,    0,
-        0,    0,   12,    5,    0,    0,    0,    0,   11,    0,
-        0,   26,    0,    0,    0,   19,   21,    0,   25,    0
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   38,   36,   35,   35,   36,   36,   18,   36,   36,   17,
+   36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+   36,   36,   36,   36,   32,   32,   36,   36,   17,   31,
+   33,   33,   33,   33,   33,   33,   36,   36,   17,   34,
+
+   34,   34,   34,   34,   34,   36,   36,   36,   36,   36,
+   36,   36,   36,   36,   36,   36,   35,    0,   15,    0,
+   15,    0,   17,   16,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   32,    0,   33,    0,   33,   17,   33,
+
+   33,   33,   33,   33,   33,   33,    0,   34,    0,   34,
+   17,   34,   34,   34,   34,   34,   34,   34,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   14,    0,
+    0,   13,    0,    0,    0,    0,    0,    0,   33,   33,
+
+   33,   33,   34,   34,   34,   34,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   16,    0,    0,
+    0,    0,    0,    0,    0,    0,    3,    4,    0,    0,
+    7,    0,    0,   33,   33,   34,   34,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+   10,    0,    0,    6,    0,    0,    0,   33,   34,    0,
+    0,   23,    0,    0,    0,    0,    0,    0,    0,    0,
+   20,    1,    8,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   28,   29,   30,    0,    0,    0,
+    0,    2,    0,    0,    0,    0,    0,    0,    0,    0,
+
+    0,    0,    0,    9,   21,    0,   24,    0,    0,    0,
+    0,    0,    0,    0,    0,   25,    0,    0,    0,    0,
+   12,    5,    0,    0,    0,    0,   11,    0,    0,   27,
+    0,    0,    0,   19,   22,    0,   26,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
     {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    1,    4,    1,    1,    1,    1,    5,    6,
-        6,    1,    7,    6,    7,    8,    1,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,   10,    1,    1,
-        1,    1,    1,    1,   11,   12,   13,   14,   15,   16,
-       17,   18,   19,   20,   21,   22,   23,   24,   25,   26,
-       27,   28,   29,   30,   31,   32,   33,   34,   35,   21,
-        6,    1,    6,    1,   21,    1,   36,   37,   38,   39,
-
-       40,   41,   42,   43,   44,   45,   21,   46,   47,   48,
-       49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
-       59,   21,    6,    1,    6,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
+    1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
+    1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    2,    1,    4,    1,    1,    1,    1,    5,    6,
+    6,    1,    7,    6,    7,    8,    1,    9,    9,    9,
+
+    9,    9,    9,    9,    9,    9,    9,   10,    1,    1,
+    1,    1,    1,    1,   11,   12,   13,   14,   15,   16,
+   17,   18,   19,   20,   21,   22,   23,   24,   25,   26,
+   27,   28,   29,   30,   31,   32,   33,   34,   35,   21,
+    6,    1,    6,    1,   21,    1,   11,   12,   13,   14,
+
+   15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
+   25,   26,   27,   28,   29,   30,   31,   32,   33,   34,
+   35,   21,    6,    1,    6,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+    1,    1,    1,    1,    1
     } ;
 
-static const YY_CHAR yy_meta[60] =
+static const YY_CHAR yy_meta[36] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    3,    3,    1,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[291] =
+static const flex_int16_t yy_base[289] =
     {   0,
-        0,    0,   59,  118,  177,  236,  295,    0,  353,    0,
-      361,  818,   68,   70,  287,  281,  818,   68,  270,   70,
-       49,   65,   53,   93,   66,   62,  115,  117,   62,   60,
-       77,  104,  120,  121,   93,   99,  272,  268,  136,  818,
-      262,  138,  143,  180,  142,  182,  243,  222,  167,  209,
-      187,  181,  208,  163,  195,  193,  220,  194,  218,  242,
-      113,  239,  236,  252,  225,  197,  207,  818,  200,  164,
-      205,  253,  258,  345,  347,  340,  235,  348,  237,  235,
-      329,  217,  348,  354,  367,  346,  353,  345,  345,  350,
-      351,  385,  165,  818,  152,  398,  146,  386,  407,  403,
-
-      410,  406,  388,  148,  818,  142,  412,  123,  408,  420,
-      417,  432,  416,  419,  415,  420,  426,  399,  426,  440,
-      426,  405,  420,   90,  422,  421,  433,  427,  433,  436,
-      440,  452,  466,  475,  480,  485,  491,  452,  450,  493,
-      470,  462,  495,  492,  499,  497,  506,  495,  514,  498,
-      517,  479,  485,  511,  512,  498,  500,  515,  508,  514,
-      107,   94,  520,  519,  508,  538,  528,  532,  547,  518,
-      562,  564,  528,  569,  571,  573,  538,  569,  577,  573,
-      584,  568,  573,  588,  565,  582,  580,  568,  583,  582,
-       83,  598,  591,  603,  609,  582,  613,  587,  588,  597,
-
-      630,  633,  597,  601,  637,  599,  622,  620,  609,  645,
-      649,  653,  621,  818,  655,  623,  648,  649,  661,  641,
-      637,  642,  649,  643,  642,  645,  672,  676,  678,  665,
-      663,  659,  670,  689,  696,  700,  674,  702,  664,  676,
-      675,  679,  685,  698,  699,  713,  716,  692,  719,  723,
-      704,  705,  709,  707,  733,  738,  701,  740,  709,  714,
-      720,  744,  747,  755,  730,  729,  758,  739,  762,  751,
-      748,  768,  770,  772,  755,  775,  777,  779,  782,  818,
-      793,  796,  799,  802,  805,  808,   85,  811,  814,   79
+    0,   35,   69,  104,  136,  171,  203,  235,  269,  299,
+   76, 1414,  140,  208,  334,  369, 1414,  204,   68,  216,
+  119,  131,  241,  215,  199,  196,  259,  264,  248,  246,
+  263,  257,  272,  275,  289,  403,  406,  441,  468, 1414,
+  496,  283,  271,  490,  270,  322,  511,  546,  573,  499,
+
+  361,  384,  593,  416,  463,  494,  582,  495,  500,  538,
+  558,  589,  590,  599,  596,  591,  617,  620, 1414,  655,
+ 1414,  614,  683,  643,  682,  682,  684,  677,  675,  686,
+  677,  670,  668,  700,  688,  691,  704,  683,  690,  680,
+  680,  684,  684,  712,  715, 1414,  750, 1414,  778,  805,
+
+  696,  839,  737,  841,  757,  786,  844, 1414,  879, 1414,
+  907,  934,  825,  968,  866,  970,  886,  915,  963,  964,
+  964,  947,  965,  960,  961,  950,  953,  960,  977,  957,
+  956,  966,  959,  961,  962,  966,  978,  992,  994,  996,
+  998, 1000,  981,  975, 1004,  993,  980, 1008,  983, 1011,
+
+ 1000, 1045,  987, 1079, 1002, 1113,  986,  986, 1006, 1034,
+ 1025, 1022, 1037, 1029, 1036, 1068, 1075, 1076, 1072, 1070,
+ 1058, 1115, 1104, 1108, 1147, 1093, 1149, 1151, 1097, 1153,
+ 1155, 1157, 1142, 1147, 1161, 1150, 1195, 1151, 1151, 1229,
+ 1140, 1157, 1156, 1170, 1185, 1184, 1200, 1195, 1231, 1224,
+
+ 1234, 1236, 1215, 1239, 1227, 1214, 1221, 1245, 1279, 1221,
+ 1225, 1250, 1224, 1268, 1261, 1250, 1284, 1313, 1315, 1265,
+ 1317, 1414, 1319, 1293, 1313, 1314, 1324, 1304, 1300, 1302,
+ 1309, 1303, 1314, 1306, 1333, 1335, 1337, 1330, 1323, 1315,
+ 1331, 1343, 1345, 1347, 1337, 1350, 1325, 1331, 1325, 1327,
+
+ 1333, 1345, 1345, 1359, 1361, 1337, 1364, 1366, 1351, 1349,
+ 1353, 1349, 1372, 1374, 1347, 1377, 1352, 1367, 1358, 1382,
+ 1384, 1386, 1368, 1361, 1390, 1370, 1393, 1382, 1379, 1397,
+ 1399, 1401, 1392, 1404, 1406, 1408, 1410, 1414
     } ;
 
-static const flex_int16_t yy_def[291] =
+static const flex_int16_t yy_def[289] =
     {   0,
-      280,    1,  281,  281,  282,  282,  280,    7,    7,    9,
-      280,  280,  280,  280,  283,  284,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  285,  286,  287,  280,
-      287,  287,  287,  287,  287,  287,  288,  289,  290,  290,
-      290,  290,  290,  290,  290,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  283,  280,  284,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  285,  280,  286,  287,  287,  287,  287,  287,
-
-      287,  287,  287,  288,  280,  289,  290,  290,  290,  290,
-      290,  290,  290,  290,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  287,  287,  287,  287,  290,  290,  290,
-      290,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  287,  287,  290,
-      290,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-
-      287,  290,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,    0,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280
+  288,  288,    1,  288,    3,  288,    1,  288,    7,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,   18,  288,
+   39,   41,   41,   41,   41,   41,  288,  288,   18,   49,
+
+   50,   50,   50,   50,   50,  288,  288,  288,  288,  288,
+  288,   28,  288,  288,   32,  288,  288,  288,  288,  288,
+  288,  288,  288,   19,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+
+   41,   41,   41,   41,   41,   41,  288,  288,  288,  288,
+  288,  288,   50,   50,   50,   50,   50,   50,  288,  288,
+  288,  288,  288,   84,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,   41,  288,
+
+   41,  288,   50,  288,   50,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,   41,  288,   50,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,    0
     } ;
 
-static const flex_int16_t yy_nxt[878] =
+static const flex_int16_t yy_nxt[1450] =
     {   0,
-       12,   13,   14,   15,   16,   17,   18,   19,   20,   12,
-       12,   21,   12,   22,   23,   24,   12,   25,   26,   12,
-       12,   12,   12,   27,   28,   29,   30,   12,   31,   32,
-       12,   33,   12,   12,   34,   12,   21,   12,   22,   23,
-       24,   12,   25,   26,   12,   12,   12,   27,   28,   29,
-       30,   12,   31,   32,   12,   33,   12,   12,   34,   12,
-       35,   36,   37,   38,   12,   18,   19,   39,   40,   66,
-       66,   66,   66,   73,   42,   70,   71,   70,   71,   74,
-       79,  108,   43,   44,   75,   80,   76,   97,   45,   86,
-       87,   88,  214,   46,   92,   92,  161,   73,  162,   42,
-
-       92,   92,  162,   77,   74,   79,   43,   44,   75,   80,
-       76,   78,   45,   86,   87,  162,   88,   46,   12,   35,
-       36,   37,   38,   12,   18,   19,   39,   40,   77,   81,
-      280,   89,   83,   42,   90,   91,   78,  120,   84,   82,
-       85,   43,   44,   70,   96,  280,  105,   45,   98,  280,
-      280,  105,   46,  280,   81,   89,   94,   83,   42,   90,
-       91,  120,   84,   82,   85,   43,   44,   99,   94,  102,
-      280,   45,   72,   98,   70,  107,   46,   12,   35,   36,
-       47,   48,   12,   18,   19,   49,   40,  280,  280,  280,
-      113,   99,   51,  102,  280,  100,  103,  109,   66,   66,
-
-       52,   53,  280,  101,   68,  110,   54,  115,  118,  114,
-       68,   55,   70,   71,  113,  280,  280,   51,  134,  134,
-      100,  103,  109,  111,   52,   53,  105,  101,   77,  110,
-       54,  112,  115,  118,  114,   55,   12,   35,   36,   47,
-       48,   12,   18,   19,   49,   40,  105,  116,  111,   82,
-      117,   51,  119,   77,   83,  112,  129,  121,  131,   52,
-       53,   72,   85,  122,  132,   54,  123,  124,  125,  280,
-       55,  116,   94,   82,  117,   94,   51,  119,   72,   83,
-      129,  121,  131,   52,   53,   68,   85,  122,  132,   54,
-       68,  123,  124,  125,   55,   12,   13,   14,   12,   12,
-
-       12,   18,   19,   20,   12,   12,   56,   57,   58,   12,
-       59,   12,   12,   12,   60,   12,   12,   12,   61,   62,
-       63,   12,   64,   12,   32,   12,   12,   12,   12,   34,
-       12,   56,   57,   58,   12,   59,   12,   12,   12,   60,
-       12,   12,   61,   62,   63,   12,   64,   12,   32,   12,
-       12,   12,   12,   34,   35,   36,  126,  127,  128,  130,
-      280,  133,   40,  135,   12,   12,   12,  136,  137,  137,
-      138,  139,   12,  280,  140,  141,   65,  142,   12,  143,
-       12,  126,  127,  128,  130,  133,   92,   92,  135,   12,
-       12,   12,  136,  280,  138,  280,  139,   12,  140,  141,
-
-       65,  142,   12,  143,   12,   70,   96,  144,  134,  134,
-      280,  137,  137,  280,  280,  280,  147,  280,  145,   70,
-      107,  134,  134,  280,  280,  152,  280,  280,  155,  148,
-      153,  144,  149,  137,  137,  159,  146,  154,  156,  280,
-      147,  134,  134,  145,  158,  280,  150,  151,  160,  163,
-      152,  164,  155,  148,  165,  153,  166,  149,  157,  159,
-      146,  167,  154,  156,  168,  169,  170,  171,  171,  158,
-      150,  151,  160,  163,  173,  164,  134,  134,  165,  174,
-      166,  134,  134,  157,  176,  167,  172,  172,  168,  169,
-      177,  170,  137,  137,  175,  175,  137,  137,  173,  280,
-
-      134,  134,  280,  174,  280,  280,  280,  137,  137,  176,
-      182,  179,  181,  280,  177,  134,  134,  183,  137,  137,
-      178,  280,  186,  180,  280,  184,  185,  280,  187,  188,
-      280,  189,  190,  191,  182,  192,  179,  181,  193,  194,
-      194,  183,  195,  196,  178,  198,  186,  180,  197,  197,
-      184,  185,  187,  199,  188,  189,  200,  190,  191,  280,
-      192,  280,  193,  171,  171,  172,  172,  195,  196,  198,
-      194,  194,  175,  175,  137,  137,  280,  199,  137,  137,
-      280,  200,  203,  201,  280,  137,  137,  202,  204,  205,
-      205,  280,  208,  209,  210,  280,  211,  212,  213,  215,
-
-      215,  216,  218,  206,  194,  194,  217,  203,  201,  207,
-      134,  134,  202,  204,  197,  197,  208,  219,  209,  210,
-      211,  220,  212,  213,  221,  222,  216,  218,  206,  223,
-      217,  134,  134,  207,  134,  134,  224,  280,  205,  205,
-      280,  219,  225,  226,  230,  220,  227,  227,  221,  222,
-      228,  228,  231,  223,  229,  229,  215,  215,  232,  233,
-      240,  224,  234,  234,  235,  236,  225,  226,  230,  237,
-      238,  239,  241,  227,  227,  242,  231,  228,  228,  229,
-      229,  243,  245,  232,  233,  240,  244,  248,  235,  236,
-      234,  234,  250,  237,  238,  239,  241,  246,  246,  251,
-
-      242,  247,  247,  249,  249,  252,  243,  245,  253,  254,
-      244,  255,  248,  256,  246,  246,  250,  247,  247,  257,
-      249,  249,  259,  251,  258,  258,  260,  261,  267,  252,
-      262,  265,  253,  254,  263,  263,  255,  266,  256,  264,
-      264,  258,  258,  257,  268,  269,  269,  259,  263,  263,
-      260,  270,  261,  267,  262,  265,  264,  264,  271,  272,
-      272,  266,  273,  269,  269,  274,  275,  278,  268,  272,
-      272,  276,  276,  277,  277,  270,  276,  276,  277,  277,
-      279,  279,  271,  279,  279,  280,  273,  280,  280,  280,
-      274,  275,  278,   41,   41,   41,   50,   50,   50,   67,
-
-      280,   67,   69,  280,   69,   93,  280,   93,   95,  280,
-       95,  104,  280,  104,  106,  280,  106,   11,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280
+   12,   13,   14,   15,   16,   17,   18,   19,   20,   12,
+   12,   21,   12,   22,   23,   24,   12,   25,   26,   12,
+   12,   12,   12,   27,   28,   29,   30,   12,   31,   32,
+   12,   33,   12,   12,   34,   12,   13,   14,   15,   16,
+   17,   18,   19,   20,   12,   12,   21,   12,   22,   23,
+
+   24,   12,   25,   26,   12,   12,   12,   12,   27,   28,
+   29,   30,   12,   31,   32,   12,   33,   12,   12,   34,
+   35,   36,   37,   38,   12,  288,   74,   39,   40,   41,
+   41,   41,   41,   41,   42,   41,   41,   41,   41,   41,
+   41,   41,   43,   44,   41,   41,   41,   41,   45,   41,
+
+   41,   41,   41,   46,   12,   35,   36,   37,   38,   12,
+   18,   19,   39,   40,   41,   41,   41,   41,   41,   42,
+   41,   41,   41,   41,   41,   41,   41,   43,   44,   41,
+   41,   41,   41,   45,   41,   41,   41,   41,   46,   47,
+   48,   67,   67,   75,   49,   76,   50,   50,   50,   50,
+
+   50,   51,   50,   50,   50,   50,   50,   50,   50,   52,
+   53,   50,   50,   50,   50,   54,   50,   50,   50,   50,
+   55,   12,   35,   36,   47,   48,   12,   18,   19,   49,
+   40,   50,   50,   50,   50,   50,   51,   50,   50,   50,
+   50,   50,   50,   50,   52,   53,   50,   50,   50,   50,
+
+   54,   50,   50,   50,   50,   55,   12,   12,   12,   67,
+   67,   72,   73,   81,   56,   57,   58,   12,   59,   82,
+   12,   12,   60,   72,   73,   79,   61,   62,   63,   12,
+   64,   12,   65,   80,   12,   12,   13,   14,   12,   12,
+   12,   18,   19,   20,   12,   12,   56,   57,   58,   12,
+
+   59,   12,   12,   12,   60,   12,   12,   12,   61,   62,
+   63,   12,   64,   12,   65,   12,   12,   12,   12,   34,
+   35,   36,   77,   83,   78,   88,   89,   90,   40,   85,
+   12,   12,   12,   84,   91,   86,   92,   87,   12,   93,
+   94,   94,   66,  101,   12,  102,   12,  105,   32,   12,
+
+   35,   36,   12,   12,   12,   18,   19,   20,   40,   12,
+   12,   12,   12,   12,   59,   12,   12,   12,   12,   12,
+   12,   12,   66,   62,   12,   12,   12,   12,   32,   12,
+   12,   12,   12,   34,   68,   68,  106,   69,   68,   68,
+   68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+
+   68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+   68,   68,   68,   68,   68,   68,   68,   68,   68,   70,
+   70,  113,   70,   71,   70,   70,   70,   70,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+   70,   70,   70,   70,   94,   94,   95,   95,  114,   96,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   95,   97,   97,  117,   97,   98,   97,   97,   97,   97,
+
+   97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+   97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+   97,   97,   97,   97,   97,   97,   99,  118,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+
+  100,  100,  100,  288,  100,  103,  288,  112,  119,  122,
+   79,  107,  107,  104,  108,  107,  107,  107,  107,  107,
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+  107,  107,  107,  107,  107,  107,  109,  109,  123,  109,
+
+  110,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+  109,  111,  124,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+
+  112,  112,  112,  112,  112,  112,  112,  112,  115,  120,
+  288,  125,  121,  127,  128,   84,  116,  126,   67,   67,
+   68,   68,   74,   69,   68,   68,   68,   68,   68,   68,
+   68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+   68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+
+   68,   68,   68,   68,   68,   70,   70,  129,   70,   71,
+   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+   72,   73,  130,  131,  132,  133,  134,  135,  136,  137,
+
+  138,  139,  139,  140,  141,  142,  142,  143,  144,  145,
+  146,  147,  148,   94,   94,   95,   95,  149,   96,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+
+   97,   97,  150,   97,   98,   97,   97,   97,   97,   97,
+   97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+   97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+   97,   97,   97,   97,   97,   72,   99,  151,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  152,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  139,  139,  142,  142,  107,  107,  153,  108,  107,  107,
+
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  109,
+  109,  154,  109,  110,  109,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+
+  109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,   72,  111,  155,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  156,  112,  112,  112,  112,  112,  112,
+
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  139,
+  139,  142,  142,  157,  158,  159,  160,  161,  162,  163,
+  164,  165,  166,  167,  169,  168,  170,  171,  172,  173,
+  174,  175,  176,  177,  177,  139,  139,  139,  139,  178,
+
+  178,  142,  142,  179,  180,  181,  181,  182,  183,  142,
+  142,  184,  139,  139,  185,  186,  187,  188,  189,  100,
+  190,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  142,  142,  191,  192,
+
+  193,  194,  195,  100,  196,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  139,  139,  197,  168,  168,  198,  199,  112,  200,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  142,  142,  201,  201,  202,  203,
+  205,  112,  206,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  204,  204,
+
+  177,  177,  178,  178,  201,  201,  181,  181,  142,  142,
+  207,  208,  142,  142,  209,  210,  211,  215,  216,  100,
+  217,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  142,  142,  218,  219,
+
+  220,  221,  221,  112,  222,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  212,  212,  223,  223,  224,  201,  201,  139,  139,  225,
+  204,  204,  226,  227,  213,  228,  139,  139,  229,  230,
+
+  214,  212,  212,  100,  231,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  139,  139,  232,  233,  234,  235,  235,  112,  238,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  236,  236,  237,  237,  221,  221,
+  223,  223,  239,  240,  241,  242,  242,  243,  244,  245,
+  246,  247,  248,  249,  235,  235,  236,  236,  237,  237,
+  250,  251,  252,  253,  242,  242,  254,  254,  255,  255,
+
+  256,  257,  257,  258,  259,  260,  261,  262,  263,  264,
+  254,  254,  255,  255,  265,  257,  257,  266,  266,  267,
+  268,  269,  270,  271,  271,  272,  272,  273,  266,  266,
+  274,  275,  276,  277,  277,  271,  271,  272,  272,  278,
+  279,  280,  280,  281,  277,  277,  282,  283,  280,  280,
+
+  284,  284,  285,  285,  286,  284,  284,  285,  285,  287,
+  287,  287,  287,   11,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288
     } ;
 
-static const flex_int16_t yy_chk[878] =
+static const flex_int16_t yy_chk[1450] =
     {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,   13,
-       13,   14,   14,   21,    3,   18,   18,   20,   20,   22,
-       25,  290,    3,    3,   23,   26,   23,  287,    3,   29,
-       30,   31,  191,    3,   35,   35,  124,   21,  124,    3,
-
-       36,   36,  162,   24,   22,   25,    3,    3,   23,   26,
-       23,   24,    3,   29,   30,  161,   31,    3,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,   24,   27,
-      108,   32,   28,    4,   33,   34,   24,   61,   28,   27,
-       28,    4,    4,   39,   39,   42,  106,    4,   42,   45,
-       43,  104,    4,   97,   27,   32,   95,   28,    4,   33,
-       34,   61,   28,   27,   28,    4,    4,   43,   93,   45,
-       54,    4,   70,   42,   49,   49,    4,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,   44,   52,   46,
-       54,   43,    5,   45,   51,   44,   46,   51,   66,   66,
-
-        5,    5,   55,   44,   69,   52,    5,   56,   58,   55,
-       67,    5,   71,   71,   54,   53,   50,    5,   82,   82,
-       44,   46,   51,   53,    5,    5,   48,   44,   59,   52,
-        5,   53,   56,   58,   55,    5,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,   47,   57,   53,   65,
-       57,    6,   60,   59,   62,   53,   77,   63,   79,    6,
-        6,   72,   62,   63,   80,    6,   64,   72,   73,   41,
-        6,   57,   38,   65,   57,   37,    6,   60,   19,   62,
-       77,   63,   79,    6,    6,   16,   62,   63,   80,    6,
-       15,   64,   72,   73,    6,    7,    7,    7,    7,    7,
-
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    9,    9,   74,   75,   76,   78,
-       11,   81,    9,   83,    9,    9,    9,   84,   85,   85,
-       86,   87,    9,    0,   88,   89,    9,   90,    9,   91,
-        9,   74,   75,   76,   78,   81,   92,   92,   83,    9,
-        9,    9,   84,   98,   86,  103,   87,    9,   88,   89,
-
-        9,   90,    9,   91,    9,   96,   96,   98,   99,   99,
-      100,  101,  101,  102,   99,  109,  103,  101,  100,  107,
-      107,  110,  110,  113,  111,  115,  114,  110,  118,  109,
-      116,   98,  111,  112,  112,  122,  102,  117,  119,  112,
-      103,  120,  120,  100,  121,    0,  113,  114,  123,  125,
-      115,  126,  118,  109,  127,  116,  128,  111,  120,  122,
-      102,  129,  117,  119,  130,  131,  132,  133,  133,  121,
-      113,  114,  123,  125,  138,  126,  134,  134,  127,  139,
-      128,  135,  135,  120,  141,  129,  136,  136,  130,  131,
-      142,  132,  137,  137,  140,  140,  143,  143,  138,  144,
-
-      145,  145,  148,  139,  146,  150,  145,  147,  147,  141,
-      152,  146,  150,  147,  142,  149,  149,  153,  151,  151,
-      144,  149,  156,  148,  151,  154,  155,    0,  157,  158,
-        0,  159,  160,  163,  152,  164,  146,  150,  165,  166,
-      166,  153,  167,  168,  144,  170,  156,  148,  169,  169,
-      154,  155,  157,  173,  158,  159,  177,  160,  163,    0,
-      164,    0,  165,  171,  171,  172,  172,  167,  168,  170,
-      174,  174,  175,  175,  176,  176,  178,  173,  179,  179,
-      180,  177,  182,  178,  179,  181,  181,  180,  183,  184,
-      184,  181,  185,  186,  187,    0,  188,  189,  190,  192,
-
-      192,  193,  198,  184,  194,  194,  196,  182,  178,  184,
-      195,  195,  180,  183,  197,  197,  185,  199,  186,  187,
-      188,  200,  189,  190,  203,  204,  193,  198,  184,  206,
-      196,  201,  201,  184,  202,  202,  207,  201,  205,  205,
-      202,  199,  208,  209,  213,  200,  210,  210,  203,  204,
-      211,  211,  216,  206,  212,  212,  215,  215,  217,  218,
-      225,  207,  219,  219,  220,  221,  208,  209,  213,  222,
-      223,  224,  226,  227,  227,  230,  216,  228,  228,  229,
-      229,  231,  233,  217,  218,  225,  232,  237,  220,  221,
-      234,  234,  239,  222,  223,  224,  226,  235,  235,  240,
-
-      230,  236,  236,  238,  238,  241,  231,  233,  242,  243,
-      232,  244,  237,  245,  246,  246,  239,  247,  247,  248,
-      249,  249,  251,  240,  250,  250,  252,  253,  260,  241,
-      254,  257,  242,  243,  255,  255,  244,  259,  245,  256,
-      256,  258,  258,  248,  261,  262,  262,  251,  263,  263,
-      252,  265,  253,  260,  254,  257,  264,  264,  266,  267,
-      267,  259,  268,  269,  269,  270,  271,  275,  261,  272,
-      272,  273,  273,  274,  274,  265,  276,  276,  277,  277,
-      278,  278,  266,  279,  279,    0,  268,    0,    0,    0,
-      270,  271,  275,  281,  281,  281,  282,  282,  282,  283,
-
-        0,  283,  284,    0,  284,  285,    0,  285,  286,    0,
-      286,  288,    0,  288,  289,    0,  289,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    3,    3,    3,    3,    3,   11,   19,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+    3,    3,    3,    3,    4,    4,    4,    4,    4,    4,
+    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+    4,    4,    4,    4,    4,    4,    4,    4,    4,    5,
+    5,   13,   13,   21,    5,   22,    5,    5,    5,    5,
+
+    5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+    5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+    5,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+    6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+    6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+
+    6,    6,    6,    6,    6,    6,    7,    7,    7,   14,
+   14,   18,   18,   25,    7,    7,    7,    7,    7,   26,
+    7,    7,    7,   20,   20,   24,    7,    7,    7,    7,
+    7,    7,    7,   24,    7,    8,    8,    8,    8,    8,
+    8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+
+    8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+    8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+    9,    9,   23,   27,   23,   29,   30,   31,    9,   28,
+    9,    9,    9,   27,   32,   28,   33,   28,    9,   34,
+   35,   35,    9,   42,    9,   43,    9,   45,    9,   10,
+
+   10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+   10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+   10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+   10,   10,   10,   10,   15,   15,   46,   15,   15,   15,
+   15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
+   15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+   15,   15,   15,   15,   15,   15,   15,   15,   15,   16,
+   16,   51,   16,   16,   16,   16,   16,   16,   16,   16,
+   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+   16,   16,   16,   16,   36,   36,   37,   37,   52,   37,
+   37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+   37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+   37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+   37,   38,   38,   54,   38,   38,   38,   38,   38,   38,
+
+   38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+   38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+   38,   38,   38,   38,   38,   38,   39,   55,   39,   39,
+   39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+   39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+   39,   39,   39,   41,   41,   44,   50,   50,   56,   58,
+   59,   47,   47,   44,   47,   47,   47,   47,   47,   47,
+   47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+   47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+   47,   47,   47,   47,   47,   47,   48,   48,   60,   48,
+
+   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+   48,   49,   61,   49,   49,   49,   49,   49,   49,   49,
+   49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+
+   49,   49,   49,   49,   49,   49,   49,   49,   53,   57,
+   62,   63,   57,   64,   65,   66,   53,   63,   67,   67,
+   68,   68,   72,   68,   68,   68,   68,   68,   68,   68,
+   68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+   68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+
+   68,   68,   68,   68,   68,   70,   70,   74,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+   73,   73,   75,   76,   77,   78,   79,   80,   81,   82,
+
+   83,   84,   84,   85,   86,   87,   87,   88,   89,   90,
+   91,   92,   93,   94,   94,   95,   95,  101,   95,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+
+   97,   97,  103,   97,   97,   97,   97,   97,   97,   97,
+   97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+   97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+   97,   97,   97,   97,   97,   99,   99,  105,   99,   99,
+   99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+
+   99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+   99,   99,   99,  100,  106,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+  102,  102,  104,  104,  107,  107,  113,  107,  107,  107,
+
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  109,
+  109,  115,  109,  109,  109,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+
+  109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,  111,  111,  117,  111,  111,  111,
+  111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+  111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+  111,  111,  112,  118,  112,  112,  112,  112,  112,  112,
+
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  114,
+  114,  116,  116,  119,  120,  121,  122,  123,  124,  125,
+  126,  127,  128,  129,  130,  129,  131,  132,  133,  134,
+  135,  136,  137,  138,  138,  139,  139,  140,  140,  141,
+
+  141,  142,  142,  143,  144,  145,  145,  146,  147,  148,
+  148,  149,  150,  150,  151,  153,  155,  157,  158,  150,
+  159,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+  150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+  150,  150,  150,  150,  150,  150,  152,  152,  160,  161,
+
+  162,  163,  164,  152,  165,  152,  152,  152,  152,  152,
+  152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+  152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+  154,  154,  166,  167,  168,  169,  170,  154,  171,  154,
+  154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+
+  154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+  154,  154,  154,  154,  156,  156,  172,  172,  173,  174,
+  176,  156,  179,  156,  156,  156,  156,  156,  156,  156,
+  156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
+  156,  156,  156,  156,  156,  156,  156,  156,  175,  175,
+
+  177,  177,  178,  178,  180,  180,  181,  181,  182,  182,
+  183,  184,  185,  185,  186,  188,  189,  191,  192,  185,
+  193,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+  185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+  185,  185,  185,  185,  185,  185,  187,  187,  194,  195,
+
+  196,  197,  197,  187,  198,  187,  187,  187,  187,  187,
+  187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+  187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+  190,  190,  199,  199,  200,  201,  201,  202,  202,  203,
+  204,  204,  205,  206,  190,  207,  208,  208,  210,  211,
+
+  190,  212,  212,  208,  213,  208,  208,  208,  208,  208,
+  208,  208,  208,  208,  208,  208,  208,  208,  208,  208,
+  208,  208,  208,  208,  208,  208,  208,  208,  208,  208,
+  209,  209,  214,  215,  216,  217,  217,  209,  220,  209,
+  209,  209,  209,  209,  209,  209,  209,  209,  209,  209,
+
+  209,  209,  209,  209,  209,  209,  209,  209,  209,  209,
+  209,  209,  209,  209,  218,  218,  219,  219,  221,  221,
+  223,  223,  224,  225,  226,  227,  227,  228,  229,  230,
+  231,  232,  233,  234,  235,  235,  236,  236,  237,  237,
+  238,  239,  240,  241,  242,  242,  243,  243,  244,  244,
+
+  245,  246,  246,  247,  248,  249,  250,  251,  252,  253,
+  254,  254,  255,  255,  256,  257,  257,  258,  258,  259,
+  260,  261,  262,  263,  263,  264,  264,  265,  266,  266,
+  267,  268,  269,  270,  270,  271,  271,  272,  272,  273,
+  274,  275,  275,  276,  277,  277,  278,  279,  280,  280,
+
+  281,  281,  282,  282,  283,  284,  284,  285,  285,  286,
+  286,  287,  287,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+  288,  288,  288,  288,  288,  288,  288,  288,  288
     } ;
 
+
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
  */
@@ -960,10 +1126,10 @@ void escapes(const char *cp, char *tp);
         } \
         yylval->str = g_string_new(yytext)
 
-#line 964 "external_l.c"
+#line 1130 "external_l.c"
 #define YY_NO_INPUT 1
  
-#line 967 "external_l.c"
+#line 1133 "external_l.c"
 
 #define INITIAL 0
 #define SBOARDP1 1
@@ -1242,7 +1408,7 @@ YY_DECL
 #line 60 "external_l.l"
 
 
-#line 1246 "external_l.c"
+#line 1412 "external_l.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1269,13 +1435,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 281 )
+				if ( yy_current_state >= 289 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 818 );
+		while ( yy_base[yy_current_state] != 1414 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1427,101 +1593,107 @@ case 20:
 /* rule 20 can match eol */
 YY_RULE_SETUP
 #line 104 "external_l.l"
-{   return BEAVERS; }
+{   return TIME; }
 	YY_BREAK
 case 21:
 /* rule 21 can match eol */
 YY_RULE_SETUP
 #line 105 "external_l.l"
-{   return CRAWFORDRULE; }
+{   return BEAVERS; }
 	YY_BREAK
 case 22:
 /* rule 22 can match eol */
 YY_RULE_SETUP
 #line 106 "external_l.l"
-{   return CUBE; }
+{   return CRAWFORDRULE; }
 	YY_BREAK
 case 23:
 /* rule 23 can match eol */
 YY_RULE_SETUP
 #line 107 "external_l.l"
-{   return CUBEFUL; }
+{   return CUBE; }
 	YY_BREAK
 case 24:
 /* rule 24 can match eol */
 YY_RULE_SETUP
 #line 108 "external_l.l"
-{   return CUBELESS; }
+{   return CUBEFUL; }
 	YY_BREAK
 case 25:
 /* rule 25 can match eol */
 YY_RULE_SETUP
 #line 109 "external_l.l"
-{   return DETERMINISTIC; }
+{   return CUBELESS; }
 	YY_BREAK
 case 26:
 /* rule 26 can match eol */
 YY_RULE_SETUP
 #line 110 "external_l.l"
-{   return JACOBYRULE; }
+{   return DETERMINISTIC; }
 	YY_BREAK
 case 27:
 /* rule 27 can match eol */
 YY_RULE_SETUP
 #line 111 "external_l.l"
-{   return NOISE; }
+{   return JACOBYRULE; }
 	YY_BREAK
 case 28:
 /* rule 28 can match eol */
 YY_RULE_SETUP
 #line 112 "external_l.l"
-{   return PLIES; }
+{   return NOISE; }
 	YY_BREAK
 case 29:
 /* rule 29 can match eol */
 YY_RULE_SETUP
 #line 113 "external_l.l"
+{   return PLIES; }
+	YY_BREAK
+case 30:
+/* rule 30 can match eol */
+YY_RULE_SETUP
+#line 114 "external_l.l"
 {   return PRUNE; }
 	YY_BREAK
 
-case 30:
+case 31:
 YY_RULE_SETUP
-#line 116 "external_l.l"
+#line 117 "external_l.l"
 {
                             return (yytext[0]);
                         }
 	YY_BREAK
-case 31:
-/* rule 31 can match eol */
+case 32:
+/* rule 32 can match eol */
 YY_RULE_SETUP
-#line 120 "external_l.l"
+#line 121 "external_l.l"
 {
                             BEGIN(OPTIONS);
                             return FIBSBOARDEND;
                         }
 	YY_BREAK
-case 32:
+case 33:
 YY_RULE_SETUP
-#line 125 "external_l.l"
+#line 126 "external_l.l"
 {
                             PROCESS_YYTEXT_STRING;
                             BEGIN(SBOARDP2);
                             return E_STRING;
                         }
 	YY_BREAK
-case 33:
+case 34:
 YY_RULE_SETUP
-#line 130 "external_l.l"
+#line 131 "external_l.l"
 {
                             PROCESS_YYTEXT_STRING;
                             BEGIN(VALLIST);
                             return E_STRING;
                         }
 	YY_BREAK
-case 34:
-/* rule 34 can match eol */
+case 35:
+/* rule 35 can match eol */
 YY_RULE_SETUP
-#line 136 "external_l.l"
+#line 137 "external_l.l"
 ; /* ignore whitespace */
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
@@ -1529,25 +1701,25 @@ case YY_STATE_EOF(SBOARDP1):
 case YY_STATE_EOF(SBOARDP2):
 case YY_STATE_EOF(OPTIONS):
 case YY_STATE_EOF(VALLIST):
-#line 138 "external_l.l"
+#line 139 "external_l.l"
 {   BEGIN(INITIAL); 
                             return (EOL); 
                         }
 	YY_BREAK
-case 35:
+case 36:
 YY_RULE_SETUP
-#line 142 "external_l.l"
+#line 143 "external_l.l"
 {   BEGIN(INITIAL);
                             yylval->character = yytext[0]; 
                             return (E_CHARACTER);
                         }
 	YY_BREAK
-case 36:
+case 37:
 YY_RULE_SETUP
-#line 147 "external_l.l"
+#line 148 "external_l.l"
 ECHO;
 	YY_BREAK
-#line 1551 "external_l.c"
+#line 1723 "external_l.c"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -1844,7 +2016,7 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 281 )
+			if ( yy_current_state >= 289 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -1873,11 +2045,11 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 281 )
+		if ( yy_current_state >= 289 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 280);
+	yy_is_jam = (yy_current_state == 288);
 
 	(void)yyg;
 	return yy_is_jam ? 0 : yy_current_state;
@@ -2688,7 +2860,7 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 147 "external_l.l"
+#line 148 "external_l.l"
 
 
 void escapes(const char *cp, char *tp)
@@ -240,13 +240,14 @@ extern int yydebug;
     JACOBYRULE = 279,              /* JACOBYRULE  */
     RESIGNATION = 280,             /* RESIGNATION  */
     BEAVERS = 281,                 /* BEAVERS  */
-    CUBE = 282,                    /* CUBE  */
-    CUBEFUL = 283,                 /* CUBEFUL  */
-    CUBELESS = 284,                /* CUBELESS  */
-    DETERMINISTIC = 285,           /* DETERMINISTIC  */
-    NOISE = 286,                   /* NOISE  */
-    PLIES = 287,                   /* PLIES  */
-    PRUNE = 288                    /* PRUNE  */
+    TIME = 282,                    /* TIME  */
+    CUBE = 283,                    /* CUBE  */
+    CUBEFUL = 284,                 /* CUBEFUL  */
+    CUBELESS = 285,                /* CUBELESS  */
+    DETERMINISTIC = 286,           /* DETERMINISTIC  */
+    NOISE = 287,                   /* NOISE  */
+    PLIES = 288,                   /* PLIES  */
+    PRUNE = 289                    /* PRUNE  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -279,13 +280,14 @@ extern int yydebug;
 #define JACOBYRULE 279
 #define RESIGNATION 280
 #define BEAVERS 281
-#define CUBE 282
-#define CUBEFUL 283
-#define CUBELESS 284
-#define DETERMINISTIC 285
-#define NOISE 286
-#define PLIES 287
-#define PRUNE 288
+#define TIME 282
+#define CUBE 283
+#define CUBEFUL 284
+#define CUBELESS 285
+#define DETERMINISTIC 286
+#define NOISE 287
+#define PLIES 288
+#define PRUNE 289
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -302,7 +304,7 @@ union YYSTYPE
     GList *list;
     commandinfo *cmd;
 
-#line 306 "external_y.c"
+#line 308 "external_y.c"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -348,40 +350,41 @@ enum yysymbol_kind_t
   YYSYMBOL_JACOBYRULE = 24,                /* JACOBYRULE  */
   YYSYMBOL_RESIGNATION = 25,               /* RESIGNATION  */
   YYSYMBOL_BEAVERS = 26,                   /* BEAVERS  */
-  YYSYMBOL_CUBE = 27,                      /* CUBE  */
-  YYSYMBOL_CUBEFUL = 28,                   /* CUBEFUL  */
-  YYSYMBOL_CUBELESS = 29,                  /* CUBELESS  */
-  YYSYMBOL_DETERMINISTIC = 30,             /* DETERMINISTIC  */
-  YYSYMBOL_NOISE = 31,                     /* NOISE  */
-  YYSYMBOL_PLIES = 32,                     /* PLIES  */
-  YYSYMBOL_PRUNE = 33,                     /* PRUNE  */
-  YYSYMBOL_34_ = 34,                       /* ':'  */
-  YYSYMBOL_35_ = 35,                       /* '('  */
-  YYSYMBOL_36_ = 36,                       /* ')'  */
-  YYSYMBOL_37_ = 37,                       /* ','  */
-  YYSYMBOL_YYACCEPT = 38,                  /* $accept  */
-  YYSYMBOL_commands = 39,                  /* commands  */
-  YYSYMBOL_setcommand = 40,                /* setcommand  */
-  YYSYMBOL_command = 41,                   /* command  */
-  YYSYMBOL_board_element = 42,             /* board_element  */
-  YYSYMBOL_board_elements = 43,            /* board_elements  */
-  YYSYMBOL_endboard = 44,                  /* endboard  */
-  YYSYMBOL_sessionoption = 45,             /* sessionoption  */
-  YYSYMBOL_evaloption = 46,                /* evaloption  */
-  YYSYMBOL_sessionoptions = 47,            /* sessionoptions  */
-  YYSYMBOL_evaloptions = 48,               /* evaloptions  */
-  YYSYMBOL_boardcommand = 49,              /* boardcommand  */
-  YYSYMBOL_evalcommand = 50,               /* evalcommand  */
-  YYSYMBOL_board = 51,                     /* board  */
-  YYSYMBOL_float_type = 52,                /* float_type  */
-  YYSYMBOL_string_type = 53,               /* string_type  */
-  YYSYMBOL_integer_type = 54,              /* integer_type  */
-  YYSYMBOL_boolean_type = 55,              /* boolean_type  */
-  YYSYMBOL_list_type = 56,                 /* list_type  */
-  YYSYMBOL_basic_types = 57,               /* basic_types  */
-  YYSYMBOL_list = 58,                      /* list  */
-  YYSYMBOL_list_element = 59,              /* list_element  */
-  YYSYMBOL_list_elements = 60              /* list_elements  */
+  YYSYMBOL_TIME = 27,                      /* TIME  */
+  YYSYMBOL_CUBE = 28,                      /* CUBE  */
+  YYSYMBOL_CUBEFUL = 29,                   /* CUBEFUL  */
+  YYSYMBOL_CUBELESS = 30,                  /* CUBELESS  */
+  YYSYMBOL_DETERMINISTIC = 31,             /* DETERMINISTIC  */
+  YYSYMBOL_NOISE = 32,                     /* NOISE  */
+  YYSYMBOL_PLIES = 33,                     /* PLIES  */
+  YYSYMBOL_PRUNE = 34,                     /* PRUNE  */
+  YYSYMBOL_35_ = 35,                       /* ':'  */
+  YYSYMBOL_36_ = 36,                       /* '('  */
+  YYSYMBOL_37_ = 37,                       /* ')'  */
+  YYSYMBOL_38_ = 38,                       /* ','  */
+  YYSYMBOL_YYACCEPT = 39,                  /* $accept  */
+  YYSYMBOL_commands = 40,                  /* commands  */
+  YYSYMBOL_setcommand = 41,                /* setcommand  */
+  YYSYMBOL_command = 42,                   /* command  */
+  YYSYMBOL_board_element = 43,             /* board_element  */
+  YYSYMBOL_board_elements = 44,            /* board_elements  */
+  YYSYMBOL_endboard = 45,                  /* endboard  */
+  YYSYMBOL_sessionoption = 46,             /* sessionoption  */
+  YYSYMBOL_evaloption = 47,                /* evaloption  */
+  YYSYMBOL_sessionoptions = 48,            /* sessionoptions  */
+  YYSYMBOL_evaloptions = 49,               /* evaloptions  */
+  YYSYMBOL_boardcommand = 50,              /* boardcommand  */
+  YYSYMBOL_evalcommand = 51,               /* evalcommand  */
+  YYSYMBOL_board = 52,                     /* board  */
+  YYSYMBOL_float_type = 53,                /* float_type  */
+  YYSYMBOL_string_type = 54,               /* string_type  */
+  YYSYMBOL_integer_type = 55,              /* integer_type  */
+  YYSYMBOL_boolean_type = 56,              /* boolean_type  */
+  YYSYMBOL_list_type = 57,                 /* list_type  */
+  YYSYMBOL_basic_types = 58,               /* basic_types  */
+  YYSYMBOL_list = 59,                      /* list  */
+  YYSYMBOL_list_element = 60,              /* list_element  */
+  YYSYMBOL_list_elements = 61              /* list_elements  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -390,7 +393,7 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 #line 125 "external_y.y"
 
 
-#line 394 "external_y.c"
+#line 397 "external_y.c"
 
 
 #ifdef short
@@ -714,19 +717,19 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  25
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   74
+#define YYLAST   78
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  38
+#define YYNTOKENS  39
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  23
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  55
+#define YYNRULES  57
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  85
+#define YYNSTATES  88
 
 /* YYMAXUTOK -- Last valid token kind.  */
-#define YYMAXUTOK   288
+#define YYMAXUTOK   289
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -744,8 +747,8 @@ static const yytype_int8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-      35,    36,     2,     2,    37,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    34,     2,
+      36,    37,     2,     2,    38,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    35,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -768,19 +771,19 @@ static const yytype_int8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34
 };
 
 #if YYDEBUG
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   173,   173,   179,   186,   192,   198,   204,   258,   263,
-     269,   275,   282,   290,   298,   310,   314,   319,   326,   330,
-     335,   340,   345,   352,   357,   362,   370,   375,   380,   385,
-     390,   395,   400,   408,   425,   433,   450,   455,   462,   476,
-     491,   503,   511,   520,   528,   536,   546,   546,   546,   546,
-     551,   558,   558,   563,   567,   572
+       0,   173,   173,   179,   186,   192,   198,   204,   259,   264,
+     270,   276,   283,   291,   299,   311,   315,   320,   327,   331,
+     336,   341,   346,   351,   356,   366,   371,   376,   384,   389,
+     394,   399,   404,   409,   414,   422,   439,   447,   464,   469,
+     476,   490,   505,   517,   525,   534,   542,   550,   560,   560,
+     560,   560,   565,   572,   572,   577,   581,   586
 };
 #endif
 
@@ -800,7 +803,7 @@ static const char *const yytname[] =
   "DISABLED", "INTERFACEVERSION", "DEBUG", "SET", "NEW", "OLD", "OUTPUT",
   "E_INTERFACE", "HELP", "PROMPT", "E_STRING", "E_CHARACTER", "E_INTEGER",
   "E_FLOAT", "E_BOOLEAN", "FIBSBOARD", "FIBSBOARDEND", "EVALUATION",
-  "CRAWFORDRULE", "JACOBYRULE", "RESIGNATION", "BEAVERS", "CUBE",
+  "CRAWFORDRULE", "JACOBYRULE", "RESIGNATION", "BEAVERS", "TIME", "CUBE",
   "CUBEFUL", "CUBELESS", "DETERMINISTIC", "NOISE", "PLIES", "PRUNE", "':'",
   "'('", "')'", "','", "$accept", "commands", "setcommand", "command",
   "board_element", "board_elements", "endboard", "sessionoption",
@@ -817,7 +820,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-49)
+#define YYPACT_NINF (-50)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -831,15 +834,15 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int8 yypact[] =
 {
-       3,   -49,     7,   -23,    15,    10,    26,     0,    19,    32,
-      41,   -49,   -49,   -49,   -49,   -14,   -49,   -49,    27,    18,
-      34,    44,   -49,    16,    43,   -49,   -49,    12,   -49,   -49,
-     -49,   -49,   -49,   -49,   -49,   -49,   -49,   -49,   -49,   -49,
-       4,   -49,   -49,   -49,   -49,   -49,    49,   -49,    27,    27,
-      48,    27,   -49,   -49,   -14,    33,    29,   -49,   -49,   -49,
-     -49,   -49,    48,    27,   -49,   -49,    27,    25,    48,    27,
-     -49,   -49,   -49,    -8,   -49,   -49,   -49,   -49,   -49,   -49,
-     -49,   -49,    48,   -49,   -49
+       4,   -50,    22,   -16,    31,    25,    35,    13,    15,    47,
+      46,   -50,   -50,   -50,   -50,   -13,   -50,   -50,    33,     5,
+      38,    64,   -50,    34,    30,   -50,   -50,    17,   -50,   -50,
+     -50,   -50,   -50,   -50,   -50,   -50,   -50,   -50,   -50,   -50,
+     -19,   -50,   -50,   -50,   -50,   -50,    53,   -50,    33,    33,
+      54,    33,    28,   -50,   -50,   -13,    37,    32,   -50,   -50,
+     -50,   -50,   -50,   -50,   -50,    54,    33,   -50,   -50,    33,
+      28,    54,    33,   -50,   -50,   -50,    -8,   -50,   -50,   -50,
+     -50,   -50,   -50,   -50,   -50,    54,   -50,   -50
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -848,29 +851,29 @@ static const yytype_int8 yypact[] =
 static const yytype_int8 yydefact[] =
 {
        0,     2,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    12,    13,    33,     6,    53,    14,     4,     0,     0,
-       0,     0,     5,     0,     0,     1,     7,    38,    42,    43,
-      41,    44,    48,    47,    49,    46,    52,    51,    45,    54,
-       0,     8,     9,    10,    11,     3,     0,    35,     0,     0,
-       0,     0,    34,    50,     0,     0,    39,    20,    19,    21,
-      22,    55,     0,     0,    31,    32,    28,     0,     0,    26,
-      37,    36,    16,     0,    15,    30,    29,    24,    25,    23,
-      27,    18,     0,    40,    17
+       0,    12,    13,    35,     6,    55,    14,     4,     0,     0,
+       0,     0,     5,     0,     0,     1,     7,    40,    44,    45,
+      43,    46,    50,    49,    51,    48,    54,    53,    47,    56,
+       0,     8,     9,    10,    11,     3,     0,    37,     0,     0,
+       0,     0,     0,    36,    52,     0,     0,    41,    20,    19,
+      21,    22,    23,    24,    57,     0,     0,    33,    34,    30,
+       0,     0,    28,    39,    38,    16,     0,    15,    32,    31,
+      26,    27,    25,    29,    18,     0,    42,    17
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-     -49,   -49,   -49,   -49,   -16,   -49,   -49,    13,   -49,   -49,
-     -49,   -49,   -49,    46,     1,    51,   -48,   -18,   -49,   -49,
-      69,    20,   -49
+     -50,   -50,   -50,   -50,   -15,   -50,   -50,    16,   -50,   -50,
+     -50,   -50,   -50,    50,   -41,    55,   -49,   -18,   -50,   -50,
+      73,    23,   -50
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-       0,     9,    21,    10,    72,    73,    83,    52,    71,    27,
-      56,    11,    12,    13,    32,    33,    34,    35,    36,    37,
+       0,     9,    21,    10,    75,    76,    86,    53,    74,    27,
+      57,    11,    12,    13,    32,    33,    34,    35,    36,    37,
       38,    39,    40
 };
 
@@ -879,52 +882,52 @@ static const yytype_int8 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int8 yytable[] =
 {
-      41,    28,    59,    29,    30,    31,     1,     2,     3,     4,
-      14,     5,    15,    81,    74,    23,     6,    18,    17,    78,
-      79,    15,    19,     7,    20,     8,    82,    42,    43,    22,
-      57,    58,    25,    60,    74,    48,    49,    50,    51,    24,
-      53,    54,    29,    30,    26,    75,    31,    45,    76,    28,
-      46,    80,    48,    49,    50,    51,    63,    64,    65,    66,
-      67,    68,    69,     7,    55,    29,    84,    62,    77,    70,
-      47,    44,    16,     0,    61
+      41,    60,    28,    63,    29,    30,    31,     1,     2,     3,
+       4,    62,     5,    84,    42,    43,    77,     6,    54,    55,
+      15,    81,    82,    15,     7,    14,     8,    85,    23,    80,
+      58,    59,    18,    61,    17,    24,    77,    19,    22,    20,
+      48,    49,    50,    51,    52,    29,    30,    25,    78,    26,
+       7,    79,    31,    28,    83,    48,    49,    50,    51,    52,
+      66,    67,    68,    69,    70,    71,    72,    45,    56,    46,
+      87,    29,    65,    73,    47,    44,    16,     0,    64
 };
 
 static const yytype_int8 yycheck[] =
 {
-      18,    15,    50,    17,    18,    19,     3,     4,     5,     6,
-       3,     8,    35,    21,    62,    15,    13,     7,     3,    67,
-      68,    35,    12,    20,    14,    22,    34,     9,    10,     3,
-      48,    49,     0,    51,    82,    23,    24,    25,    26,    20,
-      36,    37,    17,    18,     3,    63,    19,     3,    66,    15,
-      34,    69,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    20,    15,    17,    82,    34,    67,    56,
-      24,    20,     3,    -1,    54
+      18,    50,    15,    52,    17,    18,    19,     3,     4,     5,
+       6,    52,     8,    21,     9,    10,    65,    13,    37,    38,
+      36,    70,    71,    36,    20,     3,    22,    35,    15,    70,
+      48,    49,     7,    51,     3,    20,    85,    12,     3,    14,
+      23,    24,    25,    26,    27,    17,    18,     0,    66,     3,
+      20,    69,    19,    15,    72,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,     3,    15,    35,
+      85,    17,    35,    57,    24,    20,     3,    -1,    55
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
-       0,     3,     4,     5,     6,     8,    13,    20,    22,    39,
-      41,    49,    50,    51,     3,    35,    58,     3,     7,    12,
-      14,    40,     3,    15,    20,     0,     3,    47,    15,    17,
-      18,    19,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    55,     9,    10,    53,     3,    34,    51,    23,    24,
-      25,    26,    45,    36,    37,    15,    48,    55,    55,    54,
-      55,    59,    34,    27,    28,    29,    30,    31,    32,    33,
-      45,    46,    42,    43,    54,    55,    55,    52,    54,    54,
-      55,    21,    34,    44,    42
+       0,     3,     4,     5,     6,     8,    13,    20,    22,    40,
+      42,    50,    51,    52,     3,    36,    59,     3,     7,    12,
+      14,    41,     3,    15,    20,     0,     3,    48,    15,    17,
+      18,    19,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    56,     9,    10,    54,     3,    35,    52,    23,    24,
+      25,    26,    27,    46,    37,    38,    15,    49,    56,    56,
+      55,    56,    53,    55,    60,    35,    28,    29,    30,    31,
+      32,    33,    34,    46,    47,    43,    44,    55,    56,    56,
+      53,    55,    55,    56,    21,    35,    45,    43
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
-       0,    38,    39,    39,    39,    39,    39,    39,    40,    40,
-      40,    40,    41,    41,    41,    42,    43,    43,    44,    45,
-      45,    45,    45,    46,    46,    46,    46,    46,    46,    46,
-      46,    46,    46,    47,    47,    48,    48,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,    57,    57,    57,    57,
-      58,    59,    59,    60,    60,    60
+       0,    39,    40,    40,    40,    40,    40,    40,    41,    41,
+      41,    41,    42,    42,    42,    43,    44,    44,    45,    46,
+      46,    46,    46,    46,    46,    47,    47,    47,    47,    47,
+      47,    47,    47,    47,    47,    48,    48,    49,    49,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    58,
+      58,    58,    59,    60,    60,    61,    61,    61
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -932,10 +935,10 @@ static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     3,     2,     2,     2,     2,     2,     2,
        2,     2,     1,     1,     2,     1,     1,     3,     1,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     1,     2,
-       2,     1,     1,     0,     2,     0,     2,     2,     2,     4,
-       7,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       3,     1,     1,     0,     1,     3
+       2,     2,     2,     2,     2,     2,     2,     2,     1,     2,
+       1,     2,     2,     1,     1,     0,     2,     0,     2,     2,
+       2,     4,     7,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     1,     1,     0,     1,     3
 };
 
 
@@ -1410,127 +1413,127 @@ yydestruct (const char *yymsg,
     case YYSYMBOL_E_STRING: /* E_STRING  */
 #line 166 "external_y.y"
             { if (((*yyvaluep).str)) g_string_free(((*yyvaluep).str), TRUE); }
-#line 1414 "external_y.c"
+#line 1417 "external_y.c"
         break;
 
     case YYSYMBOL_setcommand: /* setcommand  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1420 "external_y.c"
+#line 1423 "external_y.c"
         break;
 
     case YYSYMBOL_command: /* command  */
 #line 169 "external_y.y"
             { if (((*yyvaluep).cmd)) { g_free(((*yyvaluep).cmd)); }}
-#line 1426 "external_y.c"
+#line 1429 "external_y.c"
         break;
 
     case YYSYMBOL_board_element: /* board_element  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1432 "external_y.c"
+#line 1435 "external_y.c"
         break;
 
     case YYSYMBOL_board_elements: /* board_elements  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1438 "external_y.c"
+#line 1441 "external_y.c"
         break;
 
     case YYSYMBOL_sessionoption: /* sessionoption  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1444 "external_y.c"
+#line 1447 "external_y.c"
         break;
 
     case YYSYMBOL_evaloption: /* evaloption  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1450 "external_y.c"
+#line 1453 "external_y.c"
         break;
 
     case YYSYMBOL_sessionoptions: /* sessionoptions  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1456 "external_y.c"
+#line 1459 "external_y.c"
         break;
 
     case YYSYMBOL_evaloptions: /* evaloptions  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1462 "external_y.c"
+#line 1465 "external_y.c"
         break;
 
     case YYSYMBOL_boardcommand: /* boardcommand  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1468 "external_y.c"
+#line 1471 "external_y.c"
         break;
 
     case YYSYMBOL_evalcommand: /* evalcommand  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1474 "external_y.c"
+#line 1477 "external_y.c"
         break;
 
     case YYSYMBOL_board: /* board  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1480 "external_y.c"
+#line 1483 "external_y.c"
         break;
 
     case YYSYMBOL_float_type: /* float_type  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1486 "external_y.c"
+#line 1489 "external_y.c"
         break;
 
     case YYSYMBOL_string_type: /* string_type  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1492 "external_y.c"
+#line 1495 "external_y.c"
         break;
 
     case YYSYMBOL_integer_type: /* integer_type  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1498 "external_y.c"
+#line 1501 "external_y.c"
         break;
 
     case YYSYMBOL_boolean_type: /* boolean_type  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1504 "external_y.c"
+#line 1507 "external_y.c"
         break;
 
     case YYSYMBOL_list_type: /* list_type  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1510 "external_y.c"
+#line 1513 "external_y.c"
         break;
 
     case YYSYMBOL_basic_types: /* basic_types  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1516 "external_y.c"
+#line 1519 "external_y.c"
         break;
 
     case YYSYMBOL_list: /* list  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1522 "external_y.c"
+#line 1525 "external_y.c"
         break;
 
     case YYSYMBOL_list_element: /* list_element  */
 #line 168 "external_y.y"
             { if (((*yyvaluep).gv)) { g_value_unsetfree(((*yyvaluep).gv)); }}
-#line 1528 "external_y.c"
+#line 1531 "external_y.c"
         break;
 
     case YYSYMBOL_list_elements: /* list_elements  */
 #line 167 "external_y.y"
             { if (((*yyvaluep).list)) g_list_free(((*yyvaluep).list)); }
-#line 1534 "external_y.c"
+#line 1537 "external_y.c"
         break;
 
       default:
@@ -1812,7 +1815,7 @@ yyreduce:
             extcmd->ct = COMMAND_NONE;
             YYACCEPT;
         }
-#line 1816 "external_y.c"
+#line 1819 "external_y.c"
     break;
 
   case 3: /* commands: SET setcommand EOL  */
@@ -1822,7 +1825,7 @@ yyreduce:
             extcmd->ct = COMMAND_SET;
             YYACCEPT;
         }
-#line 1826 "external_y.c"
+#line 1829 "external_y.c"
     break;
 
   case 4: /* commands: INTERFACEVERSION EOL  */
@@ -1831,7 +1834,7 @@ yyreduce:
             extcmd->ct = COMMAND_VERSION;
             YYACCEPT;
         }
-#line 1835 "external_y.c"
+#line 1838 "external_y.c"
     break;
 
   case 5: /* commands: HELP EOL  */
@@ -1840,7 +1843,7 @@ yyreduce:
             extcmd->ct = COMMAND_HELP;
             YYACCEPT;
         }
-#line 1844 "external_y.c"
+#line 1847 "external_y.c"
     break;
 
   case 6: /* commands: EXIT EOL  */
@@ -1849,7 +1852,7 @@ yyreduce:
             extcmd->ct = COMMAND_EXIT;
             YYACCEPT;
         }
-#line 1853 "external_y.c"
+#line 1856 "external_y.c"
     break;
 
   case 7: /* commands: command EOL  */
@@ -1889,6 +1892,7 @@ yyreduce:
                     extcmd->fDeterministic = g_value_get_int(str2gv_map_get_key_value(optionsmap, KEY_STR_DETERMINISTIC, gvtrue));
                     extcmd->nResignation = g_value_get_int(str2gv_map_get_key_value(optionsmap, KEY_STR_RESIGNATION, gvfalse));
                     extcmd->fBeavers = g_value_get_int(str2gv_map_get_key_value(optionsmap, KEY_STR_BEAVERS, gvtrue));
+                    extcmd->rTime = g_value_get_float(str2gv_map_get_key_value(optionsmap, KEY_STR_TIME, gvfloatzero));
 
                     g_value_unsetfree(gvtrue);
                     g_value_unsetfree(gvfalse);
@@ -1904,67 +1908,67 @@ yyreduce:
                 }
             }
         }
-#line 1908 "external_y.c"
+#line 1912 "external_y.c"
     break;
 
   case 8: /* setcommand: DEBUG boolean_type  */
-#line 259 "external_y.y"
+#line 260 "external_y.y"
         {
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_DEBUG, (yyvsp[0].gv));
         }
-#line 1916 "external_y.c"
+#line 1920 "external_y.c"
     break;
 
   case 9: /* setcommand: E_INTERFACE NEW  */
-#line 264 "external_y.y"
+#line 265 "external_y.y"
         {
             GVALUE_CREATE(G_TYPE_INT, int, 1, gvint); 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_NEWINTERFACE, gvint);
         }
-#line 1925 "external_y.c"
+#line 1929 "external_y.c"
     break;
 
   case 10: /* setcommand: E_INTERFACE OLD  */
-#line 270 "external_y.y"
+#line 271 "external_y.y"
         {
             GVALUE_CREATE(G_TYPE_INT, int, 0, gvint); 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_NEWINTERFACE, gvint);
         }
-#line 1934 "external_y.c"
+#line 1938 "external_y.c"
     break;
 
   case 11: /* setcommand: PROMPT string_type  */
-#line 276 "external_y.y"
+#line 277 "external_y.y"
         {
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_PROMPT, (yyvsp[0].gv));
         }
-#line 1942 "external_y.c"
+#line 1946 "external_y.c"
     break;
 
   case 12: /* command: boardcommand  */
-#line 283 "external_y.y"
+#line 284 "external_y.y"
         {
             commandinfo *cmdInfo = g_malloc0(sizeof(commandinfo));
             cmdInfo->pvData = (yyvsp[0].gv);
             cmdInfo->cmdType = COMMAND_FIBSBOARD;
             (yyval.cmd) = cmdInfo;
         }
-#line 1953 "external_y.c"
+#line 1957 "external_y.c"
     break;
 
   case 13: /* command: evalcommand  */
-#line 291 "external_y.y"
+#line 292 "external_y.y"
         {
             commandinfo *cmdInfo = g_malloc0(sizeof(commandinfo));
             cmdInfo->pvData = (yyvsp[0].gv);
             cmdInfo->cmdType = COMMAND_EVALUATION;
             (yyval.cmd) = cmdInfo;
         }
-#line 1964 "external_y.c"
+#line 1968 "external_y.c"
     break;
 
   case 14: /* command: DISABLED list  */
-#line 299 "external_y.y"
+#line 300 "external_y.y"
         { 
             GVALUE_CREATE(G_TYPE_BOXED_GLIST_GV, boxed, (yyvsp[0].list), gvptr);
             g_list_free((yyvsp[0].list));
@@ -1973,142 +1977,161 @@ yyreduce:
             cmdInfo->cmdType = COMMAND_LIST;
             (yyval.cmd) = cmdInfo;
         }
-#line 1977 "external_y.c"
+#line 1981 "external_y.c"
     break;
 
   case 16: /* board_elements: board_element  */
-#line 315 "external_y.y"
+#line 316 "external_y.y"
         { 
             (yyval.list) = g_list_prepend(NULL, (yyvsp[0].gv)); 
         }
-#line 1985 "external_y.c"
+#line 1989 "external_y.c"
     break;
 
   case 17: /* board_elements: board_elements ':' board_element  */
-#line 320 "external_y.y"
+#line 321 "external_y.y"
         { 
             (yyval.list) = g_list_prepend((yyvsp[-2].list), (yyvsp[0].gv)); 
         }
-#line 1993 "external_y.c"
+#line 1997 "external_y.c"
     break;
 
   case 19: /* sessionoption: JACOBYRULE boolean_type  */
-#line 331 "external_y.y"
+#line 332 "external_y.y"
         { 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_JACOBYRULE, (yyvsp[0].gv)); 
         }
-#line 2001 "external_y.c"
+#line 2005 "external_y.c"
     break;
 
   case 20: /* sessionoption: CRAWFORDRULE boolean_type  */
-#line 336 "external_y.y"
+#line 337 "external_y.y"
         { 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_CRAWFORDRULE, (yyvsp[0].gv));
         }
-#line 2009 "external_y.c"
+#line 2013 "external_y.c"
     break;
 
   case 21: /* sessionoption: RESIGNATION integer_type  */
-#line 341 "external_y.y"
+#line 342 "external_y.y"
         { 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_RESIGNATION, (yyvsp[0].gv));
         }
-#line 2017 "external_y.c"
+#line 2021 "external_y.c"
     break;
 
   case 22: /* sessionoption: BEAVERS boolean_type  */
-#line 346 "external_y.y"
+#line 347 "external_y.y"
         { 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_BEAVERS, (yyvsp[0].gv));
         }
-#line 2025 "external_y.c"
+#line 2029 "external_y.c"
     break;
 
-  case 23: /* evaloption: PLIES integer_type  */
-#line 353 "external_y.y"
+  case 23: /* sessionoption: TIME float_type  */
+#line 352 "external_y.y"
+        { 
+            (yyval.list) = create_str2gvalue_tuple (KEY_STR_TIME, (yyvsp[0].gv));
+        }
+#line 2037 "external_y.c"
+    break;
+
+  case 24: /* sessionoption: TIME integer_type  */
+#line 357 "external_y.y"
+        {
+            float floatval = (float) g_value_get_int((yyvsp[0].gv));
+            GVALUE_CREATE(G_TYPE_FLOAT, float, floatval, gvfloat); 
+            (yyval.list) = create_str2gvalue_tuple (KEY_STR_TIME, gvfloat); 
+            g_value_unsetfree((yyvsp[0].gv));
+        }
+#line 2048 "external_y.c"
+    break;
+
+  case 25: /* evaloption: PLIES integer_type  */
+#line 367 "external_y.y"
         { 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_PLIES, (yyvsp[0].gv)); 
         }
-#line 2033 "external_y.c"
+#line 2056 "external_y.c"
     break;
 
-  case 24: /* evaloption: NOISE float_type  */
-#line 358 "external_y.y"
+  case 26: /* evaloption: NOISE float_type  */
+#line 372 "external_y.y"
         {
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_NOISE, (yyvsp[0].gv)); 
         }
-#line 2041 "external_y.c"
+#line 2064 "external_y.c"
     break;
 
-  case 25: /* evaloption: NOISE integer_type  */
-#line 363 "external_y.y"
+  case 27: /* evaloption: NOISE integer_type  */
+#line 377 "external_y.y"
         {
             float floatval = (float) g_value_get_int((yyvsp[0].gv)) / 10000.0f;
             GVALUE_CREATE(G_TYPE_FLOAT, float, floatval, gvfloat); 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_NOISE, gvfloat); 
             g_value_unsetfree((yyvsp[0].gv));
         }
-#line 2052 "external_y.c"
+#line 2075 "external_y.c"
     break;
 
-  case 26: /* evaloption: PRUNE  */
-#line 371 "external_y.y"
+  case 28: /* evaloption: PRUNE  */
+#line 385 "external_y.y"
         { 
             (yyval.list) = create_str2int_tuple (KEY_STR_PRUNE, TRUE);
         }
-#line 2060 "external_y.c"
+#line 2083 "external_y.c"
     break;
 
-  case 27: /* evaloption: PRUNE boolean_type  */
-#line 376 "external_y.y"
+  case 29: /* evaloption: PRUNE boolean_type  */
+#line 390 "external_y.y"
         { 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_PRUNE, (yyvsp[0].gv));
         }
-#line 2068 "external_y.c"
+#line 2091 "external_y.c"
     break;
 
-  case 28: /* evaloption: DETERMINISTIC  */
-#line 381 "external_y.y"
+  case 30: /* evaloption: DETERMINISTIC  */
+#line 395 "external_y.y"
         { 
             (yyval.list) = create_str2int_tuple (KEY_STR_DETERMINISTIC, TRUE);
         }
-#line 2076 "external_y.c"
+#line 2099 "external_y.c"
     break;
 
-  case 29: /* evaloption: DETERMINISTIC boolean_type  */
-#line 386 "external_y.y"
+  case 31: /* evaloption: DETERMINISTIC boolean_type  */
+#line 400 "external_y.y"
         { 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_DETERMINISTIC, (yyvsp[0].gv));
         }
-#line 2084 "external_y.c"
+#line 2107 "external_y.c"
     break;
 
-  case 30: /* evaloption: CUBE boolean_type  */
-#line 391 "external_y.y"
+  case 32: /* evaloption: CUBE boolean_type  */
+#line 405 "external_y.y"
         { 
             (yyval.list) = create_str2gvalue_tuple (KEY_STR_CUBEFUL, (yyvsp[0].gv));
         }
-#line 2092 "external_y.c"
+#line 2115 "external_y.c"
     break;
 
-  case 31: /* evaloption: CUBEFUL  */
-#line 396 "external_y.y"
+  case 33: /* evaloption: CUBEFUL  */
+#line 410 "external_y.y"
         { 
             (yyval.list) = create_str2int_tuple (KEY_STR_CUBEFUL, TRUE); 
         }
-#line 2100 "external_y.c"
+#line 2123 "external_y.c"
     break;
 
-  case 32: /* evaloption: CUBELESS  */
-#line 401 "external_y.y"
+  case 34: /* evaloption: CUBELESS  */
+#line 415 "external_y.y"
         { 
             (yyval.list) = create_str2int_tuple (KEY_STR_CUBEFUL, FALSE); 
         }
-#line 2108 "external_y.c"
+#line 2131 "external_y.c"
     break;
 
-  case 33: /* sessionoptions: %empty  */
-#line 408 "external_y.y"
+  case 35: /* sessionoptions: %empty  */
+#line 422 "external_y.y"
         { 
             /* Setup the defaults */
             STR2GV_MAPENTRY_CREATE(KEY_STR_JACOBYRULE, fJacoby, G_TYPE_INT, 
@@ -2125,19 +2148,19 @@ yyreduce:
                                resignentry), beaversentry);
             (yyval.list) = defaults;
         }
-#line 2129 "external_y.c"
+#line 2152 "external_y.c"
     break;
 
-  case 34: /* sessionoptions: sessionoptions sessionoption  */
-#line 426 "external_y.y"
+  case 36: /* sessionoptions: sessionoptions sessionoption  */
+#line 440 "external_y.y"
         { 
             STR2GV_MAP_ADD_ENTRY((yyvsp[-1].list), (yyvsp[0].list), (yyval.list)); 
         }
-#line 2137 "external_y.c"
+#line 2160 "external_y.c"
     break;
 
-  case 35: /* evaloptions: %empty  */
-#line 433 "external_y.y"
+  case 37: /* evaloptions: %empty  */
+#line 447 "external_y.y"
         { 
             /* Setup the defaults */
             STR2GV_MAPENTRY_CREATE(KEY_STR_JACOBYRULE, fJacoby, G_TYPE_INT, 
@@ -2154,27 +2177,27 @@ yyreduce:
                                resignentry), beaversentry);
             (yyval.list) = defaults;
         }
-#line 2158 "external_y.c"
+#line 2181 "external_y.c"
     break;
 
-  case 36: /* evaloptions: evaloptions evaloption  */
-#line 451 "external_y.y"
+  case 38: /* evaloptions: evaloptions evaloption  */
+#line 465 "external_y.y"
         { 
             STR2GV_MAP_ADD_ENTRY((yyvsp[-1].list), (yyvsp[0].list), (yyval.list)); 
         }
-#line 2166 "external_y.c"
+#line 2189 "external_y.c"
     break;
 
-  case 37: /* evaloptions: evaloptions sessionoption  */
-#line 456 "external_y.y"
+  case 39: /* evaloptions: evaloptions sessionoption  */
+#line 470 "external_y.y"
         { 
             STR2GV_MAP_ADD_ENTRY((yyvsp[-1].list), (yyvsp[0].list), (yyval.list)); 
         }
-#line 2174 "external_y.c"
+#line 2197 "external_y.c"
     break;
 
-  case 38: /* boardcommand: board sessionoptions  */
-#line 463 "external_y.y"
+  case 40: /* boardcommand: board sessionoptions  */
+#line 477 "external_y.y"
         {
             GVALUE_CREATE(G_TYPE_BOXED_GLIST_GV, boxed, (yyvsp[-1].list), gvptr1);
             GVALUE_CREATE(G_TYPE_BOXED_MAP_GV, boxed, (yyvsp[0].list), gvptr2);
@@ -2185,11 +2208,11 @@ yyreduce:
             g_list_free((yyvsp[-1].list));
             g_list_free((yyvsp[0].list));
         }
-#line 2189 "external_y.c"
+#line 2212 "external_y.c"
     break;
 
-  case 39: /* evalcommand: EVALUATION FIBSBOARD board evaloptions  */
-#line 477 "external_y.y"
+  case 41: /* evalcommand: EVALUATION FIBSBOARD board evaloptions  */
+#line 491 "external_y.y"
         {
             GVALUE_CREATE(G_TYPE_BOXED_GLIST_GV, boxed, (yyvsp[-1].list), gvptr1);
             GVALUE_CREATE(G_TYPE_BOXED_MAP_GV, boxed, (yyvsp[0].list), gvptr2);
@@ -2201,11 +2224,11 @@ yyreduce:
             g_list_free((yyvsp[-1].list));
             g_list_free((yyvsp[0].list));
         }
-#line 2205 "external_y.c"
+#line 2228 "external_y.c"
     break;
 
-  case 40: /* board: FIBSBOARD E_STRING ':' E_STRING ':' board_elements endboard  */
-#line 492 "external_y.y"
+  case 42: /* board: FIBSBOARD E_STRING ':' E_STRING ':' board_elements endboard  */
+#line 506 "external_y.y"
         {
             GVALUE_CREATE(G_TYPE_GSTRING, boxed, (yyvsp[-3].str), gvstr1); 
             GVALUE_CREATE(G_TYPE_GSTRING, boxed, (yyvsp[-5].str), gvstr2); 
@@ -2214,90 +2237,90 @@ yyreduce:
             g_string_free((yyvsp[-3].str), TRUE);
             g_string_free((yyvsp[-5].str), TRUE);
         }
-#line 2218 "external_y.c"
+#line 2241 "external_y.c"
     break;
 
-  case 41: /* float_type: E_FLOAT  */
-#line 504 "external_y.y"
+  case 43: /* float_type: E_FLOAT  */
+#line 518 "external_y.y"
         { 
             GVALUE_CREATE(G_TYPE_FLOAT, float, (yyvsp[0].floatnum), gvfloat); 
             (yyval.gv) = gvfloat; 
         }
-#line 2227 "external_y.c"
+#line 2250 "external_y.c"
     break;
 
-  case 42: /* string_type: E_STRING  */
-#line 512 "external_y.y"
+  case 44: /* string_type: E_STRING  */
+#line 526 "external_y.y"
         { 
             GVALUE_CREATE(G_TYPE_GSTRING, boxed, (yyvsp[0].str), gvstr); 
             g_string_free ((yyvsp[0].str), TRUE); 
             (yyval.gv) = gvstr; 
         }
-#line 2237 "external_y.c"
+#line 2260 "external_y.c"
     break;
 
-  case 43: /* integer_type: E_INTEGER  */
-#line 521 "external_y.y"
+  case 45: /* integer_type: E_INTEGER  */
+#line 535 "external_y.y"
         { 
             GVALUE_CREATE(G_TYPE_INT, int, (yyvsp[0].intnum), gvint); 
             (yyval.gv) = gvint; 
         }
-#line 2246 "external_y.c"
+#line 2269 "external_y.c"
     break;
 
-  case 44: /* boolean_type: E_BOOLEAN  */
-#line 529 "external_y.y"
+  case 46: /* boolean_type: E_BOOLEAN  */
+#line 543 "external_y.y"
         { 
             GVALUE_CREATE(G_TYPE_INT, int, (yyvsp[0].bool), gvint); 
             (yyval.gv) = gvint; 
         }
-#line 2255 "external_y.c"
+#line 2278 "external_y.c"
     break;
 
-  case 45: /* list_type: list  */
-#line 537 "external_y.y"
+  case 47: /* list_type: list  */
+#line 551 "external_y.y"
         { 
             GVALUE_CREATE(G_TYPE_BOXED_GLIST_GV, boxed, (yyvsp[0].list), gvptr);
             g_list_free((yyvsp[0].list));
             (yyval.gv) = gvptr;
         }
-#line 2265 "external_y.c"
+#line 2288 "external_y.c"
     break;
 
-  case 50: /* list: '(' list_elements ')'  */
-#line 552 "external_y.y"
+  case 52: /* list: '(' list_elements ')'  */
+#line 566 "external_y.y"
         { 
             (yyval.list) = g_list_reverse((yyvsp[-1].list));
         }
-#line 2273 "external_y.c"
+#line 2296 "external_y.c"
     break;
 
-  case 53: /* list_elements: %empty  */
-#line 563 "external_y.y"
+  case 55: /* list_elements: %empty  */
+#line 577 "external_y.y"
         { 
             (yyval.list) = NULL; 
         }
-#line 2281 "external_y.c"
+#line 2304 "external_y.c"
     break;
 
-  case 54: /* list_elements: list_element  */
-#line 568 "external_y.y"
+  case 56: /* list_elements: list_element  */
+#line 582 "external_y.y"
         { 
             (yyval.list) = g_list_prepend(NULL, (yyvsp[0].gv));
         }
-#line 2289 "external_y.c"
+#line 2312 "external_y.c"
     break;
 
-  case 55: /* list_elements: list_elements ',' list_element  */
-#line 573 "external_y.y"
+  case 57: /* list_elements: list_elements ',' list_element  */
+#line 587 "external_y.y"
         { 
             (yyval.list) = g_list_prepend((yyvsp[-2].list), (yyvsp[0].gv)); 
         }
-#line 2297 "external_y.c"
+#line 2320 "external_y.c"
     break;
 
 
-#line 2301 "external_y.c"
+#line 2324 "external_y.c"
 
       default: break;
     }
@@ -2521,7 +2544,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 577 "external_y.y"
+#line 591 "external_y.y"
 
 
 #ifdef EXTERNAL_TEST
@@ -78,13 +78,14 @@ extern int yydebug;
     JACOBYRULE = 279,              /* JACOBYRULE  */
     RESIGNATION = 280,             /* RESIGNATION  */
     BEAVERS = 281,                 /* BEAVERS  */
-    CUBE = 282,                    /* CUBE  */
-    CUBEFUL = 283,                 /* CUBEFUL  */
-    CUBELESS = 284,                /* CUBELESS  */
-    DETERMINISTIC = 285,           /* DETERMINISTIC  */
-    NOISE = 286,                   /* NOISE  */
-    PLIES = 287,                   /* PLIES  */
-    PRUNE = 288                    /* PRUNE  */
+    TIME = 282,                    /* TIME  */
+    CUBE = 283,                    /* CUBE  */
+    CUBEFUL = 284,                 /* CUBEFUL  */
+    CUBELESS = 285,                /* CUBELESS  */
+    DETERMINISTIC = 286,           /* DETERMINISTIC  */
+    NOISE = 287,                   /* NOISE  */
+    PLIES = 288,                   /* PLIES  */
+    PRUNE = 289                    /* PRUNE  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -117,13 +118,14 @@ extern int yydebug;
 #define JACOBYRULE 279
 #define RESIGNATION 280
 #define BEAVERS 281
-#define CUBE 282
-#define CUBEFUL 283
-#define CUBELESS 284
-#define DETERMINISTIC 285
-#define NOISE 286
-#define PLIES 287
-#define PRUNE 288
+#define TIME 282
+#define CUBE 283
+#define CUBEFUL 284
+#define CUBELESS 285
+#define DETERMINISTIC 286
+#define NOISE 287
+#define PLIES 288
+#define PRUNE 289
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -140,7 +142,7 @@ union YYSTYPE
     GList *list;
     commandinfo *cmd;
 
-#line 144 "external_y.h"
+#line 146 "external_y.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
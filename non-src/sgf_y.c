@@ -55,7 +55,7 @@
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 1
 
 /* Push parsers.  */
 #define YYPUSH 0
@@ -70,8 +70,6 @@
 #define yyerror         sgferror
 #define yydebug         sgfdebug
 #define yynerrs         sgfnerrs
-#define yylval          sgflval
-#define yychar          sgfchar
 
 /* First part of user prologue.  */
 #line 21 "sgf_y.y"
@@ -91,18 +89,18 @@
 extern char *stpcpy(char *s1, const char *s2);
 #endif
 
-static listOLD *plCollection;    
-    
-extern int sgflex( void );
-
 #define YYERROR_VERBOSE
 
+#define sgfctx sgfget_extra(scanner)
+
+extern sgfcontext *sgfget_extra( void *yyscanner );
+
 void ( *SGFErrorHandler )( const char *, int ) = NULL;
  
-static int sgferror( const char *s ) {
+static int sgferror( void *scanner, const char *s ) {
 
-    if( SGFErrorHandler )
-	SGFErrorHandler( s, 1 );
+    if( sgfctx->ErrorHandler )
+	sgfctx->ErrorHandler( sgfctx, s, 1 );
     else
 	fprintf( stderr, "%s\n", s );
     
@@ -141,7 +139,7 @@ static char *Concatenate( listOLD *pl ) {
 }
 
 
-#line 145 "sgf_y.c"
+#line 143 "sgf_y.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -202,14 +200,14 @@ extern int sgfdebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 95 "sgf_y.y"
+#line 98 "sgf_y.y"
 
     char ach[ 2 ]; /* property identifier */
     char *pch; /* property value */
     property *pp; /* complete property */
     listOLD *pl; /* nodes, sequences, gametrees */
 
-#line 213 "sgf_y.c"
+#line 211 "sgf_y.c"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -218,10 +216,9 @@ typedef union YYSTYPE YYSTYPE;
 #endif
 
 
-extern YYSTYPE sgflval;
 
 
-int sgfparse (void);
+int sgfparse (void *scanner);
 
 
 #endif /* !YY_SGF_SGF_Y_H_INCLUDED  */
@@ -241,19 +238,26 @@ enum yysymbol_kind_t
   YYSYMBOL_9_ = 9,                         /* ']'  */
   YYSYMBOL_YYACCEPT = 10,                  /* $accept  */
   YYSYMBOL_Collection = 11,                /* Collection  */
-  YYSYMBOL_GameTreeSeq = 12,               /* GameTreeSeq  */
-  YYSYMBOL_GameTree = 13,                  /* GameTree  */
-  YYSYMBOL_Sequence = 14,                  /* Sequence  */
-  YYSYMBOL_Node = 15,                      /* Node  */
-  YYSYMBOL_PropertySeq = 16,               /* PropertySeq  */
-  YYSYMBOL_Property = 17,                  /* Property  */
-  YYSYMBOL_ValueSeq = 18,                  /* ValueSeq  */
-  YYSYMBOL_Value = 19,                     /* Value  */
-  YYSYMBOL_ValueCharSeq = 20               /* ValueCharSeq  */
+  YYSYMBOL_TopGameTreeSeq = 12,            /* TopGameTreeSeq  */
+  YYSYMBOL_GameTreeSeq = 13,               /* GameTreeSeq  */
+  YYSYMBOL_GameTree = 14,                  /* GameTree  */
+  YYSYMBOL_Sequence = 15,                  /* Sequence  */
+  YYSYMBOL_Node = 16,                      /* Node  */
+  YYSYMBOL_PropertySeq = 17,               /* PropertySeq  */
+  YYSYMBOL_Property = 18,                  /* Property  */
+  YYSYMBOL_ValueSeq = 19,                  /* ValueSeq  */
+  YYSYMBOL_Value = 20,                     /* Value  */
+  YYSYMBOL_ValueCharSeq = 21               /* ValueCharSeq  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
 
+/* Second part of user prologue.  */
+#line 105 "sgf_y.y"
+
+extern int sgflex( YYSTYPE *yylval_param, void *yyscanner );
+
+#line 261 "sgf_y.c"
 
 
 #ifdef short
@@ -577,16 +581,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  3
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   23
+#define YYLAST   26
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  10
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  11
+#define YYNNTS  12
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  19
+#define YYNRULES  22
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  24
+#define YYNSTATES  26
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   259
@@ -635,8 +639,9 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint8 yyrline[] =
 {
-       0,   112,   112,   117,   118,   120,   123,   127,   129,   131,
-     134,   139,   140,   144,   147,   156,   157,   161,   166,   167
+       0,   119,   119,   126,   127,   137,   141,   142,   144,   147,
+     151,   153,   155,   158,   163,   164,   168,   171,   180,   181,
+     185,   190,   191
 };
 #endif
 
@@ -654,8 +659,8 @@ static const char *const yytname[] =
 {
   "\"end of file\"", "error", "\"invalid token\"", "PROPERTY",
   "VALUETEXT", "'('", "')'", "';'", "'['", "']'", "$accept", "Collection",
-  "GameTreeSeq", "GameTree", "Sequence", "Node", "PropertySeq", "Property",
-  "ValueSeq", "Value", "ValueCharSeq", YY_NULLPTR
+  "TopGameTreeSeq", "GameTreeSeq", "GameTree", "Sequence", "Node",
+  "PropertySeq", "Property", "ValueSeq", "Value", "ValueCharSeq", YY_NULLPTR
 };
 
 static const char *
@@ -670,7 +675,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-17)
+#define YYTABLE_NINF (-20)
 
 #define yytable_value_is_error(Yyn) \
   0
@@ -680,8 +685,8 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 static const yytype_int8 yypact[] =
 {
       -2,     1,    10,    -2,    -2,     7,    -2,    -2,     2,    -2,
-      -1,    -2,    11,    -2,    -2,    -2,    -2,    -2,    12,    -2,
-      13,     9,    -2,    -2
+      -1,    -2,    11,    -2,    -2,    -2,    -2,    -2,    -2,    -2,
+      12,    -2,    13,     9,    -2,    -2
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -689,23 +694,23 @@ static const yytype_int8 yypact[] =
    means the default is an error.  */
 static const yytype_int8 yydefact[] =
 {
-       3,     0,     0,     1,     5,     0,     4,    11,     0,     7,
-       0,     9,     0,     8,    13,    15,    12,     6,     0,    18,
-      14,     0,    19,    17
+       3,     0,     0,     1,     5,     0,     4,    14,     0,    10,
+       0,    12,     0,    11,    16,    18,    15,     8,     9,     7,
+       0,    21,    17,     0,    22,    20
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-      -2,    -2,    14,    -2,    -2,    15,    -2,    -2,    -2,    -2,
-      -2
+      -2,    -2,    -2,    -2,    14,    -2,    15,    -2,    -2,    -2,
+      -2,    -2
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-       0,     1,     2,     6,     8,     9,    10,    16,    18,    20,
-      21
+       0,     1,     2,    12,     6,     8,     9,    10,    16,    20,
+      22,    23
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -713,39 +718,41 @@ static const yytype_int8 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int8 yytable[] =
 {
-      14,     3,    15,    11,   -10,   -10,   -10,    -3,    -3,     7,
-      -2,     4,     4,    22,     7,     5,     5,    17,    23,     0,
-      19,   -16,    12,    13
+      14,     3,    15,    11,   -13,   -13,   -13,    -6,    -6,     7,
+      -2,     4,    17,    24,     7,     5,     5,    18,    25,     0,
+      21,   -19,     0,    13,     0,     0,    19
 };
 
 static const yytype_int8 yycheck[] =
 {
        1,     0,     3,     1,     5,     6,     7,     5,     6,     7,
        0,     1,     1,     4,     7,     5,     5,     6,     9,    -1,
-       8,     8,     8,     8
+       8,     8,    -1,     8,    -1,    -1,    12
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
-       0,    11,    12,     0,     1,     5,    13,     7,    14,    15,
-      16,     1,    12,    15,     1,     3,    17,     6,    18,     8,
-      19,    20,     4,     9
+       0,    11,    12,     0,     1,     5,    14,     7,    15,    16,
+      17,     1,    13,    16,     1,     3,    18,     1,     6,    14,
+      19,     8,    20,    21,     4,     9
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
-       0,    10,    11,    12,    12,    12,    13,    14,    14,    14,
-      15,    16,    16,    16,    17,    18,    18,    19,    20,    20
+       0,    10,    11,    12,    12,    12,    13,    13,    13,    14,
+      15,    15,    15,    16,    17,    17,    17,    18,    19,    19,
+      20,    21,    21
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
-       0,     2,     1,     0,     2,     2,     4,     1,     2,     2,
-       2,     0,     2,     2,     3,     0,     2,     3,     0,     2
+       0,     2,     1,     0,     2,     2,     0,     2,     2,     4,
+       1,     2,     2,     2,     0,     2,     2,     3,     0,     2,
+       3,     0,     2
 };
 
 
@@ -774,7 +781,7 @@ enum { YYENOMEM = -2 };
       }                                                           \
     else                                                          \
       {                                                           \
-        yyerror (YY_("syntax error: cannot back up")); \
+        yyerror (scanner, YY_("syntax error: cannot back up")); \
         YYERROR;                                                  \
       }                                                           \
   while (0)
@@ -807,7 +814,7 @@ do {                                                                      \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Kind, Value); \
+                  Kind, Value, scanner); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -819,10 +826,11 @@ do {                                                                      \
 
 static void
 yy_symbol_value_print (FILE *yyo,
-                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void *scanner)
 {
   FILE *yyoutput = yyo;
   YY_USE (yyoutput);
+  YY_USE (scanner);
   if (!yyvaluep)
     return;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
@@ -837,12 +845,12 @@ yy_symbol_value_print (FILE *yyo,
 
 static void
 yy_symbol_print (FILE *yyo,
-                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void *scanner)
 {
   YYFPRINTF (yyo, "%s %s (",
              yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner);
   YYFPRINTF (yyo, ")");
 }
 
@@ -876,7 +884,7 @@ do {                                                            \
 
 static void
 yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
-                 int yyrule)
+                 int yyrule, void *scanner)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -889,7 +897,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
                        YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
-                       &yyvsp[(yyi + 1) - (yynrhs)]);
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -897,7 +905,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, Rule); \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
@@ -938,9 +946,10 @@ int yydebug;
 
 static void
 yydestruct (const char *yymsg,
-            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, void *scanner)
 {
   YY_USE (yyvaluep);
+  YY_USE (scanner);
   if (!yymsg)
     yymsg = "Deleting";
   YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
@@ -951,13 +960,6 @@ yydestruct (const char *yymsg,
 }
 
 
-/* Lookahead token kind.  */
-int yychar;
-
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-/* Number of syntax errors so far.  */
-int yynerrs;
 
 
 
@@ -967,8 +969,21 @@ int yynerrs;
 `----------*/
 
 int
-yyparse (void)
+yyparse (void *scanner)
 {
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
     yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
     int yyerrstatus = 0;
@@ -1121,7 +1136,7 @@ yybackup:
   if (yychar == YYEMPTY)
     {
       YYDPRINTF ((stderr, "Reading a token\n"));
-      yychar = yylex ();
+      yychar = yylex (&yylval, scanner);
     }
 
   if (yychar <= YYEOF)
@@ -1208,102 +1223,122 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 2: /* Collection: GameTreeSeq  */
-#line 113 "sgf_y.y"
-                { (yyval.pl) = plCollection = (yyvsp[0].pl); }
-#line 1215 "sgf_y.c"
+  case 2: /* Collection: TopGameTreeSeq  */
+#line 120 "sgf_y.y"
+                { (yyval.pl) = sgfctx->plCollection = (yyvsp[0].pl); }
+#line 1230 "sgf_y.c"
+    break;
+
+  case 3: /* TopGameTreeSeq: %empty  */
+#line 126 "sgf_y.y"
+                { (yyval.pl) = NewList(); }
+#line 1236 "sgf_y.c"
     break;
 
-  case 3: /* GameTreeSeq: %empty  */
-#line 117 "sgf_y.y"
+  case 4: /* TopGameTreeSeq: TopGameTreeSeq GameTree  */
+#line 128 "sgf_y.y"
+                {
+		    (yyval.pl) = (yyvsp[-1].pl);
+		    if( !sgfctx->GameTreeHandler )
+			ListInsert( (yyvsp[-1].pl), (yyvsp[0].pl) );
+		    else if( sgfctx->GameTreeHandler( sgfctx, (yyvsp[0].pl) ) ) {
+			sgfctx->plCollection = (yyvsp[-1].pl);
+			YYACCEPT;
+		    }
+		}
+#line 1250 "sgf_y.c"
+    break;
+
+  case 6: /* GameTreeSeq: %empty  */
+#line 141 "sgf_y.y"
                 { (yyval.pl) = NewList(); }
-#line 1221 "sgf_y.c"
+#line 1256 "sgf_y.c"
     break;
 
-  case 4: /* GameTreeSeq: GameTreeSeq GameTree  */
-#line 119 "sgf_y.y"
+  case 7: /* GameTreeSeq: GameTreeSeq GameTree  */
+#line 143 "sgf_y.y"
                 { ListInsert( (yyvsp[-1].pl), (yyvsp[0].pl) ); (yyval.pl) = (yyvsp[-1].pl); }
-#line 1227 "sgf_y.c"
+#line 1262 "sgf_y.c"
     break;
 
-  case 6: /* GameTree: '(' Sequence GameTreeSeq ')'  */
-#line 124 "sgf_y.y"
+  case 9: /* GameTree: '(' Sequence GameTreeSeq ')'  */
+#line 148 "sgf_y.y"
                 { ListInsert( (yyvsp[-1].pl)->plNext, (yyvsp[-2].pl) ); (yyval.pl) = (yyvsp[-1].pl); }
-#line 1233 "sgf_y.c"
+#line 1268 "sgf_y.c"
     break;
 
-  case 7: /* Sequence: Node  */
-#line 128 "sgf_y.y"
+  case 10: /* Sequence: Node  */
+#line 152 "sgf_y.y"
                 { (yyval.pl) = NewList(); ListInsert( (yyval.pl), (yyvsp[0].pl) ); }
-#line 1239 "sgf_y.c"
+#line 1274 "sgf_y.c"
     break;
 
-  case 8: /* Sequence: Sequence Node  */
-#line 130 "sgf_y.y"
+  case 11: /* Sequence: Sequence Node  */
+#line 154 "sgf_y.y"
                 { ListInsert( (yyvsp[-1].pl), (yyvsp[0].pl) ); (yyval.pl) = (yyvsp[-1].pl); }
-#line 1245 "sgf_y.c"
+#line 1280 "sgf_y.c"
     break;
 
-  case 10: /* Node: ';' PropertySeq  */
-#line 135 "sgf_y.y"
+  case 13: /* Node: ';' PropertySeq  */
+#line 159 "sgf_y.y"
                 { (yyval.pl) = (yyvsp[0].pl); }
-#line 1251 "sgf_y.c"
+#line 1286 "sgf_y.c"
     break;
 
-  case 11: /* PropertySeq: %empty  */
-#line 139 "sgf_y.y"
+  case 14: /* PropertySeq: %empty  */
+#line 163 "sgf_y.y"
                 { (yyval.pl) = NewList(); }
-#line 1257 "sgf_y.c"
+#line 1292 "sgf_y.c"
     break;
 
-  case 12: /* PropertySeq: PropertySeq Property  */
-#line 141 "sgf_y.y"
+  case 15: /* PropertySeq: PropertySeq Property  */
+#line 165 "sgf_y.y"
                 { ListInsert( (yyvsp[-1].pl), (yyvsp[0].pp) ); (yyval.pl) = (yyvsp[-1].pl); }
-#line 1263 "sgf_y.c"
+#line 1298 "sgf_y.c"
     break;
 
-  case 14: /* Property: PROPERTY ValueSeq Value  */
-#line 148 "sgf_y.y"
+  case 17: /* Property: PROPERTY ValueSeq Value  */
+#line 172 "sgf_y.y"
                 { 
 		    ListInsert( (yyvsp[-1].pl), (yyvsp[0].pch) );
 		    (yyval.pp) = g_malloc( sizeof(property) ); (yyval.pp)->pl = (yyvsp[-1].pl);
 		    (yyval.pp)->ach[ 0 ] = (yyvsp[-2].ach)[ 0 ]; (yyval.pp)->ach[ 1 ] = (yyvsp[-2].ach)[ 1 ];
 		}
-#line 1273 "sgf_y.c"
+#line 1308 "sgf_y.c"
     break;
 
-  case 15: /* ValueSeq: %empty  */
-#line 156 "sgf_y.y"
+  case 18: /* ValueSeq: %empty  */
+#line 180 "sgf_y.y"
                 { (yyval.pl) = NewList(); }
-#line 1279 "sgf_y.c"
+#line 1314 "sgf_y.c"
     break;
 
-  case 16: /* ValueSeq: ValueSeq Value  */
-#line 158 "sgf_y.y"
+  case 19: /* ValueSeq: ValueSeq Value  */
+#line 182 "sgf_y.y"
                 { ListInsert( (yyvsp[-1].pl), (yyvsp[0].pch) ); (yyval.pl) = (yyvsp[-1].pl); }
-#line 1285 "sgf_y.c"
+#line 1320 "sgf_y.c"
     break;
 
-  case 17: /* Value: '[' ValueCharSeq ']'  */
-#line 162 "sgf_y.y"
+  case 20: /* Value: '[' ValueCharSeq ']'  */
+#line 186 "sgf_y.y"
                 { (yyval.pch) = Concatenate( (yyvsp[-1].pl) ); }
-#line 1291 "sgf_y.c"
+#line 1326 "sgf_y.c"
     break;
 
-  case 18: /* ValueCharSeq: %empty  */
-#line 166 "sgf_y.y"
+  case 21: /* ValueCharSeq: %empty  */
+#line 190 "sgf_y.y"
                 { (yyval.pl) = NewList(); }
-#line 1297 "sgf_y.c"
+#line 1332 "sgf_y.c"
     break;
 
-  case 19: /* ValueCharSeq: ValueCharSeq VALUETEXT  */
-#line 168 "sgf_y.y"
+  case 22: /* ValueCharSeq: ValueCharSeq VALUETEXT  */
+#line 192 "sgf_y.y"
                 { ListInsert( (yyvsp[-1].pl), (yyvsp[0].pch) ); (yyval.pl) = (yyvsp[-1].pl); }
-#line 1303 "sgf_y.c"
+#line 1338 "sgf_y.c"
     break;
 
 
-#line 1307 "sgf_y.c"
+#line 1342 "sgf_y.c"
 
       default: break;
     }
@@ -1350,7 +1385,7 @@ yyerrlab:
   if (!yyerrstatus)
     {
       ++yynerrs;
-      yyerror (YY_("syntax error"));
+      yyerror (scanner, YY_("syntax error"));
     }
 
   if (yyerrstatus == 3)
@@ -1367,7 +1402,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval);
+                      yytoken, &yylval, scanner);
           yychar = YYEMPTY;
         }
     }
@@ -1423,7 +1458,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -1461,7 +1496,7 @@ yyabortlab:
 | yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
 `-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (scanner, YY_("memory exhausted"));
   yyresult = 2;
   goto yyreturnlab;
 
@@ -1476,7 +1511,7 @@ yyreturnlab:
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval);
+                  yytoken, &yylval, scanner);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -1485,7 +1520,7 @@ yyreturnlab:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
@@ -1496,19 +1531,36 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 171 "sgf_y.y"
+#line 195 "sgf_y.y"
+
+
+extern listOLD *SGFParseContext( sgfcontext *psc, FILE *pf ) {
 
+    psc->plCollection = NULL;
+
+    if( SGFStartParse( psc, pf ) < 0 )
+	return NULL;
+
+    return psc->plCollection;
+}
+
+static void ForwardError( sgfcontext *UNUSED(psc), const char *s,
+			  int fParseError ) {
+
+    if( SGFErrorHandler )
+	SGFErrorHandler( s, fParseError );
+    else
+	fprintf( stderr, "%s\n", s );
+}
 
-extern FILE *sgfin;
 extern listOLD *SGFParse( FILE *pf ) {
 
-    
-    sgfin = pf;
-    plCollection = NULL;
+    sgfcontext sc;
 
-    sgfparse();
+    memset( &sc, 0, sizeof( sc ) );
+    sc.ErrorHandler = ForwardError;
 
-    return plCollection;
+    return SGFParseContext( &sc, pf );
 }
 	
 #ifdef SGFTEST
@@ -71,7 +71,7 @@ extern int sgfdebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 95 "sgf_y.y"
+#line 98 "sgf_y.y"
 
     char ach[ 2 ]; /* property identifier */
     char *pch; /* property value */
@@ -87,10 +87,9 @@ typedef union YYSTYPE YYSTYPE;
 #endif
 
 
-extern YYSTYPE sgflval;
 
 
-int sgfparse (void);
+int sgfparse (void *scanner);
 
 
 #endif /* !YY_SGF_SGF_Y_H_INCLUDED  */
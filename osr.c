@@ -30,14 +30,26 @@
 
 #include "eval.h"
 #include "positionid.h"
-#include "mt19937ar.h"
+#include "multithread.h"
 #include "osr.h"
 
 #define MAX_PROBS        32
 #define MAX_GAMMON_PROBS 15
 
-static unsigned long mt[MT_ARRAY_N];
-static int mti = MT_ARRAY_N + 1;
+/* games are handed out to threads in chunks of this size */
+#define OSR_CHUNK 36
+
+/* number of cached one sided rollouts (a power of 2) */
+#define OSP_CACHE_SIZE 512
+
+/* number of memoised one sided moves (a power of 2) */
+#define OSR_MOVE_CACHE_SIZE (1 << 15)
+
+/*
+ * The dice after the quasi random first turns are a hash of the game
+ * and turn numbers, so every game is reproducible on its own whichever
+ * thread plays it and in whatever order.
+ */
 
 static void
 OSRQuasiRandomDice(const unsigned int iTurn, const unsigned int iGame, const unsigned int cGames, unsigned int anDice[2])
@@ -49,11 +61,76 @@ OSRQuasiRandomDice(const unsigned int iTurn, const unsigned int iGame, const uns
         anDice[0] = ((iGame / 36) % 6) + 1;
         anDice[1] = ((iGame / 216) % 6) + 1;
     } else {
-        anDice[0] = (unsigned int) (genrand_int32(&mti, mt) % 6) + 1;
-        anDice[1] = (unsigned int) (genrand_int32(&mti, mt) % 6) + 1;
+        /* splitmix64 finaliser */
+        guint64 x = (((guint64) iGame << 32) | iTurn) + G_GUINT64_CONSTANT(0x9e3779b97f4a7c15);
+
+        x = (x ^ (x >> 30)) * G_GUINT64_CONSTANT(0xbf58476d1ce4e5b9);
+        x = (x ^ (x >> 27)) * G_GUINT64_CONSTANT(0x94d049bb133111eb);
+        x ^= x >> 31;
+
+        anDice[0] = (unsigned int) ((x & 0xffffffff) % 6) + 1;
+        anDice[1] = (unsigned int) ((x >> 32) % 6) + 1;
     }
 }
 
+/* Pack one side of the board, 4 bits per point, into key. */
+
+static void
+PackHalfBoard(const unsigned int anBoard[25], guint32 key[4])
+{
+    unsigned int i;
+
+    key[0] = key[1] = key[2] = key[3] = 0;
+    for (i = 0; i < 25; ++i)
+        key[i >> 3] |= (guint32) anBoard[i] << ((i & 7) << 2);
+}
+
+static void
+UnpackHalfBoard(const guint32 key[4], unsigned int anBoard[25])
+{
+    unsigned int i;
+
+    for (i = 0; i < 25; ++i)
+        anBoard[i] = (key[i >> 3] >> ((i & 7) << 2)) & 0xf;
+}
+
+/* Spin locks guarding single entries of the OSR caches */
+
+static void
+osr_lock(int *plock)
+{
+    while (MT_SafeIncCheck(plock))
+        MT_SafeDec(plock);
+}
+
+static void
+osr_unlock(int *plock)
+{
+    MT_SafeDec(plock);
+}
+
+/* MurmurHash3 mixing of a packed half board, as GetHashKey() */
+
+static guint32
+HashHalfBoard(const guint32 key[4], guint32 hash)
+{
+    unsigned int i;
+
+    for (i = 0; i < 4; ++i) {
+        guint32 k = key[i] * 0xcc9e2d51;
+
+        k = (k << 15) | (k >> 17);
+        hash ^= k * 0x1b873593;
+        hash = (hash << 13) | (hash >> 19);
+        hash = hash * 5 + 0xe6546b64;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+
+    return hash;
+}
+
 /* Fill aaProb with one sided bearoff probabilities for position with */
 /* bearoff id n.                                                      */
 
@@ -518,6 +595,37 @@ FindBestMoveOSR4(unsigned int anBoard[25], const unsigned int nDice, unsigned in
 }
 
 
+/*
+ * Memo of best moves, shared by all one sided rollouts and threads. The
+ * same side and roll come up many times in the games of a rollout. The
+ * table is direct mapped: a new move replaces whatever was in its slot.
+ */
+
+typedef struct {
+    guint32 key[4];             /* board before the move, with the roll */
+    guint32 after[4];           /* board after the move */
+    int lock;
+} osrmove;
+
+static osrmove *aOSRMoves;
+
+static osrmove *
+osrmove_slot(const unsigned int anBoard[25], const unsigned int anDice[2], guint32 key[4])
+{
+    static gsize fInit = 0;
+
+    if (g_once_init_enter(&fInit)) {
+        aOSRMoves = g_new0(osrmove, OSR_MOVE_CACHE_SIZE);
+        g_once_init_leave(&fInit, 1);
+    }
+
+    PackHalfBoard(anBoard, key);
+    /* point 24 uses the low 4 bits of key[3]; a valid key has a roll */
+    key[3] |= (anDice[0] << 12) | (anDice[1] << 8);
+
+    return aOSRMoves + (HashHalfBoard(key, 0) & (OSR_MOVE_CACHE_SIZE - 1));
+}
+
 /*
  * Find (and move) best move in one sided rollout.
  *
@@ -535,10 +643,31 @@ FindBestMoveOSR4(unsigned int anBoard[25], const unsigned int nDice, unsigned in
 static void
 FindBestMoveOSR(unsigned int anBoard[25], const unsigned int anDice[2], unsigned int *pnOut)
 {
+    guint32 key[4];
+    osrmove *pm = osrmove_slot(anBoard, anDice, key);
+    unsigned int i;
+
+    osr_lock(&pm->lock);
+    if (!memcmp(pm->key, key, sizeof(key))) {
+        UnpackHalfBoard(pm->after, anBoard);
+        osr_unlock(&pm->lock);
+
+        for (*pnOut = 0, i = 6; i < 25; ++i)
+            *pnOut += anBoard[i];
+
+        return;
+    }
+    osr_unlock(&pm->lock);
+
     if (anDice[0] != anDice[1])
         FindBestMoveOSR2(anBoard, anDice, pnOut);
     else
         FindBestMoveOSR4(anBoard, anDice[0], pnOut);
+
+    osr_lock(&pm->lock);
+    memcpy(pm->key, key, sizeof(key));
+    PackHalfBoard(anBoard, pm->after);
+    osr_unlock(&pm->lock);
 }
 
 /*
@@ -579,6 +708,66 @@ osr(unsigned int anBoard[25], const unsigned int iGame, const unsigned int nGame
 }
 
 
+/*
+ * Games played by one thread of a one sided rollout. Bearoff
+ * probabilities are summed as integers so that the totals do not
+ * depend on how the games were shared out.
+ */
+
+typedef struct {
+    const unsigned int *anBoard;
+    unsigned int nOut;
+    unsigned int nGames;
+    unsigned int nMaxProbs;
+    unsigned int nMaxGammonProbs;
+    int *piChunk;               /* next chunk of games to play */
+    guint64 aProbs[MAX_PROBS];
+    unsigned int anCounts[MAX_GAMMON_PROBS];
+} osrgames;
+
+static gpointer
+OSRPlayGames(gpointer p)
+{
+    osrgames *pog = (osrgames *) p;
+    unsigned int an[25];
+    unsigned short int anProb[32];
+    unsigned int iChunk;
+
+    while ((iChunk = (unsigned int) MT_SafeIncCheck(pog->piChunk)) * OSR_CHUNK < pog->nGames) {
+        unsigned int iGame;
+        unsigned int iLast = MIN((iChunk + 1) * OSR_CHUNK, pog->nGames);
+
+        for (iGame = iChunk * OSR_CHUNK; iGame < iLast; ++iGame) {
+            unsigned int i, n, m;
+
+            memcpy(an, pog->anBoard, sizeof(an));
+
+            /* do actual rollout */
+
+            n = osr(an, iGame, pog->nGames, pog->nOut);
+
+            /* number of chequers in home quadrant */
+
+            m = 0;
+            for (i = 0; i < 6; ++i)
+                m += an[i];
+
+            /* update counts */
+
+            ++pog->anCounts[MIN(m == 15 ? n + 1 : n, pog->nMaxGammonProbs - 1)];
+
+            /* get prob. from bearoff1 */
+
+            getBearoffProbs(PositionBearoff(an, pbc1->nPoints, pbc1->nChequers), anProb);
+
+            for (i = 0; i < 32; ++i)
+                pog->aProbs[MIN(n + i, pog->nMaxProbs - 1)] += anProb[i];
+        }
+    }
+
+    return NULL;
+}
+
 /*
  * RollOSR: perform onesided rollout
  *
@@ -597,53 +786,72 @@ static void
 rollOSR(const unsigned int nGames, const unsigned int anBoard[25], const unsigned int nOut,
         float arProbs[], const unsigned int nMaxProbs, float arGammonProbs[], const unsigned int nMaxGammonProbs)
 {
+    osrgames *aog;
+    unsigned int i, j;
+    unsigned int nThreads = 1;
+    int iChunk = 0;
+
+    g_assert(nMaxProbs <= MAX_PROBS && nMaxGammonProbs <= MAX_GAMMON_PROBS);
+
+#if defined(USE_MULTITHREAD)
+    /* The games are only shared out on the main thread while the pool
+     * is idle; a rollout on a pool thread (or on the main thread while
+     * it waits for the pool) plays them itself, as the other cores are
+     * busy already. The games are short, so plain threads are used
+     * rather than the pool. The utility programs have no thread pool
+     * and leave numThreads at 0. */
+    if (td.numThreads > 1 && MT_GetThreadID() == -1 && td.addedTasks == 0)
+        nThreads = MIN(td.numThreads, (nGames + OSR_CHUNK - 1) / OSR_CHUNK);
+#endif
 
-    unsigned int an[25];
-    unsigned short int anProb[32];
-    unsigned int i;
-    unsigned int iGame;
-
-    int *anCounts = (int *) g_alloca(nMaxGammonProbs * sizeof(int));
-
-    memset(anCounts, 0, sizeof(int) * nMaxGammonProbs);
+    aog = g_new0(osrgames, nThreads);
 
-    for (i = 0; i < nMaxProbs; ++i)
-        arProbs[i] = 0.0f;
+    for (i = 0; i < nThreads; ++i) {
+        aog[i].anBoard = anBoard;
+        aog[i].nOut = nOut;
+        aog[i].nGames = nGames;
+        aog[i].nMaxProbs = nMaxProbs;
+        aog[i].nMaxGammonProbs = nMaxGammonProbs;
+        aog[i].piChunk = &iChunk;
+    }
 
     /* perform rollouts */
 
-    for (iGame = 0; iGame < nGames; ++iGame) {
-        unsigned int n, m;
-
-        memcpy(an, anBoard, sizeof(an));
-
-        /* do actual rollout */
+#if defined(USE_MULTITHREAD)
+    if (nThreads > 1) {
+        GThread **apt = g_new0(GThread *, nThreads);
 
-        n = osr(an, iGame, nGames, nOut);
-
-        /* number of chequers in home quadrant */
-
-        m = 0;
-        for (i = 0; i < 6; ++i)
-            m += an[i];
-
-        /* update counts */
-
-        ++anCounts[MIN(m == 15 ? n + 1 : n, nMaxGammonProbs - 1)];
+        /* this thread plays its share too */
+        for (i = 1; i < nThreads; ++i)
+#if GLIB_CHECK_VERSION (2,32,0)
+            apt[i] = g_thread_try_new(NULL, OSRPlayGames, aog + i, NULL);
+#else
+            apt[i] = g_thread_create(OSRPlayGames, aog + i, TRUE, NULL);
+#endif
 
-        /* get prob. from bearoff1 */
+        OSRPlayGames(aog);
 
-        getBearoffProbs(PositionBearoff(an, pbc1->nPoints, pbc1->nChequers), anProb);
+        /* if a thread could not be created, the others play its games */
+        for (i = 1; i < nThreads; ++i)
+            if (apt[i])
+                g_thread_join(apt[i]);
 
-        for (i = 0; i < 32; ++i)
-            arProbs[MIN(n + i, nMaxProbs - 1)] += anProb[i] / 65535.0f;
+        g_free(apt);
+    } else
+#endif
+        OSRPlayGames(aog);
 
+    for (i = 1; i < nThreads; ++i) {
+        for (j = 0; j < nMaxProbs; ++j)
+            aog[0].aProbs[j] += aog[i].aProbs[j];
+        for (j = 0; j < nMaxGammonProbs; ++j)
+            aog[0].anCounts[j] += aog[i].anCounts[j];
     }
 
     /* scale resulting probabilities */
 
-    for (i = 0; i < (unsigned int) nMaxProbs; ++i) {
-        arProbs[i] /= (float)nGames;
+    for (i = 0; i < nMaxProbs; ++i) {
+        arProbs[i] = (float) ((double) aog[0].aProbs[i] / 65535.0 / nGames);
         /* printf ( "arProbs[%d]=%f\n", i, arProbs[ i ] ); */
     }
 
@@ -651,13 +859,38 @@ rollOSR(const unsigned int nGames, const unsigned int anBoard[25], const unsigne
      * (prob. of getting inside home quadrant in i rolls */
 
     for (i = 0; i < nMaxGammonProbs; ++i) {
-        arGammonProbs[i] = (float)anCounts[i] / (float)nGames;
+        arGammonProbs[i] = (float) aog[0].anCounts[i] / (float) nGames;
         /* printf ( "arGammonProbs[%d]=%f\n", i, arGammonProbs[ i ] ); */
     }
 
+    g_free(aog);
 }
 
 
+/*
+ * Cache of one sided rollouts. The same side of the board is met
+ * again and again against different opponent positions (when
+ * calculating EPCs, or along a game), and the rollout of a side does
+ * not depend on the opponent.
+ */
+
+typedef struct {
+    guint32 key[4];             /* the 25 points, 4 bits each */
+    unsigned int nGames;        /* 0 if the slot is empty */
+    int lock;
+    float arProbs[MAX_PROBS];
+    float arGammonProbs[MAX_GAMMON_PROBS];
+} ospcache;
+
+static ospcache aOSPCache[OSP_CACHE_SIZE];
+
+static ospcache *
+ospcache_slot(const unsigned int anBoard[25], const unsigned int nGames, guint32 key[4])
+{
+    PackHalfBoard(anBoard, key);
+
+    return aOSPCache + (HashHalfBoard(key, nGames) & (OSP_CACHE_SIZE - 1));
+}
 
 /*
  * OSP: one sided probabilities
@@ -697,10 +930,30 @@ osp(const unsigned int anBoard[25], const unsigned int nGames,
     }
 
 
-    if (nOut > 0)
+    if (nOut > 0) {
         /* chequers outside home: do one sided rollout */
+        guint32 key[4];
+        ospcache *pe = ospcache_slot(anBoard, nGames, key);
+
+        osr_lock(&pe->lock);
+        if (pe->nGames == nGames && !memcmp(pe->key, key, sizeof(key))) {
+            memcpy(arProbs, pe->arProbs, sizeof(pe->arProbs));
+            memcpy(arGammonProbs, pe->arGammonProbs, sizeof(pe->arGammonProbs));
+            osr_unlock(&pe->lock);
+            return nTotal;
+        }
+        osr_unlock(&pe->lock);
+
+        ES_COUNT(ESC_EVAL_OSR);
         rollOSR(nGames, an, nOut, arProbs, MAX_PROBS, arGammonProbs, MAX_GAMMON_PROBS);
-    else {
+
+        osr_lock(&pe->lock);
+        memcpy(pe->key, key, sizeof(key));
+        pe->nGames = nGames;
+        memcpy(pe->arProbs, arProbs, sizeof(pe->arProbs));
+        memcpy(pe->arGammonProbs, arGammonProbs, sizeof(pe->arGammonProbs));
+        osr_unlock(&pe->lock);
+    } else {
         /* chequers inside home: use BEAROFF2 */
 
         unsigned short int anProb[32];
@@ -820,10 +1073,6 @@ raceProbs(const TanBoard anBoard, const unsigned int nGames, float arOutput[NUM_
 
     float w, s;
 
-    /* Seed set to ensure that OSR are reproducible */
-
-    init_genrand(0, &mti, mt);
-
     for (i = 0; i < NUM_OUTPUTS; ++i)
         arOutput[i] = 0.0f;
 
@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include "analysis.h"
+#include "anytime.h"
 #include "backgammon.h"
 #include "dice.h"
 #include "drawboard.h"
@@ -1017,6 +1018,14 @@ current_pmr_cubedata_update(evalsetup * pes, float output[2][NUM_ROLLOUT_OUTPUTS
 }
 
 
+/* Whether the cube decisions of pes are made within rTimeBudget;
+ * rollouts are left alone */
+static int
+CubeBudgetUsed(const evalsetup * pes)
+{
+    return rTimeBudget > 0.0f && pes->et == EVAL_EVAL;
+}
+
 static int
 ComputerTurn(void)
 {
@@ -1066,6 +1075,7 @@ ComputerTurn(void)
             float arDouble[4];
             decisionData dd;
             cubedecision cd;
+            evalsetup esCube = ap[ms.fTurn].esCube;
 
             /* Consider cube action */
 
@@ -1102,8 +1112,9 @@ ComputerTurn(void)
             /* Evaluate cube decision */
             dd.pboard = msBoard();
             dd.pci = &ci;
-            dd.pes = &ap[ms.fTurn].esCube;
-            if (RunAsyncProcess((AsyncFun) asyncCubeDecision, &dd, _("Considering cube action...")) != 0)
+            dd.pes = &esCube;
+            if (RunAsyncProcess(CubeBudgetUsed(&esCube) ? (AsyncFun) asyncCubeDecisionBudget :
+                                (AsyncFun) asyncCubeDecision, &dd, _("Considering cube action...")) != 0)
                 return -1;
 
             current_pmr_cubedata_update(dd.pes, dd.aarOutput, dd.aarStdDev);
@@ -1283,6 +1294,9 @@ ComputerTurn(void)
                 ecDH.fCubeful = FALSE;
                 if (ecDH.nPlies)
                     ecDH.nPlies--;
+                if (CubeBudgetUsed(&ap[ms.fTurn].esCube))
+                    /* a small part of the budget for the market window */
+                    ecDH.nPlies = PlanCubePlies(&ecDH, rTimeBudget / 4.0f);
 
                 /* We have access to the cube */
 
@@ -1298,12 +1312,14 @@ ComputerTurn(void)
                     /* We're in market window */
                     decisionData dd;
                     cubedecision cd;
+                    evalsetup esCube = ap[ms.fTurn].esCube;
 
                     /* Consider cube action */
                     dd.pboard = msBoard();
                     dd.pci = &ci;
-                    dd.pes = &ap[ms.fTurn].esCube;
-                    if (RunAsyncProcess((AsyncFun) asyncCubeDecision, &dd, _("Considering cube action...")) != 0)
+                    dd.pes = &esCube;
+                    if (RunAsyncProcess(CubeBudgetUsed(&esCube) ? (AsyncFun) asyncCubeDecisionBudget :
+                                        (AsyncFun) asyncCubeDecision, &dd, _("Considering cube action...")) != 0)
                         return -1;
 
 
@@ -1405,11 +1421,16 @@ ComputerTurn(void)
             fd.pci = &ci;
             fd.pec = &ap[ms.fTurn].esChequer.ec;
             fd.aamf = ap[ms.fTurn].aamf;
-            if ((RunAsyncProcess((AsyncFun) asyncFindMove, &fd, _("Considering move...")) != 0) || fInterrupt) {
+            if ((RunAsyncProcess(rTimeBudget > 0.0f ? (AsyncFun) asyncFindMoveBudget : (AsyncFun) asyncFindMove,
+                                 &fd, _("Considering move...")) != 0) || fInterrupt) {
                 g_free(pmr);
                 return -1;
             }
 
+            if (rTimeBudget > 0.0f && pmr->ml.cMoves)
+                /* the depth the budget allowed */
+                pmr->esChequer.ec.nPlies = pmr->ml.amMoves[0].esMove.ec.nPlies;
+
             /* resort the moves according to cubeful (if applicable),
              * cubeless equities and tie-breaking heuristics to avoid
              * some silly looking moves */
@@ -41,8 +41,105 @@
 #include <glib.h>
 #include <errno.h>
 #include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "positionid.h"
 
+#if defined(__SSE2__)
+
+/* The 24 points of one side squeezed to 4 bits each: 12 bytes in the
+ * low part of the result, the other 4 bytes zero. The key is stored
+ * little endian, as on every SSE2 capable machine. */
+
+static inline __m128i
+PackSide(const unsigned int anPoints[24])
+{
+    const __m128i *p = (const __m128i *) (const void *) anPoints;
+    __m128i const mask = _mm_set1_epi16(0x00ff);
+    __m128i lo, hi;
+
+    /* 8 bits per point */
+    lo = _mm_packus_epi16(_mm_packs_epi32(_mm_loadu_si128(p), _mm_loadu_si128(p + 1)),
+                          _mm_packs_epi32(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3)));
+    hi = _mm_packus_epi16(_mm_packs_epi32(_mm_loadu_si128(p + 4), _mm_loadu_si128(p + 5)), _mm_setzero_si128());
+
+    /* fold each pair of points into the low byte of its 16 bit lane */
+    lo = _mm_and_si128(_mm_or_si128(lo, _mm_srli_epi16(lo, 4)), mask);
+    hi = _mm_and_si128(_mm_or_si128(hi, _mm_srli_epi16(hi, 4)), mask);
+
+    return _mm_packus_epi16(lo, hi);
+}
+
+/* The reverse of PackSide, from the 12 bytes at auch */
+
+static inline void
+UnpackSide(unsigned int anPoints[24], const unsigned char *auch)
+{
+    __m128i *p = (__m128i *) (void *) anPoints;
+    __m128i const nibble = _mm_set1_epi8(0x0f);
+    __m128i const zero = _mm_setzero_si128();
+    __m128i key, lo, hi, pt;
+    int nTail;
+
+    /* 12 bytes: don't read past the end of the key */
+    memcpy(&nTail, auch + 8, sizeof(nTail));
+    key = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *) (const void *) auch), _mm_cvtsi32_si128(nTail));
+
+    lo = _mm_and_si128(key, nibble);
+    hi = _mm_and_si128(_mm_srli_epi16(key, 4), nibble);
+
+    /* points 0 to 15 */
+    pt = _mm_unpacklo_epi8(lo, hi);
+    _mm_storeu_si128(p, _mm_unpacklo_epi16(_mm_unpacklo_epi8(pt, zero), zero));
+    _mm_storeu_si128(p + 1, _mm_unpackhi_epi16(_mm_unpacklo_epi8(pt, zero), zero));
+    _mm_storeu_si128(p + 2, _mm_unpacklo_epi16(_mm_unpackhi_epi8(pt, zero), zero));
+    _mm_storeu_si128(p + 3, _mm_unpackhi_epi16(_mm_unpackhi_epi8(pt, zero), zero));
+
+    /* points 16 to 23 */
+    pt = _mm_unpackhi_epi8(lo, hi);
+    _mm_storeu_si128(p + 4, _mm_unpacklo_epi16(_mm_unpacklo_epi8(pt, zero), zero));
+    _mm_storeu_si128(p + 5, _mm_unpackhi_epi16(_mm_unpacklo_epi8(pt, zero), zero));
+}
+
+extern void
+PositionKey(const TanBoard anBoard, positionkey * pkey)
+{
+    unsigned char *auch = (unsigned char *) pkey->data;
+
+    /* the second store overwrites the zero tail of the first */
+    _mm_storeu_si128((__m128i *) (void *) auch, PackSide(anBoard[1]));
+    _mm_storeu_si128((__m128i *) (void *) (auch + 12), PackSide(anBoard[0]));
+    pkey->data[6] = anBoard[0][24] + (anBoard[1][24] << 4);
+}
+
+extern void
+PositionFromKey(TanBoard anBoard, const positionkey * pkey)
+{
+    const unsigned char *auch = (const unsigned char *) pkey->data;
+
+    UnpackSide(anBoard[1], auch);
+    UnpackSide(anBoard[0], auch + 12);
+    anBoard[0][24] = pkey->data[6] & 0x0f;
+    anBoard[1][24] = (pkey->data[6] >> 4) & 0x0f;
+}
+
+/* In evaluations, the function above is often followed by swapping
+ * the board. Provide one that fills the board already swapped. */
+
+extern void
+PositionFromKeySwapped(TanBoard anBoard, const positionkey * pkey)
+{
+    const unsigned char *auch = (const unsigned char *) pkey->data;
+
+    UnpackSide(anBoard[0], auch);
+    UnpackSide(anBoard[1], auch + 12);
+    anBoard[1][24] = pkey->data[6] & 0x0f;
+    anBoard[0][24] = (pkey->data[6] >> 4) & 0x0f;
+}
+
+#else
+
 extern void
 PositionKey(const TanBoard anBoard, positionkey * pkey)
 {
@@ -125,6 +222,8 @@ PositionFromKeySwapped(TanBoard anBoard, const positionkey * pkey)
     anBoard[0][24] = (anpBoard[6] >> 4) & 0x0f;
 }
 
+#endif                          /* __SSE2__ */
+
 static inline void
 addBits(unsigned char auchKey[10], unsigned int bitPos, unsigned int nBits)
 {
@@ -22,6 +22,7 @@
 #include "common.h"
 
 #include <glib.h>
+#include <glib/gstdio.h>
 #include <stdio.h>
 #include <string.h>
 #if defined(HAVE_FREETYPE)
@@ -218,6 +219,14 @@ iclamp(unsigned int u)
         return (unsigned char) u;
 }
 
+/* (t / 0xFF) for t up to 0xFF * 0xFF without a division, so that the
+ * blending loops below can be vectorised */
+static inline unsigned int
+div255(unsigned int t)
+{
+    return (t + 1 + (t >> 8)) >> 8;
+}
+
 static int
 intersects(int x0, int y0, int cx0, int cy0, int x1, int y1, int cx1, int cy1)
 {
@@ -392,18 +401,13 @@ AlphaBlendBase(unsigned char *puchDest, int nDestStride,
 {
     int x;
 
-    nDestStride -= cx * 3;
-    nBackStride -= cx * 3;
-    nForeStride -= cx * 4;
-
     for (; cy; cy--) {
-        for (x = cx; x; x--) {
-            unsigned int a = puchFore[3];
+        for (x = 0; x < cx; x++) {
+            unsigned int a = puchFore[4 * x + 3];
 
-            *puchDest++ = iclamp((*puchBack++ * a) / 0xFF + *puchFore++);
-            *puchDest++ = iclamp((*puchBack++ * a) / 0xFF + *puchFore++);
-            *puchDest++ = iclamp((*puchBack++ * a) / 0xFF + *puchFore++);
-            puchFore++;         /* skip the alpha channel */
+            puchDest[3 * x] = iclamp(div255(puchBack[3 * x] * a) + puchFore[4 * x]);
+            puchDest[3 * x + 1] = iclamp(div255(puchBack[3 * x + 1] * a) + puchFore[4 * x + 1]);
+            puchDest[3 * x + 2] = iclamp(div255(puchBack[3 * x + 2] * a) + puchFore[4 * x + 2]);
         }
         puchDest += nDestStride;
         puchBack += nBackStride;
@@ -468,18 +472,13 @@ AlphaBlend2(unsigned char *puchDest, int nDestStride,
 
     int x;
 
-    nDestStride -= cx * 3;
-    nBackStride -= cx * 3;
-    nForeStride -= cx * 4;
-
     for (; cy; cy--) {
-        for (x = cx; x; x--) {
-            unsigned int a = puchFore[3];
+        for (x = 0; x < cx; x++) {
+            unsigned int a = puchFore[4 * x + 3];
 
-            *puchDest++ = iclamp((*puchBack++ * (0xFF - a)) / 0xFF + (*puchFore++ * a) / 0xFF);
-            *puchDest++ = iclamp((*puchBack++ * (0xFF - a)) / 0xFF + (*puchFore++ * a) / 0xFF);
-            *puchDest++ = iclamp((*puchBack++ * (0xFF - a)) / 0xFF + (*puchFore++ * a) / 0xFF);
-            puchFore++;         /* skip the alpha channel */
+            puchDest[3 * x] = iclamp(div255(puchBack[3 * x] * (0xFF - a)) + div255(puchFore[4 * x] * a));
+            puchDest[3 * x + 1] = iclamp(div255(puchBack[3 * x + 1] * (0xFF - a)) + div255(puchFore[4 * x + 1] * a));
+            puchDest[3 * x + 2] = iclamp(div255(puchBack[3 * x + 2] * (0xFF - a)) + div255(puchFore[4 * x + 2] * a));
         }
         puchDest += nDestStride;
         puchBack += nBackStride;
@@ -553,9 +552,9 @@ RefractBlend(unsigned char *puchDest, int nDestStride,
             unsigned int a = puchFore[3];
             unsigned char *puch = puchBack + (*psRefract >> 8) * nBackStride + (*psRefract & 0xFF) * 3;
 
-            *puchDest++ = iclamp((puch[0] * a) / 0xFF + *puchFore++);
-            *puchDest++ = iclamp((puch[1] * a) / 0xFF + *puchFore++);
-            *puchDest++ = iclamp((puch[2] * a) / 0xFF + *puchFore++);
+            *puchDest++ = iclamp(div255(puch[0] * a) + *puchFore++);
+            *puchDest++ = iclamp(div255(puch[1] * a) + *puchFore++);
+            *puchDest++ = iclamp(div255(puch[2] * a) + *puchFore++);
             puchFore++;         /* skip the alpha channel */
             psRefract++;
         }
@@ -2623,40 +2622,305 @@ RenderBoardLabels(renderdata * prd, unsigned char *achLo, unsigned char *achHi,
 
 }
 
+/* Rendered images on disk.
+ *
+ * RenderImages reads the images back from the "rendercache" directory of
+ * the user, one file per board design and size, instead of rendering them
+ * again at the next start or when the board returns to an earlier size.
+ * Images it had to render are only written there by RenderImagesSave,
+ * which the board calls once its size has settled; exports and sizes
+ * passed through while resizing are not kept. A file is used only if it was written
+ * by the same build for exactly the same 2d preferences, which is stricter
+ * than PreferenceCompare since the labels and orientation are drawn into
+ * the images too. Only the most recently written files are kept. */
+
+#define RENDER_CACHE_MAGIC "GNUBGRND"
+#define RENDER_CACHE_FILES 8
+#define MAX_IMAGES 20
+
+typedef struct {
+    char achMagic[8];
+    guint32 nSize;
+    guint32 cb;                 /* of the images following the header */
+    char szVersion[64];
+    unsigned char achPrefs[RENDER_PREFS_2D_SIZE];
+} rendercachehead;
+
+#if !GLIB_CHECK_VERSION (2,26,0)
+#ifdef WIN32
+#define GStatBuf struct _g_stat_struct
+#else
+typedef struct stat GStatBuf;
+#endif
+#endif
+
+/* The images of pri and their sizes, in the order they are cached in */
+static unsigned int
+ImageList(renderimages * pri, int nSize, gpointer * appv[MAX_IMAGES], gsize acb[MAX_IMAGES])
+{
+    unsigned int c = 0;
+    gsize n = (gsize) (nSize * nSize);
+    int i;
+
+#define IMAGE(pp, cb) (appv[c] = (gpointer *) (pp), acb[c++] = n * (cb))
+
+    IMAGE(&pri->ach, BOARD_WIDTH * BOARD_HEIGHT * 3);
+    IMAGE(&pri->achChequer[0], CHEQUER_WIDTH * CHEQUER_HEIGHT * 4);
+    IMAGE(&pri->achChequer[1], CHEQUER_WIDTH * CHEQUER_HEIGHT * 4);
+    IMAGE(&pri->achChequerLabels, CHEQUER_WIDTH * CHEQUER_HEIGHT * 3 * 12);
+    IMAGE(&pri->achDice[0], DIE_WIDTH * DIE_HEIGHT * 4);
+    IMAGE(&pri->achDice[1], DIE_WIDTH * DIE_HEIGHT * 4);
+    IMAGE(&pri->achPip[0], 3);
+    IMAGE(&pri->achPip[1], 3);
+    IMAGE(&pri->achCube, CUBE_WIDTH * CUBE_HEIGHT * 4);
+    IMAGE(&pri->achCubeFaces, CUBE_WIDTH * CUBE_HEIGHT * 3 * 12);
+    IMAGE(&pri->asRefract[0], CHEQUER_WIDTH * CHEQUER_HEIGHT * sizeof(unsigned short));
+    IMAGE(&pri->asRefract[1], CHEQUER_WIDTH * CHEQUER_HEIGHT * sizeof(unsigned short));
+    IMAGE(&pri->achResign, RESIGN_WIDTH * RESIGN_HEIGHT * 4);
+    IMAGE(&pri->achResignFaces, RESIGN_WIDTH * RESIGN_HEIGHT * 3 * 3);
+#if defined(USE_GTK)
+    IMAGE(&pri->auchArrow[0], ARROW_WIDTH * ARROW_HEIGHT * 4);
+    IMAGE(&pri->auchArrow[1], ARROW_WIDTH * ARROW_HEIGHT * 4);
+#endif
+    for (i = 0; i < 2; ++i)
+        IMAGE(&pri->achLabels[i], BOARD_WIDTH * BORDER_HEIGHT * 4);
+
+#undef IMAGE
+
+    g_assert(c <= MAX_IMAGES);
+
+    return c;
+}
+
+static void
+RenderCacheHead(rendercachehead * prch, const renderdata * prd, gsize cb)
+{
+    memset(prch, 0, sizeof(*prch));
+    memcpy(prch->achMagic, RENDER_CACHE_MAGIC, sizeof(prch->achMagic));
+    prch->nSize = prd->nSize;
+    prch->cb = (guint32) cb;
+    g_strlcpy(prch->szVersion, VERSION_STRING, sizeof(prch->szVersion));
+    memcpy(prch->achPrefs, prd, RENDER_PREFS_2D_SIZE);
+}
+
+static char *
+RenderCacheFile(const rendercachehead * prch)
+{
+    /* FNV-1a of the header names the file */
+    const unsigned char *pch = (const unsigned char *) prch;
+    guint32 n = 2166136261U;
+    char sz[32];
+    size_t i;
+
+    for (i = 0; i < sizeof(*prch); i++)
+        n = (n ^ pch[i]) * 16777619U;
+
+    sprintf(sz, "render-%08x.img", n);
+
+    return g_build_filename(szHomeDirectory, "rendercache", sz, NULL);
+}
+
+static int
+RenderCacheLoad(const renderdata * prd, gpointer * appv[], const gsize acb[], unsigned int c)
+{
+    rendercachehead rch;
+    char *szFile;
+    gchar *pch;
+    gsize cch, cb = 0;
+    unsigned int i;
+    int fOK;
+
+    for (i = 0; i < c; i++)
+        cb += acb[i];
+
+    RenderCacheHead(&rch, prd, cb);
+    szFile = RenderCacheFile(&rch);
+    fOK = g_file_get_contents(szFile, &pch, &cch, NULL);
+    g_free(szFile);
+
+    if (!fOK)
+        return FALSE;
+
+    if (cch == sizeof(rch) + cb && !memcmp(pch, &rch, sizeof(rch))) {
+        const gchar *pchImage = pch + sizeof(rch);
+
+        for (i = 0; i < c; i++) {
+            memcpy(*appv[i], pchImage, acb[i]);
+            pchImage += acb[i];
+        }
+    } else
+        fOK = FALSE;
+
+    g_free(pch);
+
+    return fOK;
+}
+
+/* Removes all but the RENDER_CACHE_FILES newest files of szDir */
+static void
+RenderCacheTrim(const char *szDir)
+{
+    GDir *pd = g_dir_open(szDir, 0, NULL);
+    const char *szName;
+    char *aszFile[RENDER_CACHE_FILES + 1];
+    time_t at[RENDER_CACHE_FILES + 1];
+    int c = 0, i;
+
+    if (!pd)
+        return;
+
+    while ((szName = g_dir_read_name(pd))) {
+        char *szFile;
+        GStatBuf st;
+
+        if (!g_str_has_prefix(szName, "render-"))
+            continue;
+
+        szFile = g_build_filename(szDir, szName, NULL);
+        if (g_stat(szFile, &st)) {
+            g_free(szFile);
+            continue;
+        }
+
+        /* keep the newest files sorted, newest first */
+        for (i = c; i > 0 && at[i - 1] < st.st_mtime; i--) {
+            aszFile[i] = aszFile[i - 1];
+            at[i] = at[i - 1];
+        }
+        aszFile[i] = szFile;
+        at[i] = st.st_mtime;
+
+        if (c < RENDER_CACHE_FILES)
+            c++;
+        else {
+            g_unlink(aszFile[RENDER_CACHE_FILES]);
+            g_free(aszFile[RENDER_CACHE_FILES]);
+        }
+    }
+
+    g_dir_close(pd);
+
+    for (i = 0; i < c; i++)
+        g_free(aszFile[i]);
+}
+
+extern void
+RenderImagesSave(renderimages * pri)
+{
+    rendercachehead *prch = pri->pvCacheHead;
+    gpointer *appv[MAX_IMAGES];
+    gsize acb[MAX_IMAGES];
+    char *szFile, *szDir;
+    gchar *pch, *pchImage;
+    unsigned int i, c;
+
+    if (!prch)
+        return;
+
+    c = ImageList(pri, (int) prch->nSize, appv, acb);
+    szFile = RenderCacheFile(prch);
+    szDir = g_path_get_dirname(szFile);
+
+    if (!g_mkdir_with_parents(szDir, 0777)) {
+        pch = g_malloc(sizeof(*prch) + prch->cb);
+        memcpy(pch, prch, sizeof(*prch));
+        pchImage = pch + sizeof(*prch);
+        for (i = 0; i < c; i++) {
+            memcpy(pchImage, *appv[i], acb[i]);
+            pchImage += acb[i];
+        }
+
+        if (g_file_set_contents(szFile, pch, (gssize) (sizeof(*prch) + prch->cb), NULL))
+            RenderCacheTrim(szDir);
+
+        g_free(pch);
+    }
+
+    g_free(szDir);
+    g_free(szFile);
+    g_free(prch);
+    pri->pvCacheHead = NULL;
+}
+
+#if defined(USE_MULTITHREAD)
+/* The board and the chequers take most of the rendering time and use
+ * nothing shared but prd, so they are rendered on threads of their own
+ * while the calling thread renders the rest */
+
+typedef struct {
+    renderdata *prd;
+    renderimages *pri;
+} renderjob;
+
+static gpointer
+RenderBoardThread(gpointer p)
+{
+    renderjob *prj = p;
+
+    RenderBoard(prj->prd, prj->pri->ach, BOARD_WIDTH * prj->prd->nSize * 3);
+
+    return NULL;
+}
+
+static gpointer
+RenderChequersThread(gpointer p)
+{
+    renderjob *prj = p;
+
+    RenderChequers(prj->prd, prj->pri->achChequer[0], prj->pri->achChequer[1],
+                   prj->pri->asRefract[0], prj->pri->asRefract[1], prj->prd->nSize * CHEQUER_WIDTH * 4);
+
+    return NULL;
+}
+
+static GThread *
+RenderThread(GThreadFunc pf, renderjob * prj)
+{
+#if GLIB_CHECK_VERSION (2,32,0)
+    return g_thread_try_new(NULL, pf, prj, NULL);
+#else
+    return g_thread_create(pf, prj, TRUE, NULL);
+#endif
+}
+#endif
+
 extern void
 RenderImages(renderdata * prd, renderimages * pri)
 {
 
-    int i;
     int nSize = prd->nSize;
+    gpointer *appv[MAX_IMAGES];
+    gsize acb[MAX_IMAGES], cb;
+    unsigned int i, c;
+    GThread *ptBoard = NULL, *ptChequers = NULL;
+#if defined(USE_MULTITHREAD)
+    renderjob rj;
+#endif
 
-    pri->ach = g_malloc(nSize * nSize * BOARD_WIDTH * BOARD_HEIGHT * 3);
-    pri->achChequer[0] = g_malloc(nSize * nSize * CHEQUER_WIDTH * CHEQUER_HEIGHT * 4);
-    pri->achChequer[1] = g_malloc(nSize * nSize * CHEQUER_WIDTH * CHEQUER_HEIGHT * 4);
-    pri->achChequerLabels = g_malloc(nSize * nSize * CHEQUER_WIDTH * CHEQUER_HEIGHT * 3 * 12);
-    pri->achDice[0] = g_malloc(nSize * nSize * DIE_WIDTH * DIE_HEIGHT * 4);
-    pri->achDice[1] = g_malloc(nSize * nSize * DIE_WIDTH * DIE_HEIGHT * 4);
-    pri->achPip[0] = g_malloc(nSize * nSize * 3);
-    pri->achPip[1] = g_malloc(nSize * nSize * 3);
-    pri->achCube = g_malloc(nSize * nSize * CUBE_WIDTH * CUBE_HEIGHT * 4);
-    pri->achCubeFaces = g_malloc(nSize * nSize * CUBE_WIDTH * CUBE_HEIGHT * 3 * 12);
-    pri->asRefract[0] = g_malloc(nSize * nSize * CHEQUER_WIDTH * CHEQUER_HEIGHT * sizeof(unsigned short));
-    pri->asRefract[1] = g_malloc(nSize * nSize * CHEQUER_WIDTH * CHEQUER_HEIGHT * sizeof(unsigned short));
-    pri->achResign = g_malloc(nSize * nSize * RESIGN_WIDTH * RESIGN_HEIGHT * 4);
-    pri->achResignFaces = g_malloc(nSize * nSize * RESIGN_WIDTH * RESIGN_HEIGHT * 3 * 3);
-#if defined(USE_GTK)
-    pri->auchArrow[0] = g_malloc(prd->nSize * prd->nSize * ARROW_WIDTH * ARROW_HEIGHT * 4);
-    pri->auchArrow[1] = g_malloc(prd->nSize * prd->nSize * ARROW_WIDTH * ARROW_HEIGHT * 4);
-#else
+    c = ImageList(pri, nSize, appv, acb);
+    for (i = 0; i < c; i++)
+        *appv[i] = g_malloc(acb[i]);
+#if !defined(USE_GTK)
     pri->auchArrow[0] = NULL;
     pri->auchArrow[1] = NULL;
 #endif
-    for (i = 0; i < 2; ++i)
-        pri->achLabels[i] = g_malloc(nSize * nSize * BOARD_WIDTH * BORDER_HEIGHT * 4);
 
-    RenderBoard(prd, pri->ach, BOARD_WIDTH * nSize * 3);
-    RenderChequers(prd, pri->achChequer[0], pri->achChequer[1],
-                   pri->asRefract[0], pri->asRefract[1], nSize * CHEQUER_WIDTH * 4);
+    pri->pvCacheHead = NULL;
+    if (RenderCacheLoad(prd, appv, acb, c))
+        return;
+
+#if defined(USE_MULTITHREAD)
+    rj.prd = prd;
+    rj.pri = pri;
+    ptBoard = RenderThread(RenderBoardThread, &rj);
+    ptChequers = RenderThread(RenderChequersThread, &rj);
+#endif
+
+    if (!ptBoard)
+        RenderBoard(prd, pri->ach, BOARD_WIDTH * nSize * 3);
+    if (!ptChequers)
+        RenderChequers(prd, pri->achChequer[0], pri->achChequer[1],
+                       pri->asRefract[0], pri->asRefract[1], nSize * CHEQUER_WIDTH * 4);
     RenderChequerLabels(prd, pri->achChequerLabels, nSize * CHEQUER_LABEL_WIDTH * 3);
     RenderDice(prd, pri->achDice[0], pri->achDice[1], nSize * DIE_WIDTH * 4, TRUE);
     RenderPips(prd, pri->achPip[0], pri->achPip[1], nSize * 3);
@@ -2672,6 +2936,16 @@ RenderImages(renderdata * prd, renderimages * pri)
 
     RenderBoardLabels(prd, pri->achLabels[0], pri->achLabels[1], BOARD_WIDTH * nSize * 4);
 
+    if (ptBoard)
+        g_thread_join(ptBoard);
+    if (ptChequers)
+        g_thread_join(ptChequers);
+
+    /* remember what the images were rendered for, for RenderImagesSave */
+    for (i = 0, cb = 0; i < c; i++)
+        cb += acb[i];
+    pri->pvCacheHead = g_new(rendercachehead, 1);
+    RenderCacheHead(pri->pvCacheHead, prd, cb);
 }
 
 extern void
@@ -2700,6 +2974,8 @@ FreeImages(renderimages * pri)
 #endif
     for (i = 0; i < 2; ++i)
         g_free(pri->achLabels[i]);
+    g_free(pri->pvCacheHead);
+    pri->pvCacheHead = NULL;
 }
 
 extern void
@@ -21,6 +21,8 @@
 #ifndef RENDER_H
 #define RENDER_H
 
+#include <stddef.h>
+
 #include "gnubg-types.h"
 
 #if defined(USE_BOARD3D)
@@ -92,6 +94,9 @@ typedef struct {
 #endif
 } renderdata;
 
+/* The leading part of renderdata that the 2d board is rendered from */
+#define RENDER_PREFS_2D_SIZE (offsetof(renderdata, showMoveIndicator) + sizeof(int))
+
 typedef struct {
     unsigned char *ach, *achChequer[2], *achChequerLabels, *achDice[2], *achPip[2], *achCube, *achCubeFaces;
     unsigned char *achResign;
@@ -99,6 +104,7 @@ typedef struct {
     unsigned short *asRefract[2];
     unsigned char *auchArrow[2];
     unsigned char *achLabels[2];
+    void *pvCacheHead;          /* set while the images are not in the render cache */
 } renderimages;
 
 extern void GrayScaleColC(unsigned char *pCols);
@@ -147,6 +153,7 @@ extern void RenderCubeFaces(renderdata * prd, unsigned char *puch,
 extern void RenderDice(renderdata * prd, unsigned char *puch0, unsigned char *puch1, int nStride, int alpha);
 extern void RenderPips(renderdata * prd, unsigned char *puch0, unsigned char *puch1, int nStride);
 extern void RenderImages(renderdata * prd, renderimages * pri);
+extern void RenderImagesSave(renderimages * pri);
 extern void RenderArrows(renderdata * prd, unsigned char *puch0, unsigned char *puch1, int nStride, int fClockwise);
 extern void
  RenderBoardLabels(renderdata * prd, unsigned char *achLo, unsigned char *achHi, int nStride);
@@ -39,6 +39,7 @@
 #include "format.h"
 #include "multithread.h"
 #include "rollout.h"
+#include "rolloutremote.h"
 #include "lib/simd.h"
 
 #define LogCubeClamped(n) (n < (1 << STAT_MAXCUBE) ? LogCube(n) : (STAT_MAXCUBE - 1))
@@ -238,7 +239,7 @@ RolloutDice(int iTurn, int iGame,
         } else {
             do {
                 int n;
-                if ((n = RollDice(anDice, rngx, rngctx)) != 0)
+                if ((n = RollDiceBuffered(anDice, rngx, rngctx)) != 0)
                     return n;
             } while (anDice[0] == anDice[1]);
 
@@ -248,15 +249,16 @@ RolloutDice(int iTurn, int iGame,
         unsigned int i,         /* the "generation" of the permutation */
          j,                     /* the number we're permuting */
          k;                     /* 36**i */
+        unsigned int n = (unsigned int) (iGame + MT_SafeGet(&nSkip));
 
         for (i = 0, j = 0, k = 1; i < 6 && i <= (unsigned int) iTurn; i++, k *= 36)
-            j = dicePerms->aaanPermutation[i][iTurn][((iGame + MT_SafeGet(&nSkip)) / k + j) % 36];
+            j = dicePerms->aaanPermutation[i][iTurn][(n / k + j) % 36];
 
         anDice[0] = j / 6 + 1;
         anDice[1] = j % 6 + 1;
         return 0;
     } else
-        return RollDice(anDice, rngx, rngctx);
+        return RollDiceBuffered(anDice, rngx, rngctx);
 }
 
 
@@ -1116,13 +1118,77 @@ check_sds(int *active)
 
 }
 
+/* Adds the outcome of a trial of alternative alt to the totals. The
+ * caller holds the lock. */
+
+static void
+ApplyTrial(int alt, float aar[NUM_ROLLOUT_OUTPUTS])
+{
+    rolloutcontext *prc = &ro_apes[alt]->rc;
+    unsigned int j;
+
+    altGameCount[alt]++;
+
+    if (ro_fInvert)
+        InvertEvaluationR(aar, ro_apci[alt]);
+
+    /* apply the results */
+    for (j = 0; j < NUM_ROLLOUT_OUTPUTS; j++) {
+        float rMuNew;
+
+        aarResult[alt][j] += aar[j];
+        rMuNew = aarResult[alt][j] / (float) altGameCount[alt];
+
+        if (altGameCount[alt] > 1) {    /* for i == 0 aarVariance is not defined */
+            float rDelta = rMuNew - aarMu[alt][j];
+
+            aarVariance[alt][j] =
+                aarVariance[alt][j] * (1.0f - 1.0f / (float) (altGameCount[alt] - 1)) +
+                (float) (altGameCount[alt]) * rDelta * rDelta;
+        }
+
+        aarMu[alt][j] = rMuNew;
+
+        if (j < OUTPUT_EQUITY) {
+            if (aarMu[alt][j] < 0.0f)
+                aarMu[alt][j] = 0.0f;
+            else if (aarMu[alt][j] > 1.0f)
+                aarMu[alt][j] = 1.0f;
+        }
+
+        aarSigma[alt][j] = sqrtf(aarVariance[alt][j] / (float) altGameCount[alt]);
+    }                   /* for (j = 0; j < NUM_ROLLOUT_OUTPUTS; j++ ) */
+
+    /* For normal alternatives nGamesDone and altGameCount will be equal. For cube decisions,
+     * however, the two may differ by the number of threads minus 1. So we cheat a little bit, but
+     * it would be better if the double and nodouble alternatives weren't linked */
+    if (prc->nGamesDone < altGameCount[alt])
+        prc->nGamesDone = altGameCount[alt];
+}
+
+/* Checks the stopping rules after a round of trials and returns TRUE
+ * when the rollout is done. The caller holds the lock. */
+
+static int
+RolloutDone(void)
+{
+    int active_alternatives = ro_alternatives;
+
+    if (show_jsds) {
+        check_jsds(&active_alternatives);
+    }
+    if (rcRollout.fStopOnSTD) {
+        check_sds(&active_alternatives);
+    }
+
+    return (active_alternatives < 2 && rcRollout.fStopOnJsd) || active_alternatives < 1;
+}
+
 extern void
 RolloutLoopMT(void *UNUSED(unused))
 {
     TanBoard anBoardEval;
     float aar[NUM_ROLLOUT_OUTPUTS];
-    int active_alternatives;
-    unsigned int j;
     int alt;
     FILE *logfp = NULL;
     rolloutcontext *prc = NULL;
@@ -1134,8 +1200,6 @@ RolloutLoopMT(void *UNUSED(unused))
     /* ============ begin rollout loop ============= */
 
     while (MT_SafeIncValue(&ro_NextTrial) <= cGames) {
-        active_alternatives = ro_alternatives;
-
         for (alt = 0; alt < ro_alternatives; ++alt) {
             int trial = MT_SafeIncValue(&altTrialCount[alt]) - 1;
             /* skip this one if it's already finished */
@@ -1179,44 +1243,7 @@ RolloutLoopMT(void *UNUSED(unused))
 
             multi_debug("exclusive lock: update result for alternative");
             MT_Exclusive();
-            altGameCount[alt]++;
-
-            if (ro_fInvert)
-                InvertEvaluationR(aar, ro_apci[alt]);
-
-            /* apply the results */
-            for (j = 0; j < NUM_ROLLOUT_OUTPUTS; j++) {
-                float rMuNew;
-
-                aarResult[alt][j] += aar[j];
-                rMuNew = aarResult[alt][j] / (float) altGameCount[alt];
-
-                if (altGameCount[alt] > 1) {    /* for i == 0 aarVariance is not defined */
-                    float rDelta = rMuNew - aarMu[alt][j];
-
-                    aarVariance[alt][j] =
-                        aarVariance[alt][j] * (1.0f - 1.0f / (float) (altGameCount[alt] - 1)) +
-                        (float) (altGameCount[alt]) * rDelta * rDelta;
-                }
-
-                aarMu[alt][j] = rMuNew;
-
-                if (j < OUTPUT_EQUITY) {
-                    if (aarMu[alt][j] < 0.0f)
-                        aarMu[alt][j] = 0.0f;
-                    else if (aarMu[alt][j] > 1.0f)
-                        aarMu[alt][j] = 1.0f;
-                }
-
-                aarSigma[alt][j] = sqrtf(aarVariance[alt][j] / (float) altGameCount[alt]);
-            }                   /* for (j = 0; j < NUM_ROLLOUT_OUTPUTS; j++ ) */
-
-            /* For normal alternatives nGamesDone and altGameCount will be equal. For cube decisions,
-             * however, the two may differ by the number of threads minus 1. So we cheat a little bit, but
-             * it would be better if the double and nodouble alternatives weren't linked */
-            if (prc->nGamesDone < altGameCount[alt])
-                prc->nGamesDone = altGameCount[alt];
-
+            ApplyTrial(alt, aar);
             MT_Release();
             multi_debug("exclusive release: update result for alternative");
 
@@ -1235,13 +1262,7 @@ RolloutLoopMT(void *UNUSED(unused))
 
         multi_debug("exclusive lock: rollout cycle update");
         MT_Exclusive();
-        if (show_jsds) {
-            check_jsds(&active_alternatives);
-        }
-        if (rcRollout.fStopOnSTD) {
-            check_sds(&active_alternatives);
-        }
-        if ((active_alternatives < 2 && rcRollout.fStopOnJsd) || active_alternatives < 1) {
+        if (RolloutDone()) {
             multi_debug("exclusive release: rollout done early");
             MT_Release();
             break;
@@ -1252,6 +1273,88 @@ RolloutLoopMT(void *UNUSED(unused))
     g_free(rngctxMTRollout);
 }
 
+/*
+ * Rounds played for a rollout coordinator, see rolloutremote.h
+ */
+
+static const remotejob *rw_prj;
+static remotealternative *rw_ara;
+static const int *rw_afNoMore;
+static remotetrial *rw_art;
+static rolloutstat(*rw_aars)[2];
+static int rw_nFirst, rw_nEnd, rw_nNext;
+
+static void
+RemoteRolloutLoopMT(void *UNUSED(unused))
+{
+    rngcontext *rngctxMTRollout = CopyRNGContext(rngctxRollout);
+    perArray dicePerms;
+    int k;
+
+    dicePerms.nPermutationSeed = -1;
+
+    while ((k = MT_SafeIncValue(&rw_nNext) - 1) < rw_nEnd && !fInterrupt) {
+        int alt;
+
+        for (alt = 0; alt < rw_prj->alternatives; ++alt) {
+            remotealternative *pra = &rw_ara[alt];
+            rolloutcontext *prc = &pra->rc;
+            int i = (k - rw_nFirst) * rw_prj->alternatives + alt;
+            int trial = pra->nBaseTrial + k;
+            TanBoard anBoardEval;
+
+            /* as RolloutLoopMT */
+            if (rw_afNoMore[alt] || trial > rw_prj->cGames)
+                continue;
+
+            if (prc->fRotate)
+                QuasiRandomSeed(&dicePerms, (int) prc->nSeed);
+
+            MT_SafeSet(&nSkip, 0);
+
+            if (prc->rngRollout != RNG_MANUAL)
+                InitRNGSeed((unsigned int) (prc->nSeed + (trial << 8)), prc->rngRollout, rngctxMTRollout);
+
+            memcpy(&anBoardEval, pra->anBoard, sizeof(anBoardEval));
+
+            BasicCubefulRollout(&anBoardEval, &rw_art[i].ar, 0, trial, &pra->ci, &pra->fCubeDecTop, 1, prc,
+                                rw_aars ? rw_aars + i : NULL, pra->nBasisCube, &dicePerms, rngctxMTRollout, NULL);
+
+            if (fInterrupt)
+                break;
+
+            rw_art[i].fDone = TRUE;
+        }
+    }
+
+    g_free(rngctxMTRollout);
+}
+
+static gboolean
+RemoteRolloutProgress(gpointer UNUSED(unused))
+{
+    return TRUE;
+}
+
+/* Plays rounds nFirst to nEnd - 1 of the job on all threads. art and
+ * aars (if statistics are wanted) must be zeroed by the caller. */
+
+extern void
+RemoteRolloutRounds(const remotejob * prj, remotealternative * ara, int nFirst, int nEnd,
+                    const int afNoMore[], remotetrial * art, rolloutstat(*aars)[2])
+{
+    rw_prj = prj;
+    rw_ara = ara;
+    rw_afNoMore = afNoMore;
+    rw_art = art;
+    rw_aars = aars;
+    rw_nFirst = rw_nNext = nFirst;
+    rw_nEnd = nEnd;
+
+    mt_add_tasks(MT_GetNumThreads(), RemoteRolloutLoopMT, NULL, NULL);
+    MT_WaitForTasks(RemoteRolloutProgress, 1000, FALSE);
+}
+
 static rolloutprogressfunc *ro_pfProgress;
 static void *ro_pUserData;
 
@@ -1278,6 +1381,331 @@ UpdateProgress(gpointer UNUSED(unused))
     return TRUE;
 }
 
+#if HAVE_SOCKETS
+
+/*
+ * Rollouts shared with worker processes, see rolloutremote.h
+ */
+
+/* rounds handed out at a time, per thread of the worker */
+#define REMOTE_ROUNDS_PER_THREAD 4
+
+/* A worker is given up if it has not returned its rounds after
+ * REMOTE_TIMEOUT_FACTOR times as long as the slowest block of rounds so
+ * far took, and at least REMOTE_TIMEOUT_MIN milliseconds */
+#define REMOTE_TIMEOUT_FACTOR 10.0
+#define REMOTE_TIMEOUT_MIN 120000.0
+
+typedef struct {
+    const char *szName;
+    int h;                      /* -1 once the connection is lost */
+    int nThreads;
+    int nFirst, nEnd;           /* rounds being played, nFirst == nEnd when idle */
+    double rSent;               /* get_time() when they were handed out */
+} remoteworker;
+
+typedef struct {
+    int nFirst, nEnd;
+    char *pchResults;           /* REMOTE_RESULTS as received */
+} remoteblock;
+
+static void
+AddRolloutstat(rolloutstat ars[2], const rolloutstat arsAdd[2])
+{
+    /* rolloutstat only holds counters */
+    int *pn = (int *) ars;
+    const int *pnAdd = (const int *) arsAdd;
+    unsigned int i;
+
+    for (i = 0; i < 2 * sizeof(rolloutstat) / sizeof(int); i++)
+        pn[i] += pnAdd[i];
+}
+
+static void
+LoseWorker(remoteworker * prw, GQueue * pqLost)
+{
+    outputf(_("Lost rollout worker %s.\n"), prw->szName);
+
+    RemoteClose(prw->h);
+    prw->h = -1;
+
+    /* somebody else will have to play its rounds */
+    if (prw->nFirst < prw->nEnd) {
+        int *an = g_new(int, 2);
+
+        an[0] = prw->nFirst;
+        an[1] = prw->nEnd;
+        g_queue_push_tail(pqLost, an);
+        prw->nFirst = prw->nEnd;
+    }
+}
+
+/* Adds the results received so far to the totals, in round order, as
+ * RolloutLoopMT would on one thread. Returns TRUE when the stopping rules
+ * end the rollout. */
+
+static int
+ApplyRemoteRounds(GList ** pplBlocks, int *pnApplied)
+{
+    for (;;) {
+        GList *pl;
+        remoteblock *prb = NULL;
+        const remotetrial *art;
+        const rolloutstat(*aars)[2];
+        int k, fDone = FALSE;
+
+        for (pl = *pplBlocks; pl; pl = pl->next)
+            if (((remoteblock *) pl->data)->nFirst == *pnApplied) {
+                prb = pl->data;
+                break;
+            }
+
+        if (!prb)
+            return FALSE;
+
+        *pplBlocks = g_list_delete_link(*pplBlocks, pl);
+
+        art = (const remotetrial *) (prb->pchResults + 2 * sizeof(int));
+        aars = (const rolloutstat(*)[2]) (art + (prb->nEnd - prb->nFirst) * ro_alternatives);
+
+        for (k = prb->nFirst; k < prb->nEnd && !fDone; k++) {
+            int alt;
+
+            for (alt = 0; alt < ro_alternatives; ++alt) {
+                int i = (k - prb->nFirst) * ro_alternatives + alt;
+                float aar[NUM_ROLLOUT_OUTPUTS];
+
+                if (fNoMore[alt] || !art[i].fDone)
+                    continue;
+
+                memcpy(aar, art[i].ar, sizeof(aar));
+                ApplyTrial(alt, aar);
+
+                if (ro_aarsStatistics)
+                    AddRolloutstat(ro_aarsStatistics[alt], aars[i]);
+            }
+
+            ++*pnApplied;
+            fDone = RolloutDone();
+        }
+
+        g_free(prb->pchResults);
+        g_free(prb);
+
+        if (fDone)
+            return TRUE;
+    }
+}
+
+/* Plays up to nRounds rounds of the rollout on the workers listed in
+ * szRolloutWorkers and returns the number of rounds done. *pfDone is set
+ * when the stopping rules ended the rollout. */
+
+static int
+RolloutRemote(int nRounds, int *pfDone)
+{
+    gchar **aszWorkers;
+    remoteworker *arw;
+    remotealternative *ara;
+    remotejob rj;
+    char *pchJob;
+    size_t cbJob;
+    int *anRounds, *ah;
+    remoteworker **aprwBusy;
+    GQueue *pqLost;
+    GList *plBlocks = NULL;
+    int alt, i, cWorkers = 0, nNext = 0, nApplied = 0;
+    double rSlowest = 0.0;
+
+    *pfDone = FALSE;
+
+    for (alt = 0; alt < ro_alternatives; ++alt)
+        if (ro_apes[alt]->rc.rngRollout >= RNG_MANUAL) {
+            outputl(_("Rollouts with this random number generator are not shared with rollout workers."));
+            return 0;
+        }
+
+    memset(&rj, 0, sizeof(rj));
+    RemoteVersion(rj.szVersion, sizeof(rj.szVersion));
+    rj.cbRolloutContext = sizeof(rolloutcontext);
+    rj.cbCubeInfo = sizeof(cubeinfo);
+    rj.alternatives = ro_alternatives;
+    rj.cGames = cGames;
+    rj.fStatistics = ro_aarsStatistics != NULL;
+
+    ara = g_new0(remotealternative, ro_alternatives);
+    for (alt = 0; alt < ro_alternatives; ++alt) {
+        memcpy(ara[alt].anBoard, ro_apBoard[alt], sizeof(TanBoard));
+        ara[alt].ci = *ro_apci[alt];
+        ara[alt].rc = ro_apes[alt]->rc;
+        ara[alt].fCubeDecTop = *ro_apCubeDecTop[alt];
+        ara[alt].nBasisCube = aciLocal[ro_fCubeRollout ? 0 : alt].nCube;
+        ara[alt].nBaseTrial = altTrialCount[alt];
+    }
+
+    cbJob = sizeof(rj) + ro_alternatives * sizeof(remotealternative);
+    pchJob = g_malloc(cbJob);
+    memcpy(pchJob, &rj, sizeof(rj));
+    memcpy(pchJob + sizeof(rj), ara, ro_alternatives * sizeof(remotealternative));
+    g_free(ara);
+
+    aszWorkers = g_strsplit_set(szRolloutWorkers, " \t,", -1);
+    arw = g_new0(remoteworker, g_strv_length(aszWorkers));
+
+    for (i = 0; aszWorkers[i]; i++) {
+        remotemessagetype rmt = REMOTE_ERROR;
+        void *p = NULL;
+        size_t cb;
+        int h;
+
+        if (!*aszWorkers[i] || (h = RemoteConnect(aszWorkers[i])) < 0)
+            continue;
+
+        if (RemoteSend(h, REMOTE_JOB, pchJob, cbJob) || (p = RemoteReceive(h, &rmt, &cb)) == NULL ||
+            rmt != REMOTE_READY || cb != sizeof(int)) {
+            if (p && rmt == REMOTE_ERROR)
+                outputf("%s: %s\n", aszWorkers[i], (char *) p);
+            else
+                outputf(_("%s: no answer from the rollout worker.\n"), aszWorkers[i]);
+
+            g_free(p);
+            RemoteClose(h);
+            continue;
+        }
+
+        arw[cWorkers].szName = aszWorkers[i];
+        arw[cWorkers].h = h;
+        arw[cWorkers].nThreads = MAX(*(int *) p, 1);
+        cWorkers++;
+        g_free(p);
+    }
+
+    g_free(pchJob);
+
+    anRounds = g_new(int, 2 + ro_alternatives);
+    ah = g_new(int, MAX(cWorkers, 1));
+    aprwBusy = g_new(remoteworker *, MAX(cWorkers, 1));
+    pqLost = g_queue_new();
+
+    while (!*pfDone && !fInterrupt && nApplied < nRounds) {
+        int cBusy = 0, cAlive = 0;
+        double rNow = get_time();
+
+        /* hand out rounds to idle workers, rounds of lost workers first */
+        for (i = 0; i < cWorkers; i++) {
+            remoteworker *prw = &arw[i];
+
+            if (prw->h < 0)
+                continue;
+
+            if (prw->nFirst < prw->nEnd &&
+                rNow - prw->rSent > MAX(REMOTE_TIMEOUT_MIN, REMOTE_TIMEOUT_FACTOR * rSlowest)) {
+                outputf(_("Rollout worker %s does not answer.\n"), prw->szName);
+                LoseWorker(prw, pqLost);
+                continue;
+            }
+
+            if (prw->nFirst == prw->nEnd) {
+                if (!g_queue_is_empty(pqLost)) {
+                    int *an = g_queue_pop_head(pqLost);
+
+                    prw->nFirst = an[0];
+                    prw->nEnd = an[1];
+                    g_free(an);
+                } else if (nNext < nRounds) {
+                    prw->nFirst = nNext;
+                    prw->nEnd = nNext = MIN(nRounds, nNext + prw->nThreads * REMOTE_ROUNDS_PER_THREAD);
+                }
+
+                if (prw->nFirst < prw->nEnd) {
+                    anRounds[0] = prw->nFirst;
+                    anRounds[1] = prw->nEnd;
+                    memcpy(anRounds + 2, fNoMore, ro_alternatives * sizeof(int));
+
+                    if (RemoteSend(prw->h, REMOTE_ROUNDS, anRounds, (2 + ro_alternatives) * sizeof(int))) {
+                        LoseWorker(prw, pqLost);
+                        continue;
+                    }
+
+                    prw->rSent = get_time();
+                }
+            }
+
+            cAlive++;
+
+            if (prw->nFirst < prw->nEnd) {
+                ah[cBusy] = prw->h;
+                aprwBusy[cBusy++] = prw;
+            }
+        }
+
+        if (!cAlive)
+            break;
+
+        if (cBusy && (i = RemoteWait(ah, cBusy, 250)) >= 0) {
+            remoteworker *prw = aprwBusy[i];
+            int nCount = prw->nEnd - prw->nFirst;
+            size_t cbExpected = 2 * sizeof(int) + nCount * ro_alternatives * (sizeof(remotetrial) +
+                                                                            (ro_aarsStatistics ? 2 *
+                                                                             sizeof(rolloutstat) : 0));
+            remotemessagetype rmt;
+            size_t cb;
+            char *pch = RemoteReceive(prw->h, &rmt, &cb);
+
+            if (!pch || rmt != REMOTE_RESULTS || cb != cbExpected || *(int *) pch != prw->nFirst) {
+                g_free(pch);
+                LoseWorker(prw, pqLost);
+            } else {
+                remoteblock *prb = g_new(remoteblock, 1);
+
+                prb->nFirst = prw->nFirst;
+                prb->nEnd = prw->nEnd;
+                prb->pchResults = pch;
+                plBlocks = g_list_prepend(plBlocks, prb);
+                prw->nFirst = prw->nEnd;
+                rSlowest = MAX(rSlowest, get_time() - prw->rSent);
+
+                *pfDone = ApplyRemoteRounds(&plBlocks, &nApplied);
+                UpdateProgress(NULL);
+            }
+        }
+
+        ProcessEvents();
+    }
+
+    if (!*pfDone && !fInterrupt && nApplied < nRounds)
+        outputl(_("No rollout worker left, rolling out the remaining trials locally."));
+
+    for (i = 0; i < cWorkers; i++)
+        if (arw[i].h >= 0) {
+            /* results still pending are simply not read */
+            RemoteSend(arw[i].h, REMOTE_DONE, NULL, 0);
+            RemoteClose(arw[i].h);
+        }
+
+    while (plBlocks) {
+        remoteblock *prb = plBlocks->data;
+
+        g_free(prb->pchResults);
+        g_free(prb);
+        plBlocks = g_list_delete_link(plBlocks, plBlocks);
+    }
+
+    while (!g_queue_is_empty(pqLost))
+        g_free(g_queue_pop_head(pqLost));
+
+    g_queue_free(pqLost);
+    g_free(aprwBusy);
+    g_free(ah);
+    g_free(anRounds);
+    g_free(arw);
+    g_strfreev(aszWorkers);
+
+    return nApplied;
+}
+
+#endif                          /* HAVE_SOCKETS */
+
 extern int
 RolloutGeneral(ConstTanBoard * apBoard,
                float (*apOutput[])[NUM_ROLLOUT_OUTPUTS],
@@ -1468,12 +1896,28 @@ RolloutGeneral(ConstTanBoard * apBoard,
     UpdateProgress(NULL);
 
     if (active_alternatives > 1 || (!rcRollout.fStopOnJsd && active_alternatives > 0)) {
-        multi_debug("rollout adding tasks");
-        mt_add_tasks(MT_GetNumThreads(), RolloutLoopMT, NULL, NULL);
+        int fDone = FALSE;
 
-        multi_debug("rollout waiting for tasks to complete");
-        MT_WaitForTasks(UpdateProgress, 2000, fAutoSaveRollout);
-        multi_debug("rollout finished waiting for tasks to complete");
+#if HAVE_SOCKETS
+        if (szRolloutWorkers && *szRolloutWorkers) {
+            /* continue locally where the workers left off */
+            int nRounds = RolloutRemote(cGames - ro_NextTrial, &fDone);
+
+            ro_NextTrial += nRounds;
+            for (alt = 0; alt < alternatives; ++alt)
+                if (!fNoMore[alt])
+                    altTrialCount[alt] = MIN(altTrialCount[alt] + nRounds, cGames + 1);
+        }
+#endif
+
+        if (!fDone && !fInterrupt) {
+            multi_debug("rollout adding tasks");
+            mt_add_tasks(MT_GetNumThreads(), RolloutLoopMT, NULL, NULL);
+
+            multi_debug("rollout waiting for tasks to complete");
+            MT_WaitForTasks(UpdateProgress, 2000, fAutoSaveRollout);
+            multi_debug("rollout finished waiting for tasks to complete");
+        }
     }
 
     /* Make sure final output is up to date */
@@ -0,0 +1,495 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* Rollout workers and the connections to them, see rolloutremote.h */
+
+#include "config.h"
+
+#include <errno.h>
+#include <float.h>
+#include <stdio.h>
+#include <string.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+
+#if HAVE_SOCKETS
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifndef WIN32
+#if HAVE_SYS_SOCKET_H
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#endif
+#else
+#include <winsock2.h>
+#endif
+
+#endif                          /* HAVE_SOCKETS */
+
+#include "backgammon.h"
+#include "external.h"
+#include "matchequity.h"
+#include "multithread.h"
+#include "positionid.h"
+#include "rolloutremote.h"
+
+char *szRolloutWorkers = NULL;
+
+#if HAVE_SOCKETS
+
+#if defined(MSG_NOSIGNAL)
+#define REMOTE_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define REMOTE_SEND_FLAGS 0
+#endif
+
+/* sanity limit for the size of a message */
+#define REMOTE_MAX_MESSAGE (1 << 28)
+
+/* seconds the coordinator waits for the rest of a message, or for the
+ * answer to a job, before it gives the worker up */
+#define REMOTE_RECEIVE_TIMEOUT 120
+
+extern void
+RemoteVersion(char *sz, size_t cb)
+{
+    g_strlcpy(sz, "GNU Backgammon " VERSION " " WEIGHTS_VERSION, cb);
+}
+
+static int
+ReadAll(int h, void *p, size_t cb)
+{
+    char *pch = p;
+
+    while (cb) {
+#ifdef WIN32
+        int n = recv((SOCKET) h, pch, (int) cb, 0);
+#else
+        ssize_t n = recv(h, pch, cb, 0);
+#endif
+
+        if (n == 0)
+            return -1;
+        else if (n < 0) {
+            if (errno == EINTR && !fInterrupt)
+                continue;
+
+            return -1;
+        }
+
+        pch += n;
+        cb -= (size_t) n;
+    }
+
+    return 0;
+}
+
+static int
+WriteAll(int h, const void *p, size_t cb)
+{
+    const char *pch = p;
+
+    while (cb) {
+#ifdef WIN32
+        int n = send((SOCKET) h, pch, (int) cb, 0);
+#else
+        ssize_t n = send(h, pch, cb, REMOTE_SEND_FLAGS);
+#endif
+
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR && !fInterrupt)
+                continue;
+
+            return -1;
+        }
+
+        pch += n;
+        cb -= (size_t) n;
+    }
+
+    return 0;
+}
+
+extern int
+RemoteConnect(const char *szSocket)
+{
+    struct sockaddr *psa;
+    int h, cb;
+    char *sz = g_strdup(szSocket);
+
+    if ((h = ExternalSocket(&psa, &cb, sz)) < 0) {
+        SockErr(szSocket);
+        g_free(sz);
+        return -1;
+    }
+
+    g_free(sz);
+
+    if (connect(h, psa, cb) < 0) {
+        SockErr(szSocket);
+        closesocket(h);
+        h = -1;
+    } else {
+#ifdef WIN32
+        DWORD tv = REMOTE_RECEIVE_TIMEOUT * 1000;
+#else
+        struct timeval tv;
+
+        tv.tv_sec = REMOTE_RECEIVE_TIMEOUT;
+        tv.tv_usec = 0;
+#endif
+        /* a worker that stops answering makes ReadAll fail */
+        if (setsockopt(h, SOL_SOCKET, SO_RCVTIMEO, (const char *) &tv, sizeof(tv)) < 0)
+            SockErr("setsockopt");
+    }
+
+    g_free(psa);
+
+    return h;
+}
+
+extern void
+RemoteClose(int h)
+{
+    closesocket(h);
+}
+
+extern int
+RemoteSend(int h, remotemessagetype rmt, const void *p, size_t cb)
+{
+    remotemessage rm;
+
+    rm.nType = rmt;
+    rm.cb = (int) cb;
+
+    return WriteAll(h, &rm, sizeof(rm)) || (cb && WriteAll(h, p, cb)) ? -1 : 0;
+}
+
+/* Returns the payload of the next message (to be freed with g_free), or
+ * NULL if the connection was closed or failed */
+
+extern void *
+RemoteReceive(int h, remotemessagetype * prmt, size_t * pcb)
+{
+    remotemessage rm;
+    void *p;
+
+    if (ReadAll(h, &rm, sizeof(rm)) || rm.cb < 0 || rm.cb > REMOTE_MAX_MESSAGE)
+        return NULL;
+
+    /* one extra byte, so that messages can be read as strings */
+    p = g_malloc0((gsize) rm.cb + 1);
+
+    if (ReadAll(h, p, (size_t) rm.cb)) {
+        g_free(p);
+        return NULL;
+    }
+
+    *prmt = (remotemessagetype) rm.nType;
+    *pcb = (size_t) rm.cb;
+
+    return p;
+}
+
+/* Returns the index of a socket in ah with data to read, -1 if there is
+ * none within msTimeout milliseconds and -2 on errors */
+
+extern int
+RemoteWait(const int ah[], int c, int msTimeout)
+{
+    fd_set fds;
+    struct timeval tv;
+    int i, hMax = -1;
+
+    FD_ZERO(&fds);
+    for (i = 0; i < c; i++) {
+        FD_SET(ah[i], &fds);
+        hMax = MAX(hMax, ah[i]);
+    }
+
+    tv.tv_sec = msTimeout / 1000;
+    tv.tv_usec = (msTimeout % 1000) * 1000;
+
+    if (select(hMax + 1, &fds, NULL, NULL, &tv) < 0)
+        return errno == EINTR ? -1 : -2;
+
+    for (i = 0; i < c; i++)
+        if (FD_ISSET(ah[i], &fds))
+            return i;
+
+    return -1;
+}
+
+static char *
+CheckJob(const remotejob * prj, size_t cb)
+{
+    char szVersion[sizeof(prj->szVersion)];
+
+    RemoteVersion(szVersion, sizeof(szVersion));
+
+    if (cb < sizeof(*prj) || strncmp(prj->szVersion, szVersion, sizeof(szVersion)) ||
+        prj->cbRolloutContext != (int) sizeof(rolloutcontext) || prj->cbCubeInfo != (int) sizeof(cubeinfo))
+        return g_strdup_printf(_("The rollout worker runs %s, the coordinator must use the same version."),
+                               szVersion);
+
+    if (prj->alternatives < 1 || prj->cGames < 1 ||
+        cb != sizeof(*prj) + (size_t) prj->alternatives * sizeof(remotealternative))
+        return g_strdup(_("Invalid rollout job."));
+
+    return NULL;
+}
+
+static int
+ValidEvalContext(const evalcontext * pec)
+{
+    return pec->nPlies <= 7 && pec->rNoise >= 0.0f && pec->rNoise <= FLT_MAX;
+}
+
+static int
+ValidMoveFilters(const movefilter aamf[MAX_FILTER_PLIES][MAX_FILTER_PLIES])
+{
+    int i, j;
+
+    for (i = 0; i < MAX_FILTER_PLIES; i++)
+        for (j = 0; j < MAX_FILTER_PLIES; j++) {
+            const movefilter *pmf = &aamf[i][j];
+
+            if (pmf->Accept < -1 || pmf->Accept > MAX_MOVES || pmf->Extra < 0 || pmf->Extra > MAX_MOVES ||
+                !(pmf->Threshold >= 0.0f && pmf->Threshold <= FLT_MAX))
+                return FALSE;
+        }
+
+    return TRUE;
+}
+
+static int
+ValidCube(int n)
+{
+    return n > 0 && !(n & (n - 1));
+}
+
+/* The job comes from the network; check everything the rollout indexes
+ * or loops over */
+
+static int
+ValidAlternative(const remotealternative * pra)
+{
+    const rolloutcontext *prc = &pra->rc;
+    const cubeinfo *pci = &pra->ci;
+    int i, j;
+
+    for (i = 0; i < 2; i++)
+        if (!ValidEvalContext(&prc->aecCube[i]) || !ValidEvalContext(&prc->aecChequer[i]) ||
+            !ValidEvalContext(&prc->aecCubeLate[i]) || !ValidEvalContext(&prc->aecChequerLate[i]) ||
+            !ValidMoveFilters(prc->aaamfChequer[i]) || !ValidMoveFilters(prc->aaamfLate[i]))
+            return FALSE;
+
+    if (!ValidEvalContext(&prc->aecCubeTrunc) || !ValidEvalContext(&prc->aecChequerTrunc) ||
+        (int) prc->rngRollout < 0 || prc->rngRollout >= RNG_MANUAL)
+        return FALSE;
+
+    if (!ValidCube(pci->nCube) || pci->fCubeOwner < -1 || pci->fCubeOwner > 1 || pci->fMove < 0 ||
+        pci->fMove > 1 || pci->nMatchTo < 0 || pci->nMatchTo >= MAXSCORE || (int) pci->bgv < 0 ||
+        pci->bgv >= NUM_VARIATIONS)
+        return FALSE;
+
+    for (i = 0; i < 2; i++)
+        if (pci->anScore[i] < 0 || (pci->nMatchTo && pci->anScore[i] >= pci->nMatchTo))
+            return FALSE;
+
+    for (i = 0; i < 2; i++)
+        for (j = 0; j < 25; j++)
+            if (pra->anBoard[i][j] > 15)
+                return FALSE;
+
+    return CheckPosition(pra->anBoard) && (pra->fCubeDecTop == 0 || pra->fCubeDecTop == 1) &&
+        ValidCube(pra->nBasisCube) && pra->nBaseTrial >= 0;
+}
+
+/* Plays the rollouts asked for by a coordinator until it disconnects */
+
+static void
+ServeCoordinator(int h)
+{
+    remotejob rj;
+    remotealternative *ara = NULL;
+    void *p;
+    remotemessagetype rmt;
+    size_t cb;
+
+    while (!fInterrupt && (p = RemoteReceive(h, &rmt, &cb)) != NULL) {
+        int fOK = TRUE;
+
+        switch (rmt) {
+        case REMOTE_JOB:{
+                char *szError;
+                int i;
+
+                g_free(ara);
+                ara = NULL;
+
+                if ((szError = CheckJob(p, cb)) != NULL) {
+                    outputl(szError);
+                    fOK = !RemoteSend(h, REMOTE_ERROR, szError, strlen(szError));
+                    g_free(szError);
+                    break;
+                }
+
+                memcpy(&rj, p, sizeof(rj));
+                ara = g_malloc(rj.alternatives * sizeof(remotealternative));
+                memcpy(ara, (char *) p + sizeof(rj), rj.alternatives * sizeof(remotealternative));
+
+                for (i = 0; i < rj.alternatives; i++)
+                    if (!ValidAlternative(&ara[i]))
+                        break;
+
+                if (i < rj.alternatives) {
+                    szError = g_strdup(_("Invalid rollout job."));
+                    outputl(szError);
+                    fOK = !RemoteSend(h, REMOTE_ERROR, szError, strlen(szError));
+                    g_free(szError);
+                    g_free(ara);
+                    ara = NULL;
+                    break;
+                }
+
+                outputf(_("Rolling out %d alternative(s) for the coordinator.\n"), rj.alternatives);
+                outputx();
+
+                {
+                    int nThreads = (int) MT_GetNumThreads();
+
+                    fOK = !RemoteSend(h, REMOTE_READY, &nThreads, sizeof(nThreads));
+                }
+                break;
+            }
+
+        case REMOTE_ROUNDS:{
+                const int *an = p;
+                int nRounds;
+                size_t cbTrials, cbResults;
+                char *pchResults;
+
+                if (!ara || cb != (2 + (size_t) rj.alternatives) * sizeof(int) ||
+                    an[0] < 0 || an[1] <= an[0] || an[1] > rj.cGames + 1) {
+                    fOK = FALSE;
+                    break;
+                }
+
+                nRounds = an[1] - an[0];
+                cbTrials = (size_t) nRounds * rj.alternatives * sizeof(remotetrial);
+                cbResults = 2 * sizeof(int) + cbTrials +
+                    (rj.fStatistics ? (size_t) nRounds * rj.alternatives * 2 * sizeof(rolloutstat) : 0);
+                pchResults = g_malloc0(cbResults);
+
+                memcpy(pchResults, an, 2 * sizeof(int));
+                RemoteRolloutRounds(&rj, ara, an[0], an[1], an + 2, (remotetrial *) (pchResults + 2 * sizeof(int)),
+                                    rj.fStatistics ? (rolloutstat(*)[2]) (pchResults + 2 * sizeof(int) + cbTrials) :
+                                    NULL);
+
+                fOK = !fInterrupt && !RemoteSend(h, REMOTE_RESULTS, pchResults, cbResults);
+                g_free(pchResults);
+                break;
+            }
+
+        case REMOTE_DONE:
+            g_free(ara);
+            ara = NULL;
+            outputl(_("Rollout done."));
+            outputx();
+            break;
+
+        default:
+            fOK = FALSE;
+            break;
+        }
+
+        g_free(p);
+
+        if (!fOK)
+            break;
+    }
+
+    g_free(ara);
+}
+
+#endif                          /* HAVE_SOCKETS */
+
+extern void
+CommandRolloutWorker(char *sz)
+{
+#if !HAVE_SOCKETS
+    (void) sz;                  /* silence compiler warning */
+    outputl(_("This installation of GNU Backgammon was compiled without\n"
+              "socket support, and does not implement rollout workers."));
+#else
+    int h, hPeer, cb;
+    struct sockaddr *psa;
+
+    sz = NextToken(&sz);
+
+    if (!sz || !*sz) {
+        outputl(_("You must specify the socket to wait for a rollout coordinator on."));
+        return;
+    }
+
+    if ((h = ExternalSocket(&psa, &cb, sz)) < 0) {
+        SockErr(sz);
+        return;
+    }
+
+    if (bind(h, psa, cb) < 0) {
+        SockErr(sz);
+        closesocket(h);
+        g_free(psa);
+        return;
+    }
+
+    g_free(psa);
+
+    if (listen(h, 1) < 0)
+        SockErr("listen");
+    else
+        while (!fInterrupt) {
+            outputf(_("Waiting for a rollout coordinator on %s...\n"), sz);
+            outputx();
+
+            if ((hPeer = accept(h, NULL, NULL)) < 0) {
+                if (errno == EINTR)
+                    continue;
+
+                SockErr("accept");
+                break;
+            }
+
+            ServeCoordinator(hPeer);
+            closesocket(hPeer);
+        }
+
+    closesocket(h);
+
+    if (!strchr(sz, ':') || strchr(sz, '/'))
+        /* local domain socket */
+        g_unlink(sz);
+#endif
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+#ifndef ROLLOUTREMOTE_H
+#define ROLLOUTREMOTE_H
+
+#include "rollout.h"
+
+/* Rollouts shared with worker processes.
+ *
+ * A gnubg started with "rolloutworker <socket>" waits for a coordinator.
+ * When "set rollout workers" lists worker sockets, RolloutGeneral sends
+ * each worker the rollout (REMOTE_JOB) and then hands out ranges of
+ * rounds (REMOTE_ROUNDS). In round k, alternative i plays trial
+ * nBaseTrial + k with the same seed as a local rollout would use. The
+ * worker plays the range on its own threads and returns the outcome of
+ * every trial (REMOTE_RESULTS); the coordinator adds them to the totals
+ * in round order, so the result is that of a local rollout on one thread.
+ *
+ * Messages are a remotemessage header followed by cb bytes of payload.
+ * Structures are sent as they are in memory, so coordinator and workers
+ * must be the same build; REMOTE_JOB carries the version to check that. */
+
+typedef enum {
+    REMOTE_JOB = 1,             /* remotejob, then a remotealternative each */
+    REMOTE_READY,               /* int: number of threads of the worker */
+    REMOTE_ROUNDS,              /* two ints (first and end round), then afNoMore[] */
+    REMOTE_RESULTS,             /* two ints, remotetrial[][alternatives], then rolloutstat[][alternatives][2] */
+    REMOTE_DONE,                /* no payload, the job is finished */
+    REMOTE_ERROR                /* error message */
+} remotemessagetype;
+
+typedef struct {
+    int nType;                  /* remotemessagetype */
+    int cb;
+} remotemessage;
+
+typedef struct {
+    char szVersion[64];
+    int cbRolloutContext;
+    int cbCubeInfo;
+    int alternatives;
+    int cGames;
+    int fStatistics;            /* send rollout statistics with the results */
+} remotejob;
+
+typedef struct {
+    TanBoard anBoard;
+    cubeinfo ci;
+    rolloutcontext rc;
+    int fCubeDecTop;
+    int nBasisCube;
+    int nBaseTrial;             /* trial number of round 0 */
+} remotealternative;
+
+typedef struct {
+    int fDone;                  /* the trial was rolled out */
+    float ar[NUM_ROLLOUT_OUTPUTS];
+} remotetrial;
+
+/* space separated list of worker sockets, NULL for local rollouts only */
+extern char *szRolloutWorkers;
+
+/* in rollout.c */
+extern void RemoteRolloutRounds(const remotejob * prj, remotealternative * ara, int nFirst, int nEnd,
+                                const int afNoMore[], remotetrial * art, rolloutstat(*aars)[2]);
+
+/* in rolloutremote.c */
+extern void RemoteVersion(char *sz, size_t cb);
+extern int RemoteConnect(const char *szSocket);
+extern void RemoteClose(int h);
+extern int RemoteSend(int h, remotemessagetype rmt, const void *p, size_t cb);
+extern void *RemoteReceive(int h, remotemessagetype * prmt, size_t * pcb);
+extern int RemoteWait(const int ah[], int c, int msTimeout);
+
+#endif
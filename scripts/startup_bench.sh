@@ -0,0 +1,79 @@
+#!/bin/sh
+
+# Copyright (C) 2026 the AUTHORS
+
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#
+# $Id$
+#
+
+# startup_bench.sh - start-up latency of gnubg with and without a snapshot
+#
+# Usage: startup_bench.sh [gnubg [pkgdatadir [runs]]]
+#
+# gnubg: the program to time (default: gnubg)
+# pkgdatadir: where its data files are (default: /usr/share/gnubg)
+# runs: number of warm starts to time (default: 10)
+#
+# gnubg is started on the command line, without settings, to run an empty
+# command file and exit. The cold start is timed after asking the kernel
+# to drop the data files and the snapshot from the page cache (GNU dd);
+# this needs no privileges but is advisory, so it may be optimistic. The
+# warm starts follow; their median is reported. All times are in
+# milliseconds.
+
+GNUBG=${1:-gnubg}
+DATADIR=${2:-/usr/share/gnubg}
+RUNS=${3:-10}
+
+TMP=`mktemp -d` || exit 1
+trap 'rm -rf "$TMP"' 0
+: > "$TMP/empty"
+
+now() {
+    date +%s%N
+}
+
+evict() {
+    for f in "$DATADIR"/gnubg.wd "$DATADIR"/gnubg.weights "$DATADIR"/met/*.xml "$TMP/gnubg.snap"; do
+        [ -f "$f" ] && dd if="$f" iflag=nocache count=0 2>/dev/null
+    done
+}
+
+start() {
+    t0=`now`
+    "$GNUBG" -t -q -r "$@" -c "$TMP/empty" > /dev/null 2>&1 || exit 1
+    t1=`now`
+    echo $(( (t1 - t0) / 1000000 ))
+}
+
+bench() {
+    evict
+    cold=`start "$@"`
+    warm=`i=0; while [ $i -lt $RUNS ]; do start "$@"; i=$((i + 1)); done | sort -n | \
+        awk '{ a[NR] = $1 } END { print a[int((NR + 1) / 2)] }'`
+    printf "%-10s %8s %8s\n" "$label" "$cold" "$warm"
+}
+
+echo "save snapshot $TMP/gnubg.snap" > "$TMP/save"
+"$GNUBG" -t -q -r -c "$TMP/save" > /dev/null 2>&1
+if [ ! -f "$TMP/gnubg.snap" ]; then
+    echo "$0: $GNUBG could not save a snapshot" >&2
+    exit 1
+fi
+
+printf "%-10s %8s %8s\n" "# start" "cold" "warm"
+label=files; bench --snapshot ""
+label=snapshot; bench --snapshot "$TMP/gnubg.snap"
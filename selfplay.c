@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* Headless computer vs computer games, see selfplay.h for the output */
+
+#include "config.h"
+
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "backgammon.h"
+#include "drawboard.h"
+#include "matchequity.h"
+#include "multithread.h"
+#include "positionid.h"
+#include "selfplay.h"
+#include "lib/simd.h"
+
+typedef struct {
+    FILE *pf;
+    int nGames;
+    unsigned long nSeed;
+    bgvariation bgv;
+    int fCubeUse;
+    int fJacoby;
+    int iNextGame;              /* next game to play */
+    int cGamesDone;
+    int fError;
+} selfplaydata;
+
+/* Returns 1 if the player on roll doubles and is taken, 2 if the double
+ * is passed, 0 if there is no double and -1 on errors */
+
+static int
+CubeAction(ConstTanBoard anBoard, cubeinfo * pci, GString * gs)
+{
+    const player *pp = &ap[pci->fMove];
+    evalcontext ecDH;
+    float aarOutput[2][NUM_ROLLOUT_OUTPUTS], arDouble[4];
+    SSE_ALIGN(float arOutput[NUM_ROLLOUT_OUTPUTS]);
+
+    /* only consider doubling inside the market window, as ComputerTurn */
+    memcpy(&ecDH, &pp->esCube.ec, sizeof(ecDH));
+    ecDH.fCubeful = FALSE;
+    if (ecDH.nPlies)
+        ecDH.nPlies--;
+
+    if (EvaluatePosition(NULL, anBoard, arOutput, pci, &ecDH))
+        return -1;
+
+    if (arOutput[0] < GetDoublePointDeadCube(arOutput, pci))
+        return 0;
+
+    if (GeneralCubeDecisionE(aarOutput, anBoard, pci, &pp->esCube.ec, &pp->esCube) < 0)
+        return -1;
+
+    switch (FindCubeDecision(arDouble, aarOutput, pci)) {
+    case DOUBLE_TAKE:
+    case REDOUBLE_TAKE:
+    case DOUBLE_PASS:
+    case REDOUBLE_PASS:
+    case DOUBLE_BEAVER:
+        break;
+
+    default:
+        return 0;
+    }
+
+    g_string_append(gs, " D");
+
+    /* the opponent decides with its own settings */
+    pp = &ap[!pci->fMove];
+    if (GeneralCubeDecisionE(aarOutput, anBoard, pci, &pp->esCube.ec, &pp->esCube) < 0)
+        return -1;
+
+    switch (FindCubeDecision(arDouble, aarOutput, pci)) {
+    case DOUBLE_PASS:
+    case TOOGOOD_PASS:
+    case REDOUBLE_PASS:
+    case TOOGOODRE_PASS:
+    case OPTIONAL_DOUBLE_PASS:
+    case OPTIONAL_REDOUBLE_PASS:
+        g_string_append(gs, " P");
+        return 2;
+
+    default:
+        g_string_append(gs, " T");
+        return 1;
+    }
+}
+
+/* Plays game iGame and appends its line to gs. Returns -1 on errors. */
+
+static int
+PlayGame(const selfplaydata * psp, int iGame, rngcontext * rngctx, GString * gs)
+{
+    TanBoard anBoard;
+    unsigned int anDice[2];
+    int anScore[2] = { 0, 0 };
+    int nCube = 1, fCubeOwner = -1, fMove, fFirst, fWinner = -1, nPoints = 0, fOpening = TRUE;
+    rng rngx = RNG_MERSENNE;
+    gsize cchHeader;
+
+    InitRNGSeed((unsigned int) (psp->nSeed + (unsigned long) iGame), rngx, rngctx);
+    InitBoard(anBoard, psp->bgv);
+
+    /* the higher die of the opening roll moves first */
+    do
+        if (RollDice(anDice, &rngx, rngctx) < 0)
+            return -1;
+    while (anDice[0] == anDice[1]);
+
+    fMove = fFirst = anDice[1] > anDice[0];
+
+    cchHeader = gs->len;
+
+    while (fWinner < 0) {
+        const player *pp = &ap[fMove];
+        cubeinfo ci;
+        movelist ml;
+        evalcontext ec;
+        int n;
+
+        SetCubeInfo(&ci, nCube, fCubeOwner, fMove, 0, anScore, FALSE, psp->fJacoby, 0, psp->bgv);
+
+        if (!fOpening) {
+            if (psp->fCubeUse && nCube < MAX_CUBE && GetDPEq(NULL, NULL, &ci)) {
+                switch (CubeAction((ConstTanBoard) anBoard, &ci, gs)) {
+                case 2:
+                    fWinner = fMove;
+                    nPoints = nCube;
+                    continue;
+                case 1:
+                    nCube *= 2;
+                    fCubeOwner = !fMove;
+                    SetCubeInfo(&ci, nCube, fCubeOwner, fMove, 0, anScore, FALSE, psp->fJacoby, 0, psp->bgv);
+                    break;
+                case 0:
+                    break;
+                default:
+                    return -1;
+                }
+            }
+
+            if (RollDice(anDice, &rngx, rngctx) < 0)
+                return -1;
+        }
+        fOpening = FALSE;
+
+        g_string_append_printf(gs, " %u%u:", anDice[0], anDice[1]);
+
+        memcpy(&ec, &pp->esChequer.ec, sizeof(ec));
+        if (FindnSaveBestMoves(&ml, (int) anDice[0], (int) anDice[1], (ConstTanBoard) anBoard, NULL, 0.0f, &ci, &ec,
+                               (movefilter(*)[MAX_FILTER_PLIES]) pp->aamf) < 0) {
+            g_free(ml.amMoves);
+            return -1;
+        }
+
+        if (ml.cMoves) {
+            char szMove[FORMATEDMOVESIZE], *pch;
+
+            FormatMovePlain(szMove, (ConstTanBoard) anBoard, ml.amMoves[ml.iMoveBest].anMove);
+            for (pch = szMove; *pch; pch++)
+                if (*pch == ' ')
+                    *pch = ',';
+
+            g_string_append_printf(gs, "%s=%+.3f", szMove, ml.amMoves[ml.iMoveBest].rScore);
+            PositionFromKey(anBoard, &ml.amMoves[ml.iMoveBest].key);
+        }
+
+        g_free(ml.amMoves);
+
+        if ((n = GameStatus((ConstTanBoard) anBoard, psp->bgv)) != 0) {
+            /* the Jacoby rule: no gammons with a centred cube */
+            if (psp->fJacoby && fCubeOwner == -1)
+                n = 1;
+
+            fWinner = fMove;
+            nPoints = n * nCube;
+        }
+
+        SwapSides(anBoard);
+        fMove = !fMove;
+    }
+
+    {
+        char *sz = g_strdup_printf("%d %d %d %d", iGame, fFirst, fWinner, nPoints);
+
+        g_string_insert(gs, (gssize) cchHeader, sz);
+        g_free(sz);
+    }
+    g_string_append_c(gs, '\n');
+
+    return 0;
+}
+
+static void
+SelfPlayGames(void *p)
+{
+    selfplaydata *psp = p;
+    rngcontext *rngctx = CopyRNGContext(rngctxRollout);
+    GString *gs = g_string_new(NULL);
+    int iGame;
+
+    while (!fInterrupt && !psp->fError && (iGame = MT_SafeIncValue(&psp->iNextGame) - 1) < psp->nGames) {
+        g_string_truncate(gs, 0);
+
+        if (PlayGame(psp, iGame, rngctx, gs) < 0) {
+            /* an interrupted game is not written */
+            if (!fInterrupt)
+                psp->fError = TRUE;
+            break;
+        }
+
+        MT_Exclusive();
+        if (fputs(gs->str, psp->pf) < 0)
+            psp->fError = TRUE;
+        MT_Release();
+
+        MT_SafeInc(&psp->cGamesDone);
+    }
+
+    g_string_free(gs, TRUE);
+    g_free(rngctx);
+}
+
+static selfplaydata *pspProgress;
+
+static gboolean
+SelfPlayProgress(gpointer UNUSED(unused))
+{
+    if (fShowProgress && pspProgress) {
+        outputf("\r");
+        outputf(_("%d of %d games played"), MT_SafeGet(&pspProgress->cGamesDone), pspProgress->nGames);
+        fflush(stdout);
+    }
+
+    return TRUE;
+}
+
+extern int
+SelfPlay(unsigned int nGames, const char *szFile, unsigned long nSeed)
+{
+    selfplaydata sp;
+    unsigned int i;
+
+    for (i = 0; i < 2; i++)
+        if (ap[i].esChequer.et != EVAL_EVAL || ap[i].esCube.et != EVAL_EVAL) {
+            outputl(_("Self-play needs evaluations, not rollouts, for the chequer play "
+                      "and cube decisions of both players."));
+            return -1;
+        }
+
+    if ((sp.pf = g_fopen(szFile, "a")) == NULL) {
+        outputerr(szFile);
+        return -1;
+    }
+
+    sp.nGames = (int) nGames;
+    sp.nSeed = nSeed;
+    sp.bgv = bgvDefault;
+    sp.fCubeUse = fCubeUse;
+    sp.fJacoby = fJacoby;
+    sp.iNextGame = 0;
+    sp.cGamesDone = 0;
+    sp.fError = FALSE;
+
+    pspProgress = &sp;
+    mt_add_tasks(MT_GetNumThreads(), SelfPlayGames, &sp, NULL);
+    (void) MT_WaitForTasks(SelfPlayProgress, 1000, FALSE);
+    pspProgress = NULL;
+
+    if (fShowProgress)
+        outputf("\r");
+
+    if (fclose(sp.pf) || sp.fError) {
+        outputerr(szFile);
+        return -1;
+    }
+
+    return sp.cGamesDone;
+}
+
+extern void
+CommandSelfPlay(char *sz)
+{
+    int n, cGames;
+    char *szFile, *pch;
+    unsigned long nSeed;
+
+    if ((n = ParseNumber(&sz)) < 1) {
+        outputl(_("You must specify how many games to play (see `help selfplay')."));
+        return;
+    }
+
+    if (!(szFile = NextToken(&sz)) || !*szFile) {
+        outputl(_("You must specify a file to write the games to (see `help selfplay')."));
+        return;
+    }
+
+    if ((pch = NextToken(&sz)) != NULL)
+        nSeed = strtoul(pch, NULL, 10);
+    else
+        nSeed = (unsigned long) time(NULL);
+
+    if ((cGames = SelfPlay((unsigned int) n, szFile, nSeed)) < 0)
+        return;
+
+    outputf(ngettext("%d game (seed %lu) appended to %s.\n", "%d games (seed %lu) appended to %s.\n", cGames),
+            cGames, nSeed, szFile);
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+#ifndef SELFPLAY_H
+#define SELFPLAY_H
+
+/* Games played by "selfplay".
+ *
+ * The games are played without a match state or move records, many at a
+ * time on the thread pool. Player 0 and 1 use the chequer play, cube
+ * decision and move filter settings of "set player 0/1". Every game is a
+ * money game from the initial position with the current cube, Jacoby and
+ * variation settings, and game i is played with the dice of a Mersenne
+ * Twister seeded with seed + i, so it can be replayed.
+ *
+ * The games are appended to the file as they finish, one line each:
+ *
+ *   <game> <first player> <winner> <points> <action> ...
+ *
+ * The actions alternate between the players, starting with the first
+ * player. An action is
+ *
+ *   <dice>:<move>=<equity>   a roll and the move played, for example
+ *                            "31:8/5,6/5=+0.153" (an empty move if the
+ *                            player could not move)
+ *   D, T or P                a double and the take or pass that follows
+ *
+ * and the equity is the evaluation of the move from the mover's side. */
+
+/* Plays nGames games into szFile, returns the number of games played or
+ * -1 on errors */
+extern int SelfPlay(unsigned int nGames, const char *szFile, unsigned long nSeed);
+
+#endif
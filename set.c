@@ -55,6 +55,7 @@
 #include <unistd.h>
 #endif                          /* HAVE_UNISTD_H */
 
+#include "anytime.h"
 #include "backgammon.h"
 #include "dice.h"
 #include "eval.h"
@@ -83,6 +84,7 @@
 #include "inc3d.h"
 #endif
 #include "multithread.h"
+#include "rolloutremote.h"
 
 static int iPlayerSet, iPlayerLateSet;
 
@@ -1090,7 +1092,7 @@ CommandSetEvalPlies(char *sz)
 
     int n = ParseNumber(&sz);
 
-    if (n < 0 || n > 7)
+    if (n < 0 || n > MAX_PLIES)
         outputf(_("Valid numbers of plies to look ahead are 0 to 7.\n"));
     else
         pecSet->nPlies = n;
@@ -1765,6 +1767,19 @@ CommandSetRolloutLogFile(char *sz)
     log_file_name = g_strdup(sz);
 }
 
+extern void
+CommandSetRolloutWorkers(char *sz)
+{
+    g_free(szRolloutWorkers);
+    szRolloutWorkers = NULL;
+
+    if (sz && *sz) {
+        szRolloutWorkers = g_strdup(sz);
+        outputf(_("Rollouts will be shared with the workers on %s.\n"), szRolloutWorkers);
+    } else
+        outputl(_("Rollouts will only use this process."));
+}
+
 extern void
 CommandSetRolloutLateEnable(char *sz)
 {
@@ -2632,6 +2647,24 @@ SetTurn(int i)
     return;
 }
 
+extern void
+CommandSetTimeBudget(char *sz)
+{
+    float r = ParseReal(&sz);
+
+    if (r < 0.0f) {
+        outputl(_("You must specify the number of seconds per decision (see `help set timebudget')."));
+        return;
+    }
+
+    rTimeBudget = r;
+
+    if (rTimeBudget > 0.0f)
+        outputf(_("The computer will take up to %.3g seconds per decision.\n"), rTimeBudget);
+    else
+        outputl(_("The computer will not limit the time it takes per decision."));
+}
+
 extern void
 CommandSetTurn(char *sz)
 {
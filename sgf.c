@@ -39,17 +39,14 @@
 #include "positionid.h"
 #include "sgf.h"
 
-static const char *szFile;
-static int fError;
-
 static int CheckSGFVersion(char **sz);
 static void
-ErrorHandler(const char *sz, int UNUSED(fParseError))
+ErrorHandler(sgfcontext * psc, const char *sz, int UNUSED(fParseError))
 {
 
-    if (!fError) {
-        fError = TRUE;
-        outputerrf("%s: %s", szFile, sz);
+    if (!psc->fError) {
+        psc->fError = TRUE;
+        outputerrf("%s: %s", psc->szFile, sz);
     }
 }
 
@@ -92,50 +89,79 @@ FreeGameTreeSeq(listOLD * pl)
     FreeList(pl, 0);
 }
 
+extern void
+SGFFree(listOLD * plCollection)
+{
+    FreeGameTreeSeq(plCollection);
+}
+
+/* Parse the SGF file sz (or stdin for "-") with the handlers of psc */
+
 static listOLD *
-LoadCollection(char *sz)
+ParseFile(char *sz, sgfcontext * psc)
 {
 
-    listOLD *plCollection, *pl, *plRoot, *plProp;
+    listOLD *plCollection;
     FILE *pf;
 
-    fError = FALSE;
-    SGFErrorHandler = ErrorHandler;
+    psc->ErrorHandler = ErrorHandler;
+    psc->fError = FALSE;
 
     if (strcmp(sz, "-")) {
         if (!(pf = g_fopen(sz, "r"))) {
             outputerr(sz);
             return NULL;
         }
-        szFile = sz;
+        psc->szFile = sz;
     } else {
         /* FIXME does it really make sense to try to load from stdin? */
         pf = stdin;
-        szFile = "(stdin)";
+        psc->szFile = "(stdin)";
     }
 
-    plCollection = SGFParse(pf);
+    plCollection = SGFParseContext(psc, pf);
 
     if (pf != stdin)
         fclose(pf);
 
+    return plCollection;
+}
+
+static int
+IsBackgammonGameTree(listOLD * plGameTree)
+{
+
+    listOLD *plRoot, *plProp;
+
+    plRoot = ((listOLD *) plGameTree->plNext->p)->plNext->p;
+
+    for (plProp = plRoot->plNext; plProp != plRoot; plProp = plProp->plNext) {
+        property *pp = plProp->p;
+
+        if (pp->ach[0] == 'G' && pp->ach[1] == 'M' && pp->pl->plNext->p && atoi((char *)
+                                                                                pp->pl->plNext->p) == 6)
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+static listOLD *
+LoadCollection(char *sz)
+{
+
+    listOLD *plCollection, *pl;
+    sgfcontext sc;
+
+    memset(&sc, 0, sizeof(sc));
+
+    plCollection = ParseFile(sz, &sc);
+
     /* Traverse collection, looking for backgammon games. */
     if (plCollection) {
         pl = plCollection->plNext;
         while (pl != plCollection) {
-            int fBackgammon = FALSE;
-
-            plRoot = ((listOLD *) ((listOLD *) pl->p)->plNext->p)->plNext->p;
-
-            for (plProp = plRoot->plNext; plProp != plRoot; plProp = plProp->plNext) {
-                property *pp = plProp->p;
-
-                if (pp->ach[0] == 'G' && pp->ach[1] == 'M' && pp->pl->plNext->p && atoi((char *)
-                                                                                        pp->pl->plNext->p) == 6) {
-                    fBackgammon = TRUE;
-                    break;
-                }
-            }
+            int fBackgammon = IsBackgammonGameTree(pl->p);
 
             pl = pl->plNext;
 
@@ -146,7 +172,7 @@ LoadCollection(char *sz)
         }
 
         if (ListEmpty(plCollection)) {
-            ErrorHandler(_("warning: no backgammon games in SGF file"), TRUE);
+            ErrorHandler(&sc, _("warning: no backgammon games in SGF file"), TRUE);
             free(plCollection);
             plCollection = NULL;
         }
@@ -1511,10 +1537,30 @@ CommandLoadPosition(char *sz)
 }
 
 
+/* Collect the backgammon games of a match file as they are parsed; the
+ * other game trees are freed right away */
+
+static int
+LoadMatchGameTree(sgfcontext * psc, listOLD * plGameTree)
+{
+
+    listOLD *plGames = psc->pUserData;
+
+    if (IsBackgammonGameTree(plGameTree))
+        ListInsert(plGames, plGameTree);
+    else
+        FreeList(plGameTree, 1);
+
+    return 0;
+}
+
 extern void
 CommandLoadMatch(char *sz)
 {
     listOLD *pl;
+    listOLD *plGames;
+    sgfcontext sc;
+    int nGames = 0;
 
     sz = NextToken(&sz);
 
@@ -1523,29 +1569,54 @@ CommandLoadMatch(char *sz)
         return;
     }
 
-    if ((pl = LoadCollection(sz))) {
-        int nGames = 0, nMoves = 0;
+    memset(&sc, 0, sizeof(sc));
+    plGames = g_malloc(sizeof(listOLD));
+    ListCreate(plGames);
+    sc.GameTreeHandler = LoadMatchGameTree;
+    sc.pUserData = plGames;
 
-        /* FIXME make sure the root nodes have MI properties; if not,
-         * we're loading a session. */
-        if (!get_input_discard())
-            return;
+    /* the current match is only replaced once the whole file is parsed */
+    if (!(pl = ParseFile(sz, &sc))) {
+        FreeGameTreeSeq(plGames);
+        return;
+    }
+
+    FreeGameTreeSeq(pl);
+
+    if (ListEmpty(plGames)) {
+        ErrorHandler(&sc, _("warning: no backgammon games in SGF file"), TRUE);
+        FreeGameTreeSeq(plGames);
+        return;
+    }
+
+    /* FIXME make sure the root nodes have MI properties; if not,
+     * we're loading a session. */
+    if (!get_input_discard()) {
+        FreeGameTreeSeq(plGames);
+        return;
+    }
 #if USE_GTK
-        if (fX) {               /* Clear record to avoid ugly updates */
-            GTKClearMoveRecord();
-            GTKFreeze();
-        }
+    if (fX) {                   /* Clear record to avoid ugly updates */
+        GTKClearMoveRecord();
+        GTKFreeze();
+    }
 #endif
 
-        FreeMatch();
-        ClearMatch();
+    FreeMatch();
+    ClearMatch();
 
-        for (pl = pl->plNext; pl->p; pl = pl->plNext) {
-            RestoreGame(pl->p);
-            nGames++;
-        }
+    /* restore the games in order, freeing each as soon as it is done */
+    while (!ListEmpty(plGames)) {
+        RestoreGame(plGames->plNext->p);
+        FreeList(plGames->plNext->p, 1);
+        ListDelete(plGames->plNext);
+        nGames++;
+    }
 
-        FreeGameTreeSeq(pl);
+    FreeGameTreeSeq(plGames);
+
+    {
+        int nMoves = 0;
 
         UpdateSettings();
 
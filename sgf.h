@@ -31,6 +31,25 @@ typedef struct {
 
 extern void (*SGFErrorHandler) (const char *szMessage, int fParseError);
 
+/* State of one parse. Parses with different contexts are independent and
+ * may run concurrently. */
+typedef struct sgfcontext {
+    /* flex scanner, set while parsing */
+    void *scanner;
+    /* called on errors (if set), or complain to stderr (otherwise) */
+    void (*ErrorHandler) (struct sgfcontext *, const char *szMessage, int fParseError);
+    /* if set, each game tree of the collection is handed over to it as
+     * soon as it is parsed instead of being kept in the collection; it
+     * returns non zero to stop parsing */
+    int (*GameTreeHandler) (struct sgfcontext *, listOLD * plGameTree);
+    /* for the use of the handlers */
+    const char *szFile;
+    int fError;
+    void *pUserData;
+    /* result */
+    listOLD *plCollection;
+} sgfcontext;
+
 /* Parse an SGF file, and return a syntax tree.  The tree is saved as a list
  * of game trees; each game tree is a list where the first element is the
  * initial sequence of SGF nodes and any other elements are alternate
@@ -43,6 +62,14 @@ extern void (*SGFErrorHandler) (const char *szMessage, int fParseError);
  * (if set), or complains to stderr (otherwise). */
 extern listOLD *SGFParse(FILE * pf);
 
+/* As SGFParse, reporting errors and game trees to the handlers of psc.
+ * With a GameTreeHandler the collection returned is empty. */
+extern listOLD *SGFParseContext(sgfcontext * psc, FILE * pf);
+extern int SGFStartParse(sgfcontext * psc, FILE * pf);
+
+/* Frees a collection returned by SGFParse */
+extern void SGFFree(listOLD * plCollection);
+
 /* The following properties are defined for GNU Backgammon SGF files:
  * 
  * A  (M)  - analysis (gnubg private)
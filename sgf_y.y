@@ -34,18 +34,18 @@
 extern char *stpcpy(char *s1, const char *s2);
 #endif
 
-static listOLD *plCollection;    
-    
-extern int sgflex( void );
-
 #define YYERROR_VERBOSE
 
+#define sgfctx sgfget_extra(scanner)
+
+extern sgfcontext *sgfget_extra( void *yyscanner );
+
 void ( *SGFErrorHandler )( const char *, int ) = NULL;
  
-static int sgferror( const char *s ) {
+static int sgferror( void *scanner, const char *s ) {
 
-    if( SGFErrorHandler )
-	SGFErrorHandler( s, 1 );
+    if( sgfctx->ErrorHandler )
+	sgfctx->ErrorHandler( sgfctx, s, 1 );
     else
 	fprintf( stderr, "%s\n", s );
     
@@ -86,6 +86,9 @@ static char *Concatenate( listOLD *pl ) {
 %}
 
 %name-prefix "sgf"
+%define api.pure
+%lex-param   {void *scanner}
+%parse-param {void *scanner}
 
 /* There are 2 shift/reduce conflicts caused by ambiguities at which level
    error handling should be performed (GameTreeSeq, Sequence, and
@@ -99,18 +102,39 @@ static char *Concatenate( listOLD *pl ) {
     listOLD *pl; /* nodes, sequences, gametrees */
 }
 
+%{
+extern int sgflex( YYSTYPE *yylval_param, void *yyscanner );
+%}
+
 %token <ach> PROPERTY <pch> VALUETEXT
 
 %type <pp> Property
 %type <pch> Value
-%type <pl> Collection GameTreeSeq GameTree Sequence Node PropertySeq ValueSeq
-%type <pl> ValueCharSeq
+%type <pl> Collection TopGameTreeSeq GameTreeSeq GameTree Sequence Node
+%type <pl> PropertySeq ValueSeq ValueCharSeq
 
 %%
 		/* The specification says empty collections are illegal, but
 		   we'll try to be accommodating. */
-Collection:	GameTreeSeq
-		{ $$ = plCollection = $1; }
+Collection:	TopGameTreeSeq
+		{ $$ = sgfctx->plCollection = $1; }
+	;
+
+		/* As GameTreeSeq, but the game trees may be handed over
+		   one at a time instead of being collected. */
+TopGameTreeSeq:	/* empty */
+		{ $$ = NewList(); }
+	|	TopGameTreeSeq GameTree
+		{
+		    $$ = $1;
+		    if( !sgfctx->GameTreeHandler )
+			ListInsert( $1, $2 );
+		    else if( sgfctx->GameTreeHandler( sgfctx, $2 ) ) {
+			sgfctx->plCollection = $1;
+			YYACCEPT;
+		    }
+		}
+	|	TopGameTreeSeq error
 	;
 
 GameTreeSeq:	/* empty */
@@ -170,16 +194,33 @@ ValueCharSeq:	/* empty */
 
 %%
 
-extern FILE *sgfin;
+extern listOLD *SGFParseContext( sgfcontext *psc, FILE *pf ) {
+
+    psc->plCollection = NULL;
+
+    if( SGFStartParse( psc, pf ) < 0 )
+	return NULL;
+
+    return psc->plCollection;
+}
+
+static void ForwardError( sgfcontext *UNUSED(psc), const char *s,
+			  int fParseError ) {
+
+    if( SGFErrorHandler )
+	SGFErrorHandler( s, fParseError );
+    else
+	fprintf( stderr, "%s\n", s );
+}
+
 extern listOLD *SGFParse( FILE *pf ) {
 
-    
-    sgfin = pf;
-    plCollection = NULL;
+    sgfcontext sc;
 
-    sgfparse();
+    memset( &sc, 0, sizeof( sc ) );
+    sc.ErrorHandler = ForwardError;
 
-    return plCollection;
+    return SGFParseContext( &sc, pf );
 }
 	
 #ifdef SGFTEST
@@ -30,8 +30,10 @@
 #include <ctype.h>
 #include <math.h>
 
+#include "anytime.h"
 #include "backgammon.h"
 #include "drawboard.h"
+#include "enginestats.h"
 #include "eval.h"
 #include "export.h"
 #include "format.h"
@@ -46,6 +48,7 @@
 #include "util.h"
 #include "openurl.h"
 #include "multithread.h"
+#include "rolloutremote.h"
 
 #if defined(USE_GTK)
 #include "gtkboard.h"
@@ -552,6 +555,82 @@ CommandShowCache(char *UNUSED(sz))
 }
 #endif
 
+static void
+ShowTimer(const char *sz, guint64 nTicks, double rTickRate, guint64 nOps)
+{
+    double rSeconds;
+
+    if (rTickRate <= 0.0) {
+        outputf("%-34s %12s\n", sz, "-");
+        return;
+    }
+
+    rSeconds = (double) nTicks / rTickRate;
+
+    if (nOps)
+        outputf("%-34s %12.3f s %10.3f us/call\n", sz, rSeconds, rSeconds * 1e6 / (double) nOps);
+    else
+        outputf("%-34s %12.3f s\n", sz, rSeconds);
+}
+
+extern void
+CommandShowStatisticsEngine(char *UNUSED(sz))
+{
+    enginestats es;
+    double rTickRate;
+    guint64 cEvals;
+    int i;
+
+    if (!EngineStatsTotal(&es, &rTickRate)) {
+        outputl(_("This installation of GNU Backgammon was compiled without\n"
+                  "engine statistics (configure with --enable-engine-stats)."));
+        return;
+    }
+
+    cEvals = es.an[ESC_EVAL_CONTACT] + es.an[ESC_EVAL_CRASHED] + es.an[ESC_EVAL_RACE] + es.an[ESC_EVAL_BEAROFF];
+
+    outputl(_("Static evaluations:"));
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("contact"), es.an[ESC_EVAL_CONTACT]);
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("crashed"), es.an[ESC_EVAL_CRASHED]);
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("race"), es.an[ESC_EVAL_RACE]);
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("bearoff databases"), es.an[ESC_EVAL_BEAROFF]);
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("one-sided rollouts"), es.an[ESC_EVAL_OSR]);
+    outputf("  %-32s %12" G_GUINT64_FORMAT " (%" G_GUINT64_FORMAT " %s)\n", _("pruning net"),
+            es.an[ESC_EVAL_PRUNE], es.an[ESC_PRUNE_CACHE_HIT], _("cached"));
+
+    outputl(_("Move generation:"));
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("calls"), es.an[ESC_GENERATE]);
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("moves generated"), es.an[ESC_MOVES]);
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("moves ranked by the pruning net"), es.an[ESC_PRUNE_MOVES]);
+    outputf("  %-32s %12" G_GUINT64_FORMAT "\n", _("moves pruned"),
+            es.an[ESC_PRUNE_MOVES] - es.an[ESC_PRUNE_KEPT]);
+
+    outputl(_("Evaluation cache (lookups, hit rate):"));
+    for (i = 0; i < ENGINE_STATS_PLIES; i++) {
+        char *szPly = g_strdup_printf(i < ENGINE_STATS_PLIES - 1 ? _("%d-ply") : _("%d-ply and more"), i);
+
+        if (es.anCacheLookup[i])
+            outputf("  %-32s %12" G_GUINT64_FORMAT " %5.1f%%\n", szPly, es.anCacheLookup[i],
+                    100.0 * (double) es.anCacheHit[i] / (double) es.anCacheLookup[i]);
+        else
+            outputf("  %-32s %12d\n", szPly, 0);
+
+        g_free(szPly);
+    }
+
+    outputl(_("Time spent in:"));
+    ShowTimer(_("  static evaluations"), es.anTicks[EST_EVAL], rTickRate, cEvals);
+    ShowTimer(_("  move generation"), es.anTicks[EST_GENERATE], rTickRate, es.an[ESC_GENERATE]);
+    ShowTimer(_("  waiting for exclusive access"), es.anTicks[EST_EXCLUSIVE], rTickRate, es.an[ESC_EXCLUSIVE]);
+}
+
+extern void
+CommandClearEngine(char *UNUSED(sz))
+{
+    EngineStatsReset();
+    outputl(_("Engine statistics reset."));
+}
+
 extern void
 CommandShowCalibration(char *UNUSED(sz))
 {
@@ -893,6 +972,9 @@ CommandShowRollout(char *UNUSED(sz))
     outputl(_("`rollout' will use:"));
     ShowRollout(&rcRollout);
 
+    if (szRolloutWorkers)
+        outputf(_("Rollouts are shared with the workers on %s.\n"), szRolloutWorkers);
+
 }
 
 extern void
@@ -925,6 +1007,15 @@ CommandShowSeed(char *UNUSED(sz))
     PrintRNGCounter(rngCurrent, rngctxCurrent);
 }
 
+extern void
+CommandShowTimeBudget(char *UNUSED(sz))
+{
+    if (rTimeBudget > 0.0f)
+        outputf(_("The computer takes up to %.3g seconds per decision.\n"), rTimeBudget);
+    else
+        outputl(_("The computer does not limit the time it takes per decision."));
+}
+
 extern void
 CommandShowTurn(char *UNUSED(sz))
 {
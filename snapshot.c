@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* Start-up snapshots, see snapshot.h */
+
+#include "config.h"
+
+#include <glib.h>
+#include <glib/gi18n.h>
+#include <string.h>
+
+#include "eval.h"
+#include "snapshot.h"
+
+#define SNAPSHOT_MAGIC "GNUBGSNP"
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_BYTE_ORDER 0x01020304
+
+/* The file starts with the header; the blocks follow, each at a multiple
+ * of SNAPSHOT_ALIGN. A block that is not present has size 0. */
+typedef struct {
+    char szMagic[8];
+    guint32 nVersion;
+    guint32 nByteOrder;         /* SNAPSHOT_BYTE_ORDER as written */
+    guint32 cbInt;
+    guint32 cbFloat;
+    char szWeightsVersion[16];
+    guint64 aiOffset[N_SNAP_BLOCKS];
+    guint64 acb[N_SNAP_BLOCKS];
+} snapshotheader;
+
+/* The start of a net block; the hidden weights, the output weights, the
+ * hidden thresholds and the output thresholds follow, each padded */
+typedef struct {
+    guint32 cInput;
+    guint32 cHidden;
+    guint32 cOutput;
+    float rBetaHidden;
+    float rBetaOutput;
+} snapshotnet;
+
+struct snapshotwriter {
+    GByteArray *apb[N_SNAP_BLOCKS];
+};
+
+static GMappedFile *pmfSnapshot;
+static const snapshotheader *pshSnapshot;
+static char *szSnapshot;
+
+static void
+MappedFileFree(GMappedFile * pmf)
+{
+#if GLIB_CHECK_VERSION(2,22,0)
+    g_mapped_file_unref(pmf);
+#else
+    g_mapped_file_free(pmf);
+#endif
+}
+
+static int
+SnapshotValid(const snapshotheader * psh, gsize cb)
+{
+    int i;
+
+    if (cb < sizeof(snapshotheader) || memcmp(psh->szMagic, SNAPSHOT_MAGIC, sizeof(psh->szMagic)) ||
+        psh->nVersion != SNAPSHOT_VERSION || psh->nByteOrder != SNAPSHOT_BYTE_ORDER ||
+        psh->cbInt != sizeof(int) || psh->cbFloat != sizeof(float))
+        return FALSE;
+
+    if (strncmp(psh->szWeightsVersion, WEIGHTS_VERSION, sizeof(psh->szWeightsVersion)))
+        return FALSE;
+
+    for (i = 0; i < N_SNAP_BLOCKS; i++)
+        if (psh->acb[i] && (psh->aiOffset[i] % SNAPSHOT_ALIGN || psh->aiOffset[i] < sizeof(snapshotheader) ||
+                            psh->aiOffset[i] > cb || psh->acb[i] > cb - psh->aiOffset[i]))
+            return FALSE;
+
+    return TRUE;
+}
+
+extern int
+SnapshotOpen(const char *szFilename)
+{
+    GMappedFile *pmf;
+    GError *pError = NULL;
+    const snapshotheader *psh;
+
+    /* the nets of the first snapshot may be in use */
+    g_return_val_if_fail(pmfSnapshot == NULL, FALSE);
+
+    if (!g_file_test(szFilename, G_FILE_TEST_EXISTS))
+        return FALSE;
+
+    if (!(pmf = g_mapped_file_new(szFilename, FALSE, &pError))) {
+        g_printerr(_("%s: Failed to map snapshot: %s\n"), szFilename, pError->message);
+        g_error_free(pError);
+        return FALSE;
+    }
+
+    psh = (const snapshotheader *) g_mapped_file_get_contents(pmf);
+
+    if (!psh || !SnapshotValid(psh, g_mapped_file_get_length(pmf))) {
+        g_printerr(_("%s: Not a snapshot for this version of GNU Backgammon\n"), szFilename);
+        MappedFileFree(pmf);
+        return FALSE;
+    }
+
+    pmfSnapshot = pmf;
+    pshSnapshot = psh;
+    szSnapshot = g_strdup(szFilename);
+
+    return TRUE;
+}
+
+extern const char *
+SnapshotFilename(void)
+{
+    return szSnapshot;
+}
+
+extern const void *
+SnapshotBlock(snapblock id, gsize * pcb)
+{
+    if (!pshSnapshot || !pshSnapshot->acb[id]) {
+        *pcb = 0;
+        return NULL;
+    }
+
+    *pcb = (gsize) pshSnapshot->acb[id];
+
+    return (const char *) pshSnapshot + pshSnapshot->aiOffset[id];
+}
+
+extern int
+SnapshotNet(snapblock id, neuralnet * pnn, unsigned int cInput, unsigned int cOutput)
+{
+    gsize cb;
+    guint64 acb[4];
+    const char *pch = SnapshotBlock(id, &cb);
+    const snapshotnet *psn = (const snapshotnet *) pch;
+    float **aar[4];
+    int i;
+
+    if (!pch || cb < sizeof(snapshotnet))
+        return -1;
+
+    if (psn->cInput != cInput || psn->cOutput != cOutput || psn->cHidden < 1)
+        return -1;
+
+    /* in 64 bits, so that a damaged cHidden cannot wrap around */
+    acb[0] = (guint64) psn->cInput * psn->cHidden * sizeof(float);
+    acb[1] = (guint64) psn->cHidden * psn->cOutput * sizeof(float);
+    acb[2] = (guint64) psn->cHidden * sizeof(float);
+    acb[3] = (guint64) psn->cOutput * sizeof(float);
+
+    if (SNAPSHOT_PAD(sizeof(snapshotnet)) + SNAPSHOT_PAD(acb[0]) + SNAPSHOT_PAD(acb[1]) +
+        SNAPSHOT_PAD(acb[2]) + SNAPSHOT_PAD(acb[3]) > (guint64) cb)
+        return -1;
+
+    pnn->cInput = psn->cInput;
+    pnn->cHidden = psn->cHidden;
+    pnn->cOutput = psn->cOutput;
+    pnn->nTrained = 1;
+    pnn->rBetaHidden = psn->rBetaHidden;
+    pnn->rBetaOutput = psn->rBetaOutput;
+
+    aar[0] = &pnn->arHiddenWeight;
+    aar[1] = &pnn->arOutputWeight;
+    aar[2] = &pnn->arHiddenThreshold;
+    aar[3] = &pnn->arOutputThreshold;
+
+    pch += SNAPSHOT_PAD(sizeof(snapshotnet));
+    for (i = 0; i < 4; i++) {
+        /* read-only: the mapping is shared */
+        *aar[i] = (float *) pch;
+        pch += SNAPSHOT_PAD(acb[i]);
+    }
+
+    return 0;
+}
+
+extern snapshotwriter *
+SnapshotWriterNew(void)
+{
+    return g_new0(snapshotwriter, 1);
+}
+
+extern void
+SnapshotWriterAdd(snapshotwriter * psw, snapblock id, const void *p, gsize cb)
+{
+    static const guint8 abZero[SNAPSHOT_ALIGN];
+
+    if (!psw->apb[id])
+        psw->apb[id] = g_byte_array_new();
+
+    g_byte_array_append(psw->apb[id], p, (guint) cb);
+    g_byte_array_append(psw->apb[id], abZero, (guint) (SNAPSHOT_PAD(cb) - cb));
+}
+
+extern void
+SnapshotWriterAddNet(snapshotwriter * psw, snapblock id, const neuralnet * pnn)
+{
+    snapshotnet sn;
+
+    memset(&sn, 0, sizeof(sn));
+    sn.cInput = pnn->cInput;
+    sn.cHidden = pnn->cHidden;
+    sn.cOutput = pnn->cOutput;
+    sn.rBetaHidden = pnn->rBetaHidden;
+    sn.rBetaOutput = pnn->rBetaOutput;
+
+    SnapshotWriterAdd(psw, id, &sn, sizeof(sn));
+    SnapshotWriterAdd(psw, id, pnn->arHiddenWeight, pnn->cInput * pnn->cHidden * sizeof(float));
+    SnapshotWriterAdd(psw, id, pnn->arOutputWeight, pnn->cHidden * pnn->cOutput * sizeof(float));
+    SnapshotWriterAdd(psw, id, pnn->arHiddenThreshold, pnn->cHidden * sizeof(float));
+    SnapshotWriterAdd(psw, id, pnn->arOutputThreshold, pnn->cOutput * sizeof(float));
+}
+
+extern int
+SnapshotWriterSave(snapshotwriter * psw, const char *szFilename, GError ** ppError)
+{
+    GByteArray *pb = g_byte_array_new();
+    snapshotheader sh;
+    gsize cb = SNAPSHOT_PAD(sizeof(sh));
+    int i, fOK;
+
+    memset(&sh, 0, sizeof(sh));
+    memcpy(sh.szMagic, SNAPSHOT_MAGIC, sizeof(sh.szMagic));
+    sh.nVersion = SNAPSHOT_VERSION;
+    sh.nByteOrder = SNAPSHOT_BYTE_ORDER;
+    sh.cbInt = sizeof(int);
+    sh.cbFloat = sizeof(float);
+    g_strlcpy(sh.szWeightsVersion, WEIGHTS_VERSION, sizeof(sh.szWeightsVersion));
+
+    for (i = 0; i < N_SNAP_BLOCKS; i++)
+        if (psw->apb[i]) {
+            sh.aiOffset[i] = cb;
+            sh.acb[i] = psw->apb[i]->len;
+            cb += psw->apb[i]->len;
+        }
+
+    g_byte_array_append(pb, (const guint8 *) &sh, sizeof(sh));
+    g_byte_array_set_size(pb, (guint) SNAPSHOT_PAD(sizeof(sh)));
+    memset(pb->data + sizeof(sh), 0, pb->len - sizeof(sh));
+
+    for (i = 0; i < N_SNAP_BLOCKS; i++)
+        if (psw->apb[i]) {
+            g_byte_array_append(pb, psw->apb[i]->data, psw->apb[i]->len);
+            g_byte_array_free(psw->apb[i], TRUE);
+        }
+
+    g_free(psw);
+
+    /* written to a temporary file and renamed */
+    fOK = g_file_set_contents(szFilename, (const gchar *) pb->data, (gssize) pb->len, ppError);
+    g_byte_array_free(pb, TRUE);
+
+    return fOK ? 0 : -1;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <glib.h>
+
+#include "lib/neuralnet.h"
+
+/* Engine state saved ready to use ("save snapshot").
+ *
+ * A snapshot holds what every gnubg process otherwise loads, parses or
+ * computes when it starts: the neural nets, the escape tables and the
+ * match equity table with its gammon prices. The file is mapped
+ * read-only, so the processes using the same snapshot share its pages in
+ * the page cache, and the nets are evaluated in place. Every block starts
+ * at a multiple of SNAPSHOT_ALIGN bytes, as the SIMD evaluation needs.
+ *
+ * A snapshot is only used by machines with the same byte order and type
+ * sizes and with the weights version that wrote it. The nets and the match
+ * equity table are only used while the files they were read from are
+ * unchanged. Otherwise (and for the blocks it does not have) the state is
+ * loaded as usual. Snapshots
+ * are replaced, never rewritten in place, so that the processes that have
+ * the old one mapped are not disturbed. */
+
+#define SNAPSHOT_ALIGN 64
+
+/* cb rounded up to a multiple of SNAPSHOT_ALIGN */
+#define SNAPSHOT_PAD(cb) (((cb) + SNAPSHOT_ALIGN - 1) & ~(guint64) (SNAPSHOT_ALIGN - 1))
+
+typedef enum {
+    SNAP_NET_CONTACT,
+    SNAP_NET_RACE,
+    SNAP_NET_CRASHED,
+    SNAP_NET_PCONTACT,
+    SNAP_NET_PRACE,
+    SNAP_NET_PCRASHED,
+    SNAP_WEIGHTS,
+    SNAP_ESCAPES,
+    SNAP_MET,
+    N_SNAP_BLOCKS
+} snapblock;
+
+typedef struct snapshotwriter snapshotwriter;
+
+/* Maps szFilename as the snapshot of this process. Returns FALSE,
+ * quietly if the file does not exist, if it cannot be used. */
+extern int SnapshotOpen(const char *szFilename);
+
+/* The file name of the snapshot in use, or NULL */
+extern const char *SnapshotFilename(void);
+
+/* The contents of block id and their size, or NULL if the snapshot in use
+ * does not have it */
+extern const void *SnapshotBlock(snapblock id, gsize * pcb);
+
+/* Points pnn into block id; the weights must not be modified. Returns -1
+ * if there is no such net or if it does not have cInput inputs and
+ * cOutput outputs. */
+extern int SnapshotNet(snapblock id, neuralnet * pnn, unsigned int cInput, unsigned int cOutput);
+
+extern snapshotwriter *SnapshotWriterNew(void);
+
+/* Appends cb bytes to block id, padded to SNAPSHOT_ALIGN */
+extern void SnapshotWriterAdd(snapshotwriter * psw, snapblock id, const void *p, gsize cb);
+
+extern void SnapshotWriterAddNet(snapshotwriter * psw, snapblock id, const neuralnet * pnn);
+
+/* Writes the blocks to szFilename, replacing it, and frees psw. Returns
+ * -1 on errors, with the reason in *ppError. */
+extern int SnapshotWriterSave(snapshotwriter * psw, const char *szFilename, GError ** ppError);
+
+#endif
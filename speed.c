@@ -40,36 +40,43 @@
 static randctx rc;
 static double timeTaken;
 
+/* Generate a random board.  Don't allow chequers on the bar or borne
+ * off, so we can trivially guarantee the position is legal. */
+
+static void
+RandomBoard(int anBoard[2][25])
+{
+    int j, k;
+
+    for (j = 0; j < 25; j++)
+        anBoard[0][j] = anBoard[1][j] = 0;
+
+    for (j = 0; j < 15; j++) {
+        do {
+            k = irand(&rc) % 24;
+        } while (anBoard[1][23 - k]);
+        anBoard[0][k]++;
+
+        do {
+            k = irand(&rc) % 24;
+        } while (anBoard[0][23 - k]);
+        anBoard[1][k]++;
+    }
+}
+
 static void
 RunEvals(void *UNUSED(notused))
 {
     int aanBoard[EVALS_PER_ITERATION][2][25];
-    int i, j, k;
+    int i;
     double t;
     SSE_ALIGN(float ar[NUM_OUTPUTS]);
 
 #if defined(USE_MULTITHREAD)
     MT_Exclusive();
 #endif
-    for (i = 0; i < EVALS_PER_ITERATION; i++) {
-        /* Generate a random board.  Don't allow chequers on the bar
-         * or borne off, so we can trivially guarantee the position
-         * is legal. */
-        for (j = 0; j < 25; j++)
-            aanBoard[i][0][j] = aanBoard[i][1][j] = 0;
-
-        for (j = 0; j < 15; j++) {
-            do {
-                k = irand(&rc) % 24;
-            } while (aanBoard[i][1][23 - k]);
-            aanBoard[i][0][k]++;
-
-            do {
-                k = irand(&rc) % 24;
-            } while (aanBoard[i][0][23 - k]);
-            aanBoard[i][1][k]++;
-        }
-    }
+    for (i = 0; i < EVALS_PER_ITERATION; i++)
+        RandomBoard(aanBoard[i]);
 
 #if defined(USE_MULTITHREAD)
     MT_Release();
@@ -90,6 +97,133 @@ RunEvals(void *UNUSED(notused))
 #endif
 }
 
+#if defined(USE_MULTITHREAD)
+
+/* "calibrate threads": the same work is run with 1, 2, 4, ... threads,
+ * each thread getting a fixed share, so that perfect scaling keeps the
+ * time constant and the throughput grows with the number of threads. */
+
+#define SCALING_ITERATIONS 32   /* evaluations per thread, in EVALS_PER_ITERATION */
+#define SCALING_GAMES 24        /* rollout games per thread */
+
+static int aanScalingBoard[EVALS_PER_ITERATION][2][25];
+static rolloutcontext rcScaling;
+static int nScalingGame, nScalingGames;
+
+static void
+ScalingEvals(void *UNUSED(notused))
+{
+    int i;
+    SSE_ALIGN(float ar[NUM_OUTPUTS]);
+
+    for (i = 0; i < EVALS_PER_ITERATION && !fInterrupt; i++)
+        (void) EvaluatePosition(NULL, (ConstTanBoard) aanScalingBoard[i], ar, &ciCubeless, NULL);
+}
+
+static void
+ScalingRollouts(void *UNUSED(notused))
+{
+    rngcontext *rngctxScaling = CopyRNGContext(rngctxRollout);
+    perArray dicePerms;
+    int iGame;
+
+    dicePerms.nPermutationSeed = -1;
+
+    while ((iGame = MT_SafeIncValue(&nScalingGame) - 1) < nScalingGames && !fInterrupt) {
+        TanBoard anBoard;
+        float aar[1][NUM_ROLLOUT_OUTPUTS];
+        int fCubeDecTop = TRUE;
+
+        /* every game count plays the same games whatever the number of threads */
+        InitBoard(anBoard, VARIATION_STANDARD);
+        InitRNGSeed((unsigned int) (rcScaling.nSeed + ((unsigned int) iGame << 8)), rcScaling.rngRollout,
+                    rngctxScaling);
+        BasicCubefulRollout(&anBoard, aar, 0, iGame, &ciCubeless, &fCubeDecTop, 1, &rcScaling, NULL, 1,
+                            &dicePerms, rngctxScaling, NULL);
+    }
+
+    g_free(rngctxScaling);
+}
+
+static void
+CalibrateThreads(char *sz)
+{
+    unsigned int nThreads = MT_GetNumThreads(), nMax = nThreads, n, i, iCacheSize;
+    double t, rEvals, rGames, rEvals1 = 0.0, rGames1 = 0.0;
+
+    if (sz && *sz) {
+        int nArg = ParseNumber(&sz);
+
+        if (nArg < 1 || nArg > MAX_NUMTHREADS) {
+            outputf(_("The maximum number of threads must be between 1 and %d.\n"), MAX_NUMTHREADS);
+            return;
+        }
+        nMax = (unsigned int) nArg;
+    }
+
+    rc.randrsl[0] = (ub4) time(NULL);
+    for (i = 0; i < RANDSIZ; i++)
+        rc.randrsl[i] = rc.randrsl[0];
+    irandinit(&rc, TRUE);
+
+    for (i = 0; i < EVALS_PER_ITERATION; i++)
+        RandomBoard(aanScalingBoard[i]);
+
+    /* a cubeless 0-ply rollout of the opening position with a fixed seed */
+    memcpy(&rcScaling, &rcRollout, sizeof(rcScaling));
+    rcScaling.fCubeful = rcScaling.fVarRedn = rcScaling.fInitial = rcScaling.fRotate = FALSE;
+    rcScaling.fLateEvals = rcScaling.fDoTruncate = FALSE;
+    rcScaling.fTruncBearoff2 = rcScaling.fTruncBearoffOS = FALSE;
+    rcScaling.aecChequer[0].nPlies = rcScaling.aecChequer[1].nPlies = 0;
+    rcScaling.aecCube[0].nPlies = rcScaling.aecCube[1].nPlies = 0;
+    rcScaling.rngRollout = RNG_MERSENNE;
+    rcScaling.nSeed = 1;
+
+    iCacheSize = GetEvalCacheEntries();
+
+    outputl(_("Threads  Evaluations/s  Speedup  Rollout games/s  Speedup"));
+
+    for (n = 1; !fInterrupt; n = MIN(2 * n, nMax)) {
+        MT_SetNumThreads(n);
+
+        /* the evaluations are timed without the cache, as calibrate does */
+        EvalCacheResize(0);
+        t = get_time();
+        mt_add_tasks(n * SCALING_ITERATIONS, ScalingEvals, NULL, NULL);
+        (void) MT_WaitForTasks(NULL, 0, FALSE);
+        t = get_time() - t;
+        rEvals = t > 0.0 ? n * SCALING_ITERATIONS * EVALS_PER_ITERATION * 1000.0 / t : 0.0;
+        EvalCacheResize(iCacheSize);
+
+        nScalingGame = 0;
+        nScalingGames = (int) (n * SCALING_GAMES);
+        t = get_time();
+        mt_add_tasks(n, ScalingRollouts, NULL, NULL);
+        (void) MT_WaitForTasks(NULL, 0, FALSE);
+        t = get_time() - t;
+        rGames = t > 0.0 ? nScalingGames * 1000.0 / t : 0.0;
+
+        if (fInterrupt)
+            break;
+
+        if (n == 1) {
+            rEvals1 = rEvals;
+            rGames1 = rGames;
+        }
+
+        outputf("%7u  %13.0f  %7.2f  %15.1f  %7.2f\n", n, rEvals, rEvals1 > 0.0 ? rEvals / rEvals1 : 0.0,
+                rGames, rGames1 > 0.0 ? rGames / rGames1 : 0.0);
+        outputx();
+
+        if (n == nMax)
+            break;
+    }
+
+    MT_SetNumThreads(nThreads);
+}
+
+#endif
+
 extern void
 CommandCalibrate(char *sz)
 {
@@ -99,6 +233,17 @@ CommandCalibrate(char *sz)
     void *pcc = NULL;
 #endif
 
+    if (sz && *sz && !StrNCaseCmp(sz, "threads", 7)) {
+        NextToken(&sz);
+#if defined(USE_MULTITHREAD)
+        CalibrateThreads(sz);
+#else
+        outputl(_("This installation of GNU Backgammon was compiled without\n"
+                  "multithreading, and cannot measure scaling with threads."));
+#endif
+        return;
+    }
+
     iCacheSize = GetEvalCacheEntries();
     EvalCacheResize(0);
 
@@ -0,0 +1,398 @@
+/*
+ * Copyright (C) 2026 the AUTHORS
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * $Id$
+ */
+
+/* The "tunefilters" command.
+ *
+ * The chequer plays of a dataset written by "export dataset" whose best
+ * move was found at least as deep as the plies being tuned (or by a
+ * rollout) are searched again with candidate move filters for those
+ * plies. Starting from the analysis filters, the filters are narrowed one
+ * step at a time, taking the step that saves most, for as long as the
+ * best move changes in no more than the given share of the positions
+ * beyond what the analysis filters already change.
+ *
+ * The cost of a search is the number of neural net evaluations when the
+ * engine statistics are compiled in (the cache is flushed before every
+ * search), and the time it takes otherwise. */
+
+#include "config.h"
+
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "backgammon.h"
+#include "dataset.h"
+#include "enginestats.h"
+#include "multithread.h"
+#include "positionid.h"
+
+/* default allowed share of changed best moves, in percent */
+#define TUNE_DEFAULT_CHANGED 1.0f
+
+typedef struct {
+    TanBoard anBoard;
+    cubeinfo ci;
+    int anDice[2];
+    positionkey keyBest;        /* the position after the reference best move */
+} tuneposition;
+
+typedef enum {
+    TUNE_SKIP,                  /* skip the level */
+    TUNE_ACCEPT,
+    TUNE_EXTRA,
+    TUNE_THRESHOLD,
+    N_TUNE_STEPS
+} tunestep;
+
+static GArray *paTune;
+static evalcontext ecTune;
+static movefilter aamfTune[MAX_FILTER_PLIES][MAX_FILTER_PLIES];
+static int iTuneNext, cTuneDone, cTuneChanged, fTuneError;
+
+static int
+ReadPositions(const char *sz, unsigned int nPlies)
+{
+    FILE *pf;
+    datasetheader dh;
+    datasetrecord dr;
+    guint64 i, cRecords;
+    guint32 cbRecord;
+
+    if (!(pf = g_fopen(sz, "rb"))) {
+        outputerr(sz);
+        return -1;
+    }
+
+    if (fread(&dh, sizeof(dh), 1, pf) != 1 || memcmp(dh.szMagic, DATASET_MAGIC, sizeof(DATASET_MAGIC)) ||
+        GUINT32_FROM_LE(dh.nVersion) != DATASET_VERSION ||
+        (cbRecord = GUINT32_FROM_LE(dh.cbRecord)) < sizeof(datasetrecord)) {
+        outputf(_("%s is not a dataset written by `export dataset'.\n"), sz);
+        fclose(pf);
+        return -1;
+    }
+
+    cRecords = GUINT64_FROM_LE(dh.cRecords);
+
+    for (i = 0; i < cRecords; i++) {
+        tuneposition tp;
+        positionkey key;
+        TanBoard anBoard;
+        int anScore[2], anBest[8], j;
+
+        /* later versions of the records may be longer */
+        if (fread(&dr, sizeof(dr), 1, pf) != 1 ||
+            (cbRecord > sizeof(dr) && fseek(pf, (long) (cbRecord - sizeof(dr)), SEEK_CUR))) {
+            outputerr(sz);
+            fclose(pf);
+            return -1;
+        }
+
+        if (dr.dt != DATASET_MOVE || GUINT16_FROM_LE(dr.iRank) == DATASET_NO_RANK ||
+            !(dr.et == EVAL_ROLLOUT || (dr.et == EVAL_EVAL && dr.nPlies >= nPlies)) || dr.anBest[0] < 0)
+            continue;
+
+        /* don't trust the file with the shift or the move generator */
+        if (dr.nLogCube > 15 || dr.anDice[0] < 1 || dr.anDice[0] > 6 || dr.anDice[1] < 1 || dr.anDice[1] > 6)
+            continue;
+
+        for (j = 0; j < 7; j++)
+            key.data[j] = GUINT32_FROM_LE(dr.anKey[j]);
+        PositionFromKey(tp.anBoard, &key);
+
+        anScore[0] = GUINT16_FROM_LE(dr.anScore[0]);
+        anScore[1] = GUINT16_FROM_LE(dr.anScore[1]);
+        if (SetCubeInfo(&tp.ci, 1 << dr.nLogCube, dr.fCubeOwner, 0, GUINT16_FROM_LE(dr.nMatchTo), anScore,
+                        (dr.fFlags & DATASET_CRAWFORD) != 0, (dr.fFlags & DATASET_JACOBY) != 0, (int) nBeavers,
+                        (bgvariation) dr.bgv))
+            continue;
+
+        tp.anDice[0] = dr.anDice[0];
+        tp.anDice[1] = dr.anDice[1];
+
+        for (j = 0; j < 8; j++)
+            anBest[j] = dr.anBest[j];
+        memcpy(anBoard, tp.anBoard, sizeof(anBoard));
+        if (ApplyMove(anBoard, anBest, TRUE))
+            continue;
+        PositionKey((ConstTanBoard) anBoard, &tp.keyBest);
+
+        g_array_append_val(paTune, tp);
+    }
+
+    fclose(pf);
+
+    return 0;
+}
+
+static void
+TuneTask(void *UNUSED(unused))
+{
+    int i;
+
+    while ((i = MT_SafeIncValue(&iTuneNext) - 1) < (int) paTune->len && !fInterrupt) {
+        tuneposition *ptp = &g_array_index(paTune, tuneposition, i);
+        movelist ml;
+
+        if (FindnSaveBestMoves(&ml, ptp->anDice[0], ptp->anDice[1], (ConstTanBoard) ptp->anBoard, NULL, 0.0f,
+                               &ptp->ci, &ecTune, aamfTune) < 0) {
+            g_free(ml.amMoves);
+            MT_SafeSet(&fTuneError, TRUE);
+            return;
+        }
+
+        if (ml.cMoves) {
+            if (!EqualKeys(ml.amMoves[0].key, ptp->keyBest))
+                MT_SafeInc(&cTuneChanged);
+            g_free(ml.amMoves);
+        }
+
+        MT_SafeInc(&cTuneDone);
+    }
+}
+
+static gboolean
+TuneProgress(gpointer UNUSED(unused))
+{
+    ProgressValue(MT_SafeGet(&cTuneDone));
+
+    return TRUE;
+}
+
+/* Searches all positions with aamfTune; returns -1 if interrupted or an
+ * evaluation failed */
+
+static int
+TuneRun(guint64 * pnCost, unsigned int *pcChanged)
+{
+    enginestats es;
+    double rTickRate, t;
+
+    iTuneNext = cTuneDone = cTuneChanged = fTuneError = 0;
+
+    EvalCacheFlush();
+    EngineStatsReset();
+
+    ProgressStartValue(_("Tuning move filters"), (int) paTune->len);
+    t = get_time();
+    mt_add_tasks(MIN(MT_GetNumThreads(), paTune->len), TuneTask, NULL, NULL);
+    (void) MT_WaitForTasks(TuneProgress, 250, FALSE);
+    t = get_time() - t;
+    ProgressEnd();
+
+    if (fInterrupt)
+        return -1;
+
+    if (fTuneError) {
+        outputl(_("An evaluation failed, the move filters were not tuned."));
+        return -1;
+    }
+
+    if (EngineStatsTotal(&es, &rTickRate))
+        *pnCost = es.an[ESC_EVAL_CONTACT] + es.an[ESC_EVAL_CRASHED] + es.an[ESC_EVAL_RACE] +
+            es.an[ESC_EVAL_PRUNE];
+    else
+        *pnCost = (guint64) t;
+
+    *pcChanged = (unsigned int) cTuneChanged;
+
+    return 0;
+}
+
+/* Narrows level iLevel of pmf by one step of kind ts; returns FALSE if
+ * it cannot be narrowed that way */
+
+static int
+TuneNarrow(movefilter * pmf, int iLevel, tunestep ts)
+{
+    if (pmf->Accept < 0)
+        return FALSE;
+
+    switch (ts) {
+    case TUNE_SKIP:
+        /* the first level must stay, it is where the moves are pruned */
+        if (!iLevel)
+            return FALSE;
+        pmf->Accept = -1;
+        pmf->Extra = 0;
+        pmf->Threshold = 0.0f;
+        return TRUE;
+
+    case TUNE_ACCEPT:
+        if (!pmf->Accept)
+            return FALSE;
+        pmf->Accept -= MAX(1, pmf->Accept / 4);
+        break;
+
+    case TUNE_EXTRA:
+        if (!pmf->Extra)
+            return FALSE;
+        pmf->Extra -= MAX(1, pmf->Extra / 4);
+        break;
+
+    case TUNE_THRESHOLD:
+        if (pmf->Threshold <= 0.0f)
+            return FALSE;
+        pmf->Threshold = MAX(0.0f, floorf((pmf->Threshold - MAX(0.01f, pmf->Threshold / 4)) * 200.0f + 0.5f) / 200.0f);
+        break;
+
+    default:
+        g_assert_not_reached();
+        return FALSE;
+    }
+
+    /* at least one move must be kept */
+    return pmf->Accept + pmf->Extra > 0;
+}
+
+static void
+ShowFilters(movefilter amf[MAX_FILTER_PLIES], unsigned int nPlies)
+{
+    gchar buf[G_ASCII_DTOSTR_BUF_SIZE];
+    GString *gs = g_string_new("  { ");
+    unsigned int i;
+
+    for (i = 0; i < nPlies; i++)
+        outputf("set analysis movefilter %u %u %d %d %s\n", nPlies, i, amf[i].Accept, amf[i].Extra,
+                g_ascii_formatd(buf, G_ASCII_DTOSTR_BUF_SIZE, "%0.3g", amf[i].Threshold));
+
+    for (i = 0; i < MAX_FILTER_PLIES; i++) {
+        const movefilter *pmf = i < nPlies ? amf + i : NULL;
+
+        g_string_append_printf(gs, "{ %2d, %2d, %sf }%s", pmf ? pmf->Accept : 0, pmf ? pmf->Extra : 0,
+                               g_ascii_formatd(buf, G_ASCII_DTOSTR_BUF_SIZE, "%0.3g", pmf ? pmf->Threshold : 0.0f),
+                               i < MAX_FILTER_PLIES - 1 ? ", " : " }");
+    }
+    outputf(_("As a row of movefilters.inc:\n%s\n"), gs->str);
+    g_string_free(gs, TRUE);
+}
+
+extern void
+CommandTuneFilters(char *sz)
+{
+    char *szFile = NextToken(&sz);
+    int nPlies = ParseNumber(&sz);
+    float rChanged = TUNE_DEFAULT_CHANGED;
+    const char *szCost;
+    guint64 nCost, nCostStart;
+    unsigned int cChanged, cChangedStart, cChangedMax;
+    enginestats es;
+    double rTickRate;
+
+    if (!szFile || !*szFile) {
+        outputl(_("You must specify a dataset (see `help tunefilters')."));
+        return;
+    }
+
+    if (nPlies < 1 || nPlies > MAX_FILTER_PLIES) {
+        outputf(_("You must specify the plies to tune, 1 to %d (see `help tunefilters').\n"), MAX_FILTER_PLIES);
+        return;
+    }
+
+    if (sz && *sz && ((rChanged = ParseReal(&sz)) < 0.0f || rChanged > 100.0f)) {
+        outputl(_("The share of changed best moves must be a percentage (see `help tunefilters')."));
+        return;
+    }
+
+    paTune = g_array_new(FALSE, FALSE, sizeof(tuneposition));
+
+    if (ReadPositions(szFile, (unsigned int) nPlies) < 0)
+        goto done;
+
+    if (!paTune->len) {
+        outputf(_("%s has no chequer plays analysed at %d-ply or deeper.\n"), szFile, nPlies);
+        goto done;
+    }
+
+    if (EngineStatsTotal(&es, &rTickRate))
+        szCost = _("evaluations");
+    else {
+        szCost = _("ms");
+        outputl(_("The engine statistics are not compiled in, "
+                  "so the searches are compared by the time they take."));
+    }
+
+    ecTune = esAnalysisChequer.ec;
+    ecTune.nPlies = (unsigned int) nPlies;
+    ecTune.rNoise = 0.0f;
+    memcpy(aamfTune, aamfAnalysis, sizeof(aamfTune));
+
+    if (TuneRun(&nCostStart, &cChangedStart) < 0)
+        goto done;
+
+    cChangedMax = cChangedStart + (unsigned int) floorf(rChanged * (float) paTune->len / 100.0f);
+    outputf(_("%u positions, %u best moves changed with the analysis filters (%" G_GUINT64_FORMAT " %s), "
+              "up to %u allowed.\n"), paTune->len, cChangedStart, nCostStart, szCost, cChangedMax);
+
+    nCost = nCostStart;
+    cChanged = cChangedStart;
+
+    for (;;) {
+        movefilter amfBase[MAX_FILTER_PLIES], amfBest[MAX_FILTER_PLIES];
+        guint64 nCostBest = nCost;
+        unsigned int cChangedBest = cChanged;
+        int i, fFound = FALSE;
+        tunestep ts;
+
+        memcpy(amfBase, aamfTune[nPlies - 1], sizeof(amfBase));
+
+        for (i = 0; i < nPlies; i++)
+            for (ts = TUNE_SKIP; ts < N_TUNE_STEPS; ts++) {
+                guint64 nCostTry;
+                unsigned int cChangedTry;
+
+                if (!TuneNarrow(aamfTune[nPlies - 1] + i, i, ts)) {
+                    memcpy(aamfTune[nPlies - 1], amfBase, sizeof(amfBase));
+                    continue;
+                }
+
+                if (TuneRun(&nCostTry, &cChangedTry) < 0)
+                    goto done;
+
+                if (cChangedTry <= cChangedMax && nCostTry < nCostBest) {
+                    memcpy(amfBest, aamfTune[nPlies - 1], sizeof(amfBest));
+                    nCostBest = nCostTry;
+                    cChangedBest = cChangedTry;
+                    fFound = TRUE;
+                }
+
+                memcpy(aamfTune[nPlies - 1], amfBase, sizeof(amfBase));
+            }
+
+        if (!fFound)
+            break;
+
+        memcpy(aamfTune[nPlies - 1], amfBest, sizeof(amfBest));
+        nCost = nCostBest;
+        cChanged = cChangedBest;
+
+        outputf(_("%" G_GUINT64_FORMAT " %s, %u best moves changed\n"), nCost, szCost, cChanged);
+    }
+
+    outputf(_("\nThe %d-ply searches cost %.1f%% of those with the analysis filters, "
+              "%u best moves changed (%u with the analysis filters).\n"),
+            nPlies, nCostStart ? 100.0 * (double) nCost / (double) nCostStart : 100.0, cChanged, cChangedStart);
+    ShowFilters(aamfTune[nPlies - 1], (unsigned int) nPlies);
+
+  done:
+    g_array_free(paTune, TRUE);
+    paTune = NULL;
+}